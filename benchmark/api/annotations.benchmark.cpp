@@ -0,0 +1,59 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/annotation/annotation.hpp>
+#include <mbgl/map/map.hpp>
+#include <mbgl/map/map_observer.hpp>
+#include <mbgl/map/map_options.hpp>
+#include <mbgl/gfx/headless_frontend.hpp>
+#include <mbgl/style/style.hpp>
+#include <mbgl/storage/resource_options.hpp>
+#include <mbgl/storage/network_status.hpp>
+#include <mbgl/util/run_loop.hpp>
+
+#include <cmath>
+
+using namespace mbgl;
+
+namespace {
+
+constexpr double pixelRatio { 1.0 };
+constexpr Size size { 1000, 1000 };
+
+// Short lines spread in a grid over most of the world.
+LineAnnotation line(std::size_t index, std::size_t count) {
+    const auto side = static_cast<std::size_t>(std::ceil(std::sqrt(count)));
+    const double longitude = -170.0 + 340.0 * (index % side) / side;
+    const double latitude = -80.0 + 160.0 * (index / side) / side;
+    return LineAnnotation { LineString<double> { { longitude, latitude }, { longitude + 0.1, latitude + 0.1 } } };
+}
+
+} // end namespace
+
+// Measures rendering after moving a single line, which rebuilds the annotation data of all
+// rendered tiles, while only a few of the lines are within the view.
+static void API_updateLineAnnotation(::benchmark::State& state) {
+    util::RunLoop loop;
+    NetworkStatus::Set(NetworkStatus::Status::Offline);
+
+    HeadlessFrontend frontend { size, pixelRatio };
+    Map map { frontend, MapObserver::nullObserver(),
+              MapOptions().withMapMode(MapMode::Static).withSize(size).withPixelRatio(pixelRatio),
+              ResourceOptions().withCachePath(":memory:").withAccessToken("foobar") };
+    map.getStyle().loadJSON(R"STYLE({ "version": 8, "sources": {}, "layers": [] })STYLE");
+    map.jumpTo(CameraOptions().withCenter(LatLng { 0, 0 }).withZoom(6.0));
+
+    const auto count = static_cast<std::size_t>(state.range(0));
+    for (std::size_t i = 0; i < count; ++i) {
+        map.addAnnotation(line(i, count));
+    }
+    const AnnotationID moved = map.addAnnotation(line(0, count));
+    frontend.render(map);
+
+    std::size_t iteration = 0;
+    while (state.KeepRunning()) {
+        map.updateAnnotation(moved, line(++iteration % count, count));
+        frontend.render(map);
+    }
+}
+
+BENCHMARK(API_updateLineAnnotation)->Arg(100)->Arg(1000)->Arg(10000)->Arg(100000);
@@ -0,0 +1,88 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/style/sources/geojson_source.hpp>
+#include <mbgl/style/source_observer.hpp>
+#include <mbgl/util/geometry.hpp>
+#include <mbgl/util/run_loop.hpp>
+
+#include <cmath>
+
+using namespace mbgl;
+using namespace mbgl::style;
+
+namespace {
+
+// A grid of points covering most of the world.
+GeoJSON points(std::size_t count) {
+    const auto side = static_cast<std::size_t>(std::ceil(std::sqrt(count)));
+    FeatureCollection features;
+    features.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        features.emplace_back(Point<double>{ -170.0 + 340.0 * (i % side) / side,
+                                             -80.0 + 160.0 * (i / side) / side });
+    }
+    return features;
+}
+
+// Zig-zagging lines of 100 vertices each.
+GeoJSON lines(std::size_t count) {
+    FeatureCollection features;
+    features.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        const double latitude = -80.0 + 160.0 * i / count;
+        LineString<double> line;
+        for (std::size_t j = 0; j < 100; ++j) {
+            line.emplace_back(-170.0 + 3.4 * j, latitude + (j % 2 ? 0.5 : -0.5));
+        }
+        features.emplace_back(std::move(line));
+    }
+    return features;
+}
+
+class IndexObserver : public SourceObserver {
+public:
+    IndexObserver(util::RunLoop& loop_) : loop(loop_) {}
+
+    void onSourceChanged(Source&) override {
+        loop.stop();
+    }
+
+    util::RunLoop& loop;
+};
+
+// Measures how long setGeoJSON blocks the calling thread. The time spent waiting for the
+// index to be built isn't counted.
+void setGeoJSON(::benchmark::State& state, const GeoJSON& geoJSON, const GeoJSONOptions& options) {
+    util::RunLoop loop;
+    IndexObserver observer(loop);
+    GeoJSONSource source("source", options);
+    source.setObserver(&observer);
+
+    while (state.KeepRunning()) {
+        source.setGeoJSON(geoJSON);
+
+        state.PauseTiming();
+        loop.run();
+        state.ResumeTiming();
+    }
+}
+
+} // end namespace
+
+static void API_setGeoJSONPoints(::benchmark::State& state) {
+    setGeoJSON(state, points(state.range(0)), {});
+}
+
+static void API_setGeoJSONLines(::benchmark::State& state) {
+    setGeoJSON(state, lines(state.range(0)), {});
+}
+
+static void API_setGeoJSONClusteredPoints(::benchmark::State& state) {
+    GeoJSONOptions options;
+    options.cluster = true;
+    setGeoJSON(state, points(state.range(0)), options);
+}
+
+BENCHMARK(API_setGeoJSONPoints)->Arg(10000)->Arg(100000);
+BENCHMARK(API_setGeoJSONLines)->Arg(1000)->Arg(10000);
+BENCHMARK(API_setGeoJSONClusteredPoints)->Arg(10000)->Arg(100000);
@@ -62,6 +62,30 @@ static void API_queryRenderedFeaturesLayerFromHighDensity(::benchmark::State& st
     }
 }
 
+static void API_queryRenderedFeaturesIDsOnly(::benchmark::State& state) {
+    QueryBenchmark bench;
+    RenderedQueryOptions options;
+    options.properties = std::vector<std::string>();
+    options.geometry = false;
+
+    while (state.KeepRunning()) {
+        bench.frontend.getRenderer()->queryRenderedFeatures(bench.box, options);
+    }
+}
+
+static void API_queryRenderedFeaturesSingleProperty(::benchmark::State& state) {
+    QueryBenchmark bench;
+    RenderedQueryOptions options;
+    options.properties = std::vector<std::string>{ "class" };
+    options.geometry = false;
+
+    while (state.KeepRunning()) {
+        bench.frontend.getRenderer()->queryRenderedFeatures(bench.box, options);
+    }
+}
+
 BENCHMARK(API_queryRenderedFeaturesAll);
 BENCHMARK(API_queryRenderedFeaturesLayerFromLowDensity);
 BENCHMARK(API_queryRenderedFeaturesLayerFromHighDensity);
+BENCHMARK(API_queryRenderedFeaturesIDsOnly);
+BENCHMARK(API_queryRenderedFeaturesSingleProperty);
@@ -0,0 +1,120 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/util/geojson_parser.hpp>
+#include <mbgl/style/conversion/json.hpp>
+#include <mbgl/style/conversion/geojson.hpp>
+#include <mbgl/util/string.hpp>
+
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace mbgl;
+
+namespace {
+
+// A feature collection of lines with a few properties each, about 300 bytes per feature.
+std::string lines(std::size_t count) {
+    std::string json = R"JSON({"type":"FeatureCollection","features":[)JSON";
+    for (std::size_t i = 0; i < count; ++i) {
+        if (i) {
+            json += ',';
+        }
+        json += R"JSON({"type":"Feature","id":)JSON" + util::toString(i);
+        json += R"JSON(,"properties":{"name":"line )JSON" + util::toString(i) +
+                R"JSON(","rank":)JSON" + util::toString(i % 10) + R"JSON(,"visible":true},)JSON";
+        json += R"JSON("geometry":{"type":"LineString","coordinates":[)JSON";
+        const double latitude = -80.0 + 160.0 * i / count;
+        for (std::size_t j = 0; j < 8; ++j) {
+            json += (j ? ",[" : "[") + util::toString(-170.0 + 42.5 * j) + "," +
+                    util::toString(latitude + (j % 2 ? 0.123456 : -0.123456)) + "]";
+        }
+        json += "]}}";
+    }
+    json += "]}";
+    return json;
+}
+
+// The peak resident set size of the process so far, in kilobytes.
+int64_t maxRSS() {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+#if defined(__APPLE__)
+    return usage.ru_maxrss / 1024;
+#else
+    return usage.ru_maxrss;
+#endif
+}
+
+// How much running the function grows the peak resident set size. The peak only ever grows, so
+// the function runs in a child process of its own, where neither earlier benchmarks nor the
+// memory this process held at its peak count towards it. Run it before the timed iterations,
+// whose freed memory the child could otherwise reuse.
+template <class Fn>
+std::string peakRSSIncrease(Fn&& fn) {
+    int fds[2];
+    if (pipe(fds) != 0) {
+        return "peak RSS unknown";
+    }
+
+    const pid_t pid = fork();
+    if (pid == 0) {
+        close(fds[0]);
+        const int64_t before = maxRSS();
+        fn();
+        const int64_t increase = maxRSS() - before;
+        const ssize_t written = write(fds[1], &increase, sizeof(increase));
+        _exit(written == sizeof(increase) ? 0 : 1);
+    }
+
+    close(fds[1]);
+    int64_t increase = -1;
+    if (pid < 0 || read(fds[0], &increase, sizeof(increase)) != sizeof(increase)) {
+        increase = -1;
+    }
+    close(fds[0]);
+    if (pid > 0) {
+        waitpid(pid, nullptr, 0);
+    }
+
+    if (increase < 0) {
+        return "peak RSS unknown";
+    }
+    return "peak RSS +" + util::toString(increase / 1024) + " MB";
+}
+
+} // end namespace
+
+static void Parse_GeoJSONStreaming(::benchmark::State& state) {
+    const std::string json = lines(state.range(0));
+    const std::string label = peakRSSIncrease([&] {
+        ::benchmark::DoNotOptimize(util::parseGeoJSON(json));
+    });
+
+    while (state.KeepRunning()) {
+        ::benchmark::DoNotOptimize(util::parseGeoJSON(json));
+    }
+
+    state.SetBytesProcessed(state.iterations() * json.size());
+    state.SetLabel(label);
+}
+
+static void Parse_GeoJSONDocument(::benchmark::State& state) {
+    const std::string json = lines(state.range(0));
+    const std::string label = peakRSSIncrease([&] {
+        style::conversion::Error error;
+        ::benchmark::DoNotOptimize(style::conversion::convertJSON<GeoJSON>(json, error));
+    });
+
+    while (state.KeepRunning()) {
+        style::conversion::Error error;
+        ::benchmark::DoNotOptimize(style::conversion::convertJSON<GeoJSON>(json, error));
+    }
+
+    state.SetBytesProcessed(state.iterations() * json.size());
+    state.SetLabel(label);
+}
+
+// 1000000 features make for about 300 MB of GeoJSON.
+BENCHMARK(Parse_GeoJSONStreaming)->Arg(10000)->Arg(1000000);
+BENCHMARK(Parse_GeoJSONDocument)->Arg(10000)->Arg(1000000);
@@ -0,0 +1,50 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/benchmark/stub_geometry_tile_feature.hpp>
+#include <mbgl/renderer/buckets/circle_bucket.hpp>
+#include <mbgl/renderer/bucket_parameters.hpp>
+#include <mbgl/util/constants.hpp>
+
+#include <string>
+
+using namespace mbgl;
+
+namespace {
+
+std::size_t layoutBytes(const CircleBucket& bucket) {
+    return bucket.vertices.bytes() + bucket.quadVertices.bytes() + bucket.instanceVertices.bytes() +
+           bucket.triangles.bytes();
+}
+
+// Builds a bucket with one circle per point and reports the memory of its layout vertices and
+// indices. Data-driven paint attributes are stored per vertex in the quad layout and per circle
+// in the instanced layout, so they shrink by the same factor as the layout vertices.
+void addFeatures(benchmark::State& state, bool supportsInstancing) {
+    const auto count = state.range(0);
+    std::size_t bytes = 0;
+
+    while (state.KeepRunning()) {
+        CircleBucket bucket { { { 0, 0, 0 }, MapMode::Continuous, 1.0, nullptr, supportsInstancing }, {} };
+        for (int64_t i = 0; i < count; ++i) {
+            GeometryCollection point { { { int16_t(i % util::EXTENT), int16_t(i / util::EXTENT) } } };
+            bucket.addFeature(StubGeometryTileFeature { {}, FeatureType::Point, point, {} }, point, {}, PatternLayerMap(), 0);
+        }
+        bytes = layoutBytes(bucket);
+    }
+
+    state.SetLabel(std::to_string(bytes / 1024) + " KiB");
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+} // namespace
+
+static void CircleBucket_AddFeatures(benchmark::State& state) {
+    addFeatures(state, false);
+}
+
+static void CircleBucket_AddFeaturesInstanced(benchmark::State& state) {
+    addFeatures(state, true);
+}
+
+BENCHMARK(CircleBucket_AddFeatures)->Arg(1000)->Arg(10000)->Arg(100000);
+BENCHMARK(CircleBucket_AddFeaturesInstanced)->Arg(1000)->Arg(10000)->Arg(100000);
@@ -0,0 +1,107 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/storage/default_file_source.hpp>
+#include <mbgl/storage/offline_database.hpp>
+#include <mbgl/storage/resource.hpp>
+#include <mbgl/storage/response.hpp>
+#include <mbgl/util/io.hpp>
+#include <mbgl/util/run_loop.hpp>
+#include <mbgl/util/string.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+using namespace mbgl;
+
+namespace {
+
+std::string temporaryPath(const std::string& name) {
+    const char* directory = std::getenv("TMPDIR");
+    return std::string(directory && *directory ? directory : "/tmp") + "/mbgl-" + name + "-" +
+           util::toString(getpid()) + ".db";
+}
+
+const std::string cachePath = temporaryPath("cache_readers");
+const unsigned tileCount = 1000;
+
+Resource cachedTile(unsigned i) {
+    return Resource::tile("mapbox://tile_ambient" + util::toString(i), 1, 0, 0, 0, Tileset::Scheme::XYZ);
+}
+
+void deleteCache() {
+    util::deleteFile(cachePath);
+    util::deleteFile(cachePath + "-wal");
+    util::deleteFile(cachePath + "-shm");
+    util::deleteFile(cachePath + "-journal");
+}
+
+} // end namespace
+
+// Reads tiles from the cache while another thread keeps writing, like a region download does,
+// with the given number of cache readers. Reports the read latency percentiles.
+static void DefaultFileSource_CacheReadsDuringWrites(::benchmark::State& state) {
+    using namespace std::chrono_literals;
+
+    deleteCache();
+
+    Response response;
+    response.data = std::make_shared<std::string>(16 * 1024, '0');
+    response.mustRevalidate = false;
+    response.expires = util::now() + 1h;
+
+    {
+        OfflineDatabase db(cachePath);
+        for (unsigned i = 0; i < tileCount; ++i) {
+            db.put(cachedTile(i), response);
+        }
+    }
+
+    util::RunLoop loop;
+    DefaultFileSource fs(cachePath, ".");
+    fs.setCacheReaderCount(static_cast<std::size_t>(state.range(0)));
+
+    std::atomic<bool> writing { true };
+    std::thread writer([&] {
+        unsigned i = 0;
+        while (writing) {
+            fs.put(Resource::tile("mapbox://tile_download" + util::toString(i++), 1, 0, 0, 0, Tileset::Scheme::XYZ), response);
+            std::this_thread::sleep_for(1ms);
+        }
+    });
+
+    std::vector<Duration> latencies;
+    unsigned i = 0;
+    while (state.KeepRunning()) {
+        Resource resource = cachedTile(i++ % tileCount);
+        resource.loadingMethod = Resource::LoadingMethod::CacheOnly;
+
+        const auto start = Clock::now();
+        auto req = fs.request(resource, [&](Response) {
+            latencies.push_back(Clock::now() - start);
+            loop.stop();
+        });
+        loop.run();
+    }
+
+    writing = false;
+    writer.join();
+
+    std::sort(latencies.begin(), latencies.end());
+    auto percentile = [&](double p) {
+        const auto latency = latencies[std::min(latencies.size() - 1, std::size_t(p * latencies.size()))];
+        return util::toString(std::chrono::duration<double, std::milli>(latency).count());
+    };
+    if (!latencies.empty()) {
+        state.SetLabel("p50 " + percentile(0.5) + "ms, p90 " + percentile(0.9) + "ms, p99 " + percentile(0.99) + "ms");
+    }
+    state.SetItemsProcessed(state.iterations());
+
+    deleteCache();
+}
+
+BENCHMARK(DefaultFileSource_CacheReadsDuringWrites)->Arg(0)->Arg(4)->UseRealTime();
@@ -4,51 +4,168 @@
 #include <mbgl/storage/resource.hpp>
 #include <mbgl/storage/response.hpp>
 #include <mbgl/storage/sqlite3.hpp>
+#include <mbgl/util/io.hpp>
 #include <mbgl/util/string.hpp>
 
-class OfflineDatabase : public benchmark::Fixture {
-public:
-    void SetUp(const ::benchmark::State&) override {
-        using namespace mbgl;
-        using namespace std::chrono_literals;
+#include <cstdlib>
+#include <list>
+#include <memory>
 
-        const unsigned tileCount = 10000;
-        db.setOfflineMapboxTileCountLimit(tileCount * 2);
+#include <unistd.h>
 
-        Response response;
-        response.noContent = true;
-        response.mustRevalidate = false;
-        response.expires = util::now() + 1h;
+namespace {
 
-        for (unsigned i = 0; i < tileCount; ++i) {
-            const Resource ambient = Resource::tile("mapbox://tile_ambient" + util::toString(i), 1, 0, 0, 0, Tileset::Scheme::XYZ);
-            db.put(ambient, response);
-        }
+const unsigned tileCount = 10000;
 
-        OfflineTilePyramidRegionDefinition definition{ "mapbox://style", LatLngBounds::hull({1, 2}, {3, 4}), 5, 6, 2.0, true };
-        OfflineRegionMetadata metadata{{ 1, 2, 3 }};
+// The database lives on disk, so that writes pay for journaling and syncing like they do in the app.
+std::string temporaryPath(const std::string& name) {
+    const char* directory = std::getenv("TMPDIR");
+    return std::string(directory && *directory ? directory : "/tmp") + "/mbgl-" + name + "-" +
+           mbgl::util::toString(getpid()) + ".db";
+}
 
-        auto region = db.createRegion(definition, metadata);
-        regionID = region->getID();
+const std::string templatePath = temporaryPath("offline_database_template");
+const std::string databasePath = temporaryPath("offline_database");
 
-        for (unsigned i = 0; i < tileCount; ++i) {
-            const Resource offline = Resource::tile("mapbox://tile_offline_region" + util::toString(i), 1.0, 0, 0, 0, Tileset::Scheme::XYZ);
-            db.putRegionResource(regionID, offline, response);
-        }
+void deleteDatabaseFiles(const std::string& path) {
+    mbgl::util::deleteFile(path);
+    mbgl::util::deleteFile(path + "-wal");
+    mbgl::util::deleteFile(path + "-shm");
+    mbgl::util::deleteFile(path + "-journal");
+}
+
+mbgl::Resource ambientTile(unsigned i) {
+    return mbgl::Resource::tile("mapbox://tile_ambient" + mbgl::util::toString(i), 1, 0, 0, 0, mbgl::Tileset::Scheme::XYZ);
+}
+
+// Filling the database takes one synced transaction per ambient tile, so it is only done once
+// and copied for every benchmark.
+void createTemplate() {
+    using namespace mbgl;
+    using namespace std::chrono_literals;
+
+    static bool created = false;
+    if (created) {
+        return;
+    }
+    created = true;
+
+    deleteDatabaseFiles(templatePath);
+    std::atexit([] { deleteDatabaseFiles(templatePath); });
+
+    mbgl::OfflineDatabase db(templatePath);
+    db.setOfflineMapboxTileCountLimit(tileCount * 2);
+
+    Response response;
+    response.noContent = true;
+    response.mustRevalidate = false;
+    response.expires = util::now() + 1h;
+
+    for (unsigned i = 0; i < tileCount; ++i) {
+        db.put(ambientTile(i), response);
+    }
+
+    OfflineTilePyramidRegionDefinition definition{ "mapbox://style", LatLngBounds::hull({1, 2}, {3, 4}), 5, 6, 2.0, true };
+    OfflineRegionMetadata metadata{{ 1, 2, 3 }};
+
+    auto region = db.createRegion(definition, metadata);
+
+    std::list<std::tuple<Resource, Response>> resources;
+    for (unsigned i = 0; i < tileCount; ++i) {
+        resources.emplace_back(Resource::tile("mapbox://tile_offline_region" + util::toString(i), 1.0, 0, 0, 0, Tileset::Scheme::XYZ), response);
+    }
+    OfflineRegionStatus status;
+    db.putRegionResources(region->getID(), resources, status);
+}
+
+} // namespace
+
+class OfflineDatabase : public benchmark::Fixture {
+public:
+    void SetUp(const ::benchmark::State&) override {
+        createTemplate();
+        deleteDatabaseFiles(databasePath);
+        mbgl::util::copyFile(databasePath, templatePath);
+
+        db = std::make_unique<mbgl::OfflineDatabase>(databasePath);
+        db->setOfflineMapboxTileCountLimit(tileCount * 2);
+        regionID = db->listRegions()->front().getID();
     }
 
-    mbgl::OfflineDatabase db{":memory:"};
+    void TearDown(const ::benchmark::State&) override {
+        db.reset();
+        deleteDatabaseFiles(databasePath);
+    }
+
+    // Makes every ambient tile look like it hasn't been read in a long time, so that the next
+    // read of each of them has to update its accessed timestamp.
+    void expireAccessedTimestamps() {
+        db->flushAccessedTimestamps();
+        mapbox::sqlite::Database::open(databasePath, mapbox::sqlite::ReadWriteCreate).exec("UPDATE tiles SET accessed = 0");
+    }
+
+    std::unique_ptr<mbgl::OfflineDatabase> db;
     int64_t regionID;
 };
 
 BENCHMARK_F(OfflineDatabase, InvalidateRegion)(benchmark::State& state) {
     for (auto _ : state) {
-        db.invalidateRegion(regionID);
+        db->invalidateRegion(regionID);
     }
 }
 
 BENCHMARK_F(OfflineDatabase, InvalidateTileCache)(benchmark::State& state) {
     for (auto _ : state) {
-        db.invalidateTileCache();
+        db->invalidateTileCache();
+    }
+}
+
+// Reads tiles whose accessed timestamps need an update. The updates are batched.
+BENCHMARK_F(OfflineDatabase, GetAmbientTiles)(benchmark::State& state) {
+    const unsigned readCount = 1000;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        expireAccessedTimestamps();
+        state.ResumeTiming();
+
+        for (unsigned i = 0; i < readCount; ++i) {
+            benchmark::DoNotOptimize(db->get(ambientTile(i)));
+        }
+        db->flushAccessedTimestamps();
     }
+
+    state.SetItemsProcessed(state.iterations() * readCount);
+}
+
+// Same as GetAmbientTiles, but writes the accessed timestamp with every read, like cache reads
+// did before they were batched.
+BENCHMARK_F(OfflineDatabase, GetAmbientTilesUnbatched)(benchmark::State& state) {
+    const unsigned readCount = 1000;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        expireAccessedTimestamps();
+        state.ResumeTiming();
+
+        for (unsigned i = 0; i < readCount; ++i) {
+            benchmark::DoNotOptimize(db->get(ambientTile(i)));
+            db->flushAccessedTimestamps();
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * readCount);
+}
+
+// Reads tiles that were read recently, which doesn't write anything.
+BENCHMARK_F(OfflineDatabase, GetRecentlyReadAmbientTiles)(benchmark::State& state) {
+    const unsigned readCount = 1000;
+
+    for (auto _ : state) {
+        for (unsigned i = 0; i < readCount; ++i) {
+            benchmark::DoNotOptimize(db->get(ambientTile(i)));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * readCount);
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <mbgl/util/optional.hpp>
+#include <mbgl/util/geo.hpp>
 #include <mbgl/style/filter.hpp>
 
 #include <string>
@@ -22,6 +23,12 @@ public:
     optional<std::vector<std::string>> layerIDs;
 
     optional<style::Filter> filter;
+
+    /** Property keys to include in the results; all properties are included when not set */
+    optional<std::vector<std::string>> properties;
+
+    /** Whether the results include the feature geometry */
+    bool geometry = true;
 };
 
 /**
@@ -38,6 +45,19 @@ public:
     optional<std::vector<std::string>> sourceLayers;
 
     optional<style::Filter> filter;
+
+    // Property keys to include in the results; all properties are included when not set
+    optional<std::vector<std::string>> properties;
+
+    // Whether the results include the feature geometry
+    bool geometry = true;
+
+    // Only returns features whose geometry intersects these bounds
+    optional<LatLngBounds> bounds;
+
+    // Returns each feature with an ID once, taken from the most detailed tile it's found in,
+    // instead of once per tile. Features without an ID are always returned.
+    bool deduplicate = false;
 };
 
 } // namespace mbgl
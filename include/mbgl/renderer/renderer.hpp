@@ -38,6 +38,14 @@ public:
     std::vector<Feature> queryRenderedFeatures(const ScreenLineString&, const RenderedQueryOptions& options = {}) const;
     std::vector<Feature> queryRenderedFeatures(const ScreenCoordinate& point, const RenderedQueryOptions& options = {}) const;
     std::vector<Feature> queryRenderedFeatures(const ScreenBox& box, const RenderedQueryOptions& options = {}) const;
+
+    // Asynchronous variants of the feature queries above. The features are read from the tiles on
+    // a background thread, and the callback is invoked on the calling thread once they're ready.
+    using QueryCallback = std::function<void (std::vector<Feature>)>;
+    void queryRenderedFeatures(const ScreenLineString&, const RenderedQueryOptions&, QueryCallback);
+    void queryRenderedFeatures(const ScreenCoordinate& point, const RenderedQueryOptions&, QueryCallback);
+    void queryRenderedFeatures(const ScreenBox& box, const RenderedQueryOptions&, QueryCallback);
+
     std::vector<Feature> querySourceFeatures(const std::string& sourceID, const SourceQueryOptions& options = {}) const;
     AnnotationIDs queryPointAnnotations(const ScreenBox& box) const;
     AnnotationIDs queryShapeAnnotations(const ScreenBox& box) const;
@@ -50,6 +58,28 @@ public:
                                                  const std::string& extensionField,
                                                  const optional<std::map<std::string, Value>>& args = {}) const;
 
+    // Feature state
+    //
+    // Paint properties using `feature-state` expressions are updated on the next frame, without
+    // laying out the affected tiles again. Numeric and string feature IDs are matched by their
+    // string form. The source layer ID is only needed for sources with several layers.
+    void setFeatureState(const std::string& sourceID,
+                         const optional<std::string>& sourceLayerID,
+                         const std::string& featureID,
+                         const FeatureState& state);
+
+    void getFeatureState(FeatureState& state,
+                         const std::string& sourceID,
+                         const optional<std::string>& sourceLayerID,
+                         const std::string& featureID) const;
+
+    // Removes a single key of the state of a feature, the whole state of a feature, or the state
+    // of all features in the source (layer).
+    void removeFeatureState(const std::string& sourceID,
+                            const optional<std::string>& sourceLayerID,
+                            const optional<std::string>& featureID,
+                            const optional<std::string>& stateKey);
+
     // Debug
     void dumpDebugLogs();
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <mbgl/renderer/rendering_stats.hpp>
+
 #include <cstdint>
 #include <exception>
 
@@ -29,6 +31,9 @@ public:
     // End of frame, boolean flags that a repaint is required
     virtual void onDidFinishRenderingFrame(RenderMode, bool) {}
 
+    // End of frame, CPU time spent in each render phase
+    virtual void onRenderingStats(const RenderingStats&) {}
+
     // Final frame
     virtual void onDidFinishRenderingMap() {}
 
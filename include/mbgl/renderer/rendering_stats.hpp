@@ -0,0 +1,58 @@
+#pragma once
+
+#include <mbgl/util/chrono.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace mbgl {
+
+/**
+ * CPU time and draw call count of a single style layer during a frame.
+ */
+class LayerRenderingStats {
+public:
+    std::string layerID;
+    Duration renderTime = Duration::zero();
+    std::size_t drawCalls = 0;
+};
+
+/**
+ * Per-frame profiling data collected by Renderer::render().
+ */
+class RenderingStats {
+public:
+    // Style diffing, layer evaluation and source/tile pyramid updates.
+    Duration updateTime = Duration::zero();
+    // Matrix computation and per-layer render tile selection.
+    Duration prepareTime = Duration::zero();
+    // Symbol placement and collision detection.
+    Duration placementTime = Duration::zero();
+    // Buffer, texture and atlas uploads.
+    Duration uploadTime = Duration::zero();
+    // Encoding of the 3D, opaque, translucent and debug passes.
+    Duration drawTime = Duration::zero();
+
+    Duration totalTime() const {
+        return updateTime + prepareTime + placementTime + uploadTime + drawTime;
+    }
+
+    std::size_t drawCalls = 0;
+    // Graphics state changes issued, and those skipped because the state was already current.
+    std::size_t stateChanges = 0;
+    std::size_t redundantStateChanges = 0;
+    std::size_t bufferUploadBytes = 0;
+    std::size_t textureUploadBytes = 0;
+
+    // Layers that were drawn in this frame, in style order.
+    std::vector<LayerRenderingStats> layers;
+
+    // Tile worker results received since the previous frame, and the CPU time the
+    // workers spent parsing features and laying out symbols for them.
+    std::size_t tileLayouts = 0;
+    Duration tileParseTime = Duration::zero();
+    Duration tileLayoutTime = Duration::zero();
+};
+
+} // namespace mbgl
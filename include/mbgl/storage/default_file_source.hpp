@@ -17,6 +17,7 @@ template <typename T> class Thread;
 } // namespace util
 
 class ResourceTransform;
+class ResourceMemoryCache;
 
 // TODO: the callback should include a potential error info when https://github.com/mapbox/mapbox-gl-native/issues/14759 is resolved
 using PathChangeCallback = std::function<void ()>;
@@ -127,6 +128,48 @@ public:
     void mergeOfflineRegions(const std::string& sideDatabasePath,
                             std::function<void (expected<OfflineRegions, std::exception_ptr>)>);
 
+    /*
+     * Import the tiles of an offline region from a local tile archive instead of
+     * downloading them. The archive is either an MBTiles file or a directory laid out
+     * as `<z>/<x>/<y>.<extension>`; gzipped tiles are decompressed before they are
+     * stored.
+     *
+     * Tiles are stored as if they had been requested from `urlTemplate`, which must
+     * be the tile URL template the region's style uses for the source. They are
+     * written in large transactions while compression runs on background threads,
+     * and progress is reported through the region's `OfflineRegionObserver`.
+     *
+     * When the import is completed or fails, the provided callback will be
+     * executed on the database thread; it is the responsibility of the SDK bindings
+     * to re-execute a user-provided callback on the main thread. Deleting the region
+     * cancels the import without invoking the callback.
+     */
+    void importOfflineRegionTiles(OfflineRegion&,
+                                  const std::string& archivePath,
+                                  const std::string& urlTemplate,
+                                  std::function<void (std::exception_ptr)>);
+
+    /*
+     * Update the tiles of an offline region to a new version of a tile set, given
+     * a manifest with the hash of each of its tiles. Only tiles that are missing or
+     * whose hash differs from the one stored are downloaded again; unchanged tiles
+     * aren't requested or rewritten. Until they are replaced, changed tiles are
+     * marked as expired and must be revalidated before use.
+     *
+     * `urlTemplate` must be the tile URL template the region's style uses for the
+     * source. Progress is reported through the region's `OfflineRegionObserver`.
+     *
+     * When the update is completed or fails, the provided callback will be executed
+     * on the database thread with the number and size of unchanged and updated
+     * tiles; it is the responsibility of the SDK bindings to re-execute a
+     * user-provided callback on the main thread. Deleting the region cancels the
+     * update without invoking the callback.
+     */
+    void updateOfflineRegionTiles(OfflineRegion&,
+                                  const std::string& urlTemplate,
+                                  OfflineTileManifest,
+                                  std::function<void (expected<OfflineRegionUpdateStats, std::exception_ptr>)>);
+
     /*
      * Remove an offline region from the database and perform any resources evictions
      * necessary as a result.
@@ -186,6 +229,37 @@ public:
      */
     void resetCache(std::function<void (std::exception_ptr)>);
 
+    /*
+     * Serve cache reads from the given number of additional read-only database
+     * connections, so that they don't wait for writes such as region downloads.
+     *
+     * Switches the database to write-ahead logging while enabled. Passing 0,
+     * the default, reads on the database thread. Has no effect on in-memory
+     * databases.
+     */
+    void setCacheReaderCount(std::size_t);
+
+    /*
+     * Set the byte budget of the in-memory cache of recently used resources,
+     * which is consulted before the database. Passing 0 disables it.
+     */
+    void setMemoryCacheSize(uint64_t);
+
+    class MemoryCacheStats {
+    public:
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t entries = 0;
+        uint64_t size = 0;
+    };
+
+    /*
+     * Cache lookups answered from and missed by the in-memory cache, and the
+     * number and total size of the responses it currently holds. Can be called
+     * from any thread.
+     */
+    MemoryCacheStats getMemoryCacheStats() const;
+
     // For testing only.
     void setOnlineStatus(bool);
 
@@ -194,6 +268,8 @@ public:
 private:
     // Shared so destruction is done on this thread
     const std::shared_ptr<FileSource> assetFileSource;
+    // Shared with the database thread, which fills it.
+    const std::shared_ptr<ResourceMemoryCache> memoryCache;
     const std::unique_ptr<util::Thread<Impl>> impl;
 
     std::mutex cachedBaseURLMutex;
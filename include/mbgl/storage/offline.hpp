@@ -157,6 +157,43 @@ public:
     }
 };
 
+/*
+ * An entry of the manifest of a new version of a tile set, used to update offline
+ * regions with only the tiles that changed. Coordinates follow the XYZ scheme, and
+ * the hash is the CRC-32 of the tile's data as served, after any content encoding
+ * such as gzip has been decoded.
+ */
+class OfflineTileHash {
+public:
+    uint8_t z;
+    uint32_t x;
+    uint32_t y;
+    uint32_t hash;
+};
+
+using OfflineTileManifest = std::vector<OfflineTileHash>;
+
+/*
+ * The outcome of updating an offline region from a manifest.
+ */
+class OfflineRegionUpdateStats {
+public:
+    /**
+     * The number of tiles of the manifest that were already stored with the same
+     * content, and their cumulative stored size in bytes, which didn't have to be
+     * downloaded again.
+     */
+    uint64_t unchangedTileCount = 0;
+    uint64_t savedBytes = 0;
+
+    /**
+     * The number of tiles that were missing or changed, and were downloaded, and
+     * their cumulative stored size in bytes.
+     */
+    uint64_t updatedTileCount = 0;
+    uint64_t updatedTileSize = 0;
+};
+
 /*
  * A region can have a single observer, which gets notified whenever a change
  * to the region's status occurs.
@@ -84,6 +84,10 @@ public:
     Kind kind;
     LoadingMethod loadingMethod;
     Priority priority;
+    // Orders requests of the same priority that wait for the network: lower ranks are fetched
+    // first. Tile requests are ranked by how soon the tile is needed in the current viewport, and
+    // are re-ranked as the camera moves.
+    uint32_t rank = 0;
     std::string url;
 
     // Includes auxiliary data if this is a tile request.
@@ -50,6 +50,8 @@ std::unique_ptr<Expression> toFormatted(std::unique_ptr<Expression>,
 std::unique_ptr<Expression> get(const char* value);
 std::unique_ptr<Expression> get(std::unique_ptr<Expression>);
 
+std::unique_ptr<Expression> featureState(const char* value);
+
 std::unique_ptr<Expression> id();
 std::unique_ptr<Expression> zoom();
 
@@ -29,6 +29,8 @@ bool isGlobalPropertyConstant(const Expression& expression, const T& properties)
 
 bool isFeatureConstant(const Expression& expression);
 bool isZoomConstant(const Expression& e);
+// Whether the expression doesn't depend on the state of the feature it's evaluated for.
+bool isStateConstant(const Expression& e);
 
 
 } // namespace expression
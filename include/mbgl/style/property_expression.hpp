@@ -16,6 +16,7 @@ public:
 
     bool isZoomConstant() const noexcept;
     bool isFeatureConstant() const noexcept;
+    bool isStateConstant() const noexcept;
     bool canEvaluateWith(const expression::EvaluationContext&) const noexcept;
     float interpolationFactor(const Range<float>&, const float) const noexcept;
     Range<float> getCoveringStops(const float, const float) const noexcept;
@@ -28,6 +29,7 @@ protected:
     variant<std::nullptr_t, const expression::Interpolate*, const expression::Step*> zoomCurve;
     bool isZoomConstant_;
     bool isFeatureConstant_;
+    bool isStateConstant_;
 };
 
 template <class T>
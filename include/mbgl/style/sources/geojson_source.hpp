@@ -8,9 +8,17 @@
 namespace mbgl {
 
 class AsyncRequest;
+class Mailbox;
+
+template <class>
+class Actor;
 
 namespace style {
 
+class GeoJSONData;
+class GeoJSONFeatureStore;
+class GeoJSONIndexBuilder;
+
 struct GeoJSONOptions {
     // GeoJSON-VT options
     uint8_t minzoom = 0;
@@ -32,8 +40,18 @@ public:
     ~GeoJSONSource() final;
 
     void setURL(const std::string& url);
+
+    // The index of the data is built on a background thread; the source keeps its previous
+    // data until the new index is ready.
     void setGeoJSON(const GeoJSON&);
 
+    // Adds the given features, replacing the features that have the same identifier. Only the
+    // tiles touched by the changed features get laid out again.
+    void updateFeatures(const FeatureCollection&);
+
+    // Removes the features that have one of the given identifiers.
+    void removeFeatures(const std::vector<FeatureIdentifier>&);
+
     optional<std::string> getURL() const;
 
     class Impl;
@@ -42,8 +60,28 @@ public:
     void loadDescription(FileSource&) final;
 
 private:
+    void buildIndex(const GeoJSON&);
+    void loadData(std::shared_ptr<const std::string>);
+    void changeFeatures(const FeatureCollection& changed, const std::vector<FeatureIdentifier>& removed);
+    // Returns false if the index needs to be built in place.
+    bool startBuild();
+
+    // Invoked by GeoJSONIndexBuilder
+    friend class GeoJSONIndexBuilder;
+    void onIndexBuilt(uint64_t buildID, std::unique_ptr<GeoJSONData>);
+
     optional<std::string> url;
     std::unique_ptr<AsyncRequest> req;
+
+    // Identifies the most recently requested index build; results of earlier builds are dropped.
+    uint64_t latestBuild = 0;
+    bool building = false;
+    bool loadingFromURL = false;
+
+    // Taken over by the index builder once it is started.
+    std::unique_ptr<GeoJSONFeatureStore> features;
+    std::shared_ptr<Mailbox> mailbox;
+    std::unique_ptr<Actor<GeoJSONIndexBuilder>> indexBuilder;
 };
 
 template <>
@@ -2,11 +2,17 @@
 
 #include <mbgl/util/noncopyable.hpp>
 
+#include <cstdint>
+
 namespace mbgl {
 
 class AsyncRequest : private util::noncopyable {
 public:
     virtual ~AsyncRequest() = default;
+
+    // Changes the rank of the requested resource while the request is outstanding; see
+    // Resource::rank. Requests that can't be reordered ignore this.
+    virtual void setRank(uint32_t) {}
 };
 
 } // namespace mbgl
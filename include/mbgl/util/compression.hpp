@@ -6,6 +6,7 @@ namespace mbgl {
 namespace util {
 
 std::string compress(const std::string& raw);
+// Accepts both zlib and gzip streams.
 std::string decompress(const std::string& raw);
 
 } // namespace util
@@ -1,9 +1,13 @@
 #pragma once
 
 #include <mbgl/util/optional.hpp>
+#include <mbgl/util/string.hpp>
 
 #include <mapbox/feature.hpp>
 
+#include <string>
+#include <unordered_map>
+
 namespace mbgl {
 
 using Value = mapbox::feature::value;
@@ -11,6 +15,9 @@ using NullValue = mapbox::feature::null_value_t;
 using PropertyMap = mapbox::feature::property_map;
 using FeatureIdentifier = mapbox::feature::identifier;
 using Feature = mapbox::feature::feature<double>;
+using FeatureState = PropertyMap;
+using FeatureStates = std::unordered_map<std::string, FeatureState>; // <featureID, FeatureState>
+using LayerFeatureStates = std::unordered_map<std::string, FeatureStates>; // <sourceLayer, FeatureStates>
 
 template <class T>
 optional<T> numericValue(const Value& value) {
@@ -29,4 +36,23 @@ optional<T> numericValue(const Value& value) {
         });
 }
 
+// Feature states are keyed by the string form of feature IDs, so that numeric IDs match no
+// matter which number type the source data uses for them.
+inline optional<std::string> featureIDtoString(const FeatureIdentifier& id) {
+    if (id.is<NullValue>()) {
+        return nullopt;
+    }
+
+    return id.match(
+        [] (const std::string& value) {
+            return value;
+        },
+        [] (const NullValue&) {
+            return std::string();
+        },
+        [] (const auto& value) {
+            return util::toString(value);
+        });
+}
+
 } // namespace mbgl
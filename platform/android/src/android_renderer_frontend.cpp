@@ -46,6 +46,10 @@ public:
         delegate.invoke(&RendererObserver::onDidFinishRenderingFrame, mode, repaintNeeded);
     }
 
+    void onRenderingStats(const RenderingStats& stats) override {
+        delegate.invoke(&RendererObserver::onRenderingStats, stats);
+    }
+
     void onDidFinishRenderingMap() override {
         delegate.invoke(&RendererObserver::onDidFinishRenderingMap);
     }
@@ -17,13 +17,17 @@ public:
     ~FileSourceRequest() final;
 
     void onCancel(std::function<void()>&& callback);
+    void onSetRank(std::function<void(uint32_t)>&& callback);
     void setResponse(const Response& res);
 
+    void setRank(uint32_t) final;
+
     ActorRef<FileSourceRequest> actor();
 
 private:
     FileSource::Callback responseCallback = nullptr;
     std::function<void()> cancelCallback = nullptr;
+    std::function<void(uint32_t)> setRankCallback = nullptr;
 
     std::shared_ptr<Mailbox> mailbox;
 };
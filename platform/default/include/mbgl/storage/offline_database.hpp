@@ -5,14 +5,18 @@
 #include <mbgl/util/exception.hpp>
 #include <mbgl/util/noncopyable.hpp>
 #include <mbgl/util/optional.hpp>
+#include <mbgl/util/chrono.hpp>
 #include <mbgl/util/constants.hpp>
 #include <mbgl/util/mapbox.hpp>
 #include <mbgl/util/expected.hpp>
 
 #include <unordered_map>
+#include <map>
 #include <memory>
 #include <string>
 #include <list>
+#include <tuple>
+#include <vector>
 
 namespace mapbox {
 namespace sqlite {
@@ -38,9 +42,18 @@ struct MapboxTileLimitExceededException :  util::Exception {
 
 class OfflineDatabase : private util::noncopyable {
 public:
+    enum class Mode : bool {
+        ReadWrite,
+        // Only opens an existing database and serves get() and hasRegionResource(). Used for
+        // additional connections that read concurrently while another one writes.
+        ReadOnly,
+    };
+
     // Limits affect ambient caching (put) only; resources required by offline
     // regions are exempt.
-    OfflineDatabase(std::string path, uint64_t maximumCacheSize = util::DEFAULT_MAX_CACHE_SIZE);
+    OfflineDatabase(std::string path,
+                    uint64_t maximumCacheSize = util::DEFAULT_MAX_CACHE_SIZE,
+                    Mode = Mode::ReadWrite);
     ~OfflineDatabase();
 
     void changePath(const std::string&);
@@ -51,6 +64,57 @@ public:
     // Return value is (inserted, stored size)
     std::pair<bool, uint64_t> put(const Resource&, const Response&);
 
+    // Cache hits update the accessed timestamp used for LRU eviction in memory only. The
+    // timestamps are written in a single transaction once enough of them accumulated, with the
+    // next put, or when calling this method.
+    void flushAccessedTimestamps();
+
+    // Accessed timestamps of cache hits that haven't been written to the database yet.
+    class PendingAccesses {
+    public:
+        using TileKey = std::tuple<std::string, uint8_t, int32_t, int32_t, int8_t>;
+
+        std::map<std::string, Timestamp> resources;
+        std::map<TileKey, Timestamp> tiles;
+        optional<Timestamp> since;
+    };
+
+    // Hands the accesses recorded by a read-only connection over to the one that writes them.
+    PendingAccesses takePendingAccesses();
+    void addPendingAccesses(PendingAccesses&&);
+
+    // Records an access to a resource that was served without reading it from this database,
+    // e.g. from memory.
+    void recordAccess(const Resource&);
+
+    // Write-ahead logging lets read-only connections read while this one writes. Commits are
+    // still synced to disk before they complete.
+    void setWriteAheadLogging(bool);
+
+    // Puts only evict ambient cache entries when the cache would otherwise exceed its maximum
+    // size. Once it grows past a high watermark, these passes are meant to be run while idle:
+    // evictToLowWatermark() evicts least recently used entries until the cache is below a low
+    // watermark, and reclaimFreePages() returns the pages freed by eviction to the file system.
+    // Both do a bounded amount of work and return true if they should be called again.
+    bool evictionNeeded() const {
+        return needsEviction;
+    }
+    bool evictToLowWatermark();
+    bool reclaimFreePages();
+
+    class EvictionStats {
+    public:
+        uint64_t evictedEntries = 0;
+        // Size of the database pages that were freed by eviction.
+        uint64_t evictedBytes = 0;
+        Duration evictionTime = Duration::zero();
+        uint64_t reclaimedBytes = 0;
+    };
+
+    const EvictionStats& getEvictionStats() const {
+        return evictionStats;
+    }
+
     // Force Mapbox GL Native to revalidate tiles stored in the ambient
     // cache with the tile server before using them, making sure they
     // are the latest version. This is more efficient than cleaning the
@@ -78,6 +142,41 @@ public:
     uint64_t putRegionResource(int64_t regionID, const Resource&, const Response&);
     void putRegionResources(int64_t regionID, const std::list<std::tuple<Resource, Response>>&, OfflineRegionStatus&);
 
+    // A region tile whose data was prepared for storage ahead of time, so that imports can
+    // compress tiles on other threads.
+    class PreparedTile {
+    public:
+        Resource resource;
+        std::string data;
+        bool compressed;
+        uint32_t hash;
+    };
+
+    // Stores a batch of tiles in one transaction, like putRegionResources(), which includes
+    // throwing MapboxTileLimitExceededException once the limit is reached. Database errors are
+    // returned rather than only logged, since imports can't request tiles again later.
+    std::exception_ptr putRegionTiles(int64_t regionID, const std::vector<PreparedTile>&, OfflineRegionStatus&);
+
+    // Tiles are stored along with a hash of their uncompressed data, which delta updates compare
+    // with the hashes of a manifest. It's the CRC-32 of the data.
+    static uint32_t tileHash(const std::string& data);
+
+    class RegionTileDelta {
+    public:
+        // Tiles of the manifest that aren't stored, or whose content changed.
+        std::vector<Resource> changedTiles;
+        uint64_t unchangedTileCount = 0;
+        uint64_t unchangedTileSize = 0;
+    };
+
+    // Compares the tiles stored for the given source with the manifest of a new version of it.
+    // Unchanged tiles are kept and added to the region; changed tiles are invalidated like
+    // invalidateRegion() does until they are replaced.
+    expected<RegionTileDelta, std::exception_ptr> diffRegionTiles(int64_t regionID,
+                                                                  const std::string& urlTemplate,
+                                                                  float pixelRatio,
+                                                                  const OfflineTileManifest&);
+
     expected<OfflineRegionDefinition, std::exception_ptr> getRegionDefinition(int64_t regionID);
     expected<OfflineRegionStatus, std::exception_ptr> getRegionCompletedStatus(int64_t regionID);
 
@@ -105,7 +204,8 @@ private:
     optional<std::pair<Response, uint64_t>> getTile(const Resource::TileData&);
     optional<int64_t> hasTile(const Resource::TileData&);
     bool putTile(const Resource::TileData&, const Response&,
-                 const std::string&, bool compressed);
+                 const std::string&, bool compressed, uint32_t hash);
+    void putTileHash(const Resource::TileData&, uint32_t hash);
 
     optional<std::pair<Response, uint64_t>> getResource(const Resource&);
     optional<int64_t> hasResource(const Resource&);
@@ -120,6 +220,7 @@ private:
 
     // Return value is true iff the resource was previously unused by any other regions.
     bool markUsed(int64_t regionID, const Resource&);
+    void markRegionResourceUsed(int64_t regionID, const Resource&);
 
     std::pair<int64_t, int64_t> getCompletedResourceCountAndSize(int64_t regionID);
     std::pair<int64_t, int64_t> getCompletedTileCountAndSize(int64_t regionID);
@@ -136,7 +237,18 @@ private:
     uint64_t offlineMapboxTileCountLimit = util::mapbox::DEFAULT_OFFLINE_TILE_COUNT_LIMIT;
     optional<uint64_t> offlineMapboxTileCount;
 
+    uint64_t getUsedSize();
     bool evict(uint64_t neededFreeSize);
+    bool evictLeastRecentlyUsed();
+    bool needsEviction = false;
+    EvictionStats evictionStats;
+
+    void updateAccessedTimestamps();
+    bool accessedTimestampsFlushDue() const;
+
+    PendingAccesses pendingAccesses;
+    const Mode mode;
+    bool writeAheadLogging = false;
 };
 
 } // namespace mbgl
@@ -12,6 +12,7 @@
 namespace mbgl {
 
 class OfflineDatabase;
+class ResourceMemoryCache;
 class FileSource;
 class AsyncRequest;
 class Response;
@@ -28,7 +29,10 @@ class Parser;
  */
 class OfflineDownload {
 public:
-    OfflineDownload(int64_t id, OfflineRegionDefinition&&, OfflineDatabase& offline, OnlineFileSource& online);
+    // Cached responses of the resources the download stores are dropped from the memory cache, if
+    // one is given, so that it doesn't keep serving older versions.
+    OfflineDownload(int64_t id, OfflineRegionDefinition&&, OfflineDatabase& offline, OnlineFileSource& online,
+                    std::shared_ptr<ResourceMemoryCache> memoryCache = {});
     ~OfflineDownload();
 
     void setObserver(std::unique_ptr<OfflineRegionObserver>);
@@ -36,6 +40,11 @@ public:
 
     OfflineRegionStatus getStatus() const;
 
+    // Imports report their progress through the observer of the region as well.
+    OfflineRegionObserver& getObserver() {
+        return *observer;
+    }
+
 private:
     void activateDownload();
     void continueDownload();
@@ -54,6 +63,7 @@ private:
     OfflineRegionDefinition definition;
     OfflineDatabase& offlineDatabase;
     OnlineFileSource& onlineFileSource;
+    std::shared_ptr<ResourceMemoryCache> memoryCache;
     OfflineRegionStatus status;
     std::unique_ptr<OfflineRegionObserver> observer;
 
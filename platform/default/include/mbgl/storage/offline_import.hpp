@@ -0,0 +1,84 @@
+#pragma once
+
+#include <mbgl/storage/offline.hpp>
+#include <mbgl/storage/offline_database.hpp>
+
+#include <exception>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace mbgl {
+
+class ArchiveTile;
+class Mailbox;
+class OfflineDownload;
+class TileArchive;
+class TileCompressor;
+
+template <class>
+class Actor;
+
+/**
+ * Imports the tiles of an offline region from a local tile archive, either an MBTiles file or
+ * a directory laid out as <z>/<x>/<y>.<extension>, without requesting them one by one. Tiles
+ * outside of the zoom range and bounds of the region definition are skipped; for geometry
+ * regions, the bounds are those of the geometry.
+
+ * Tiles are read and written in large batches, one transaction per batch, while compressing
+ * them is spread over the background thread pool. The next batch is compressed while the
+ * previous one is written. Lives on the database thread.
+
+ * @private
+ */
+class OfflineImport {
+public:
+    using Callback = std::function<void (std::exception_ptr)>;
+
+    // Tiles are stored as if they had been requested from the given URL template, which needs
+    // to be the one the style of the region uses for the source.
+    OfflineImport(int64_t regionID,
+                  const OfflineRegionDefinition&,
+                  std::string urlTemplate,
+                  std::string archivePath,
+                  OfflineDatabase&,
+                  OfflineDownload&,
+                  Callback);
+    ~OfflineImport();
+
+    // Invokes the callback once all tiles are stored, or as soon as the import fails.
+    void start();
+
+    // Receives the tiles of the current batch from the compressors.
+    void tilesCompressed(std::vector<OfflineDatabase::PreparedTile>);
+
+private:
+    bool contains(const ArchiveTile&) const;
+
+    // Returns false once the archive is exhausted.
+    bool compressNextBatch();
+    void finish(std::exception_ptr);
+
+    const int64_t regionID;
+    const float pixelRatio;
+    const double minZoom;
+    const double maxZoom;
+    const LatLngBounds bounds;
+    const std::string urlTemplate;
+    const std::string archivePath;
+    OfflineDatabase& offlineDatabase;
+    OfflineDownload& download;
+    Callback callback;
+
+    OfflineRegionStatus status;
+    std::unique_ptr<TileArchive> archive;
+    std::vector<OfflineDatabase::PreparedTile> batch;
+    std::size_t pendingChunks = 0;
+    bool finished = false;
+
+    std::shared_ptr<Mailbox> mailbox;
+    std::vector<std::unique_ptr<Actor<TileCompressor>>> compressors;
+};
+
+} // namespace mbgl
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <mbgl/storage/offline.hpp>
+#include <mbgl/storage/resource.hpp>
+#include <mbgl/util/expected.hpp>
+
+#include <deque>
+#include <exception>
+#include <functional>
+#include <list>
+#include <memory>
+#include <string>
+#include <tuple>
+
+namespace mbgl {
+
+class AsyncRequest;
+class OfflineDatabase;
+class OfflineDownload;
+class OnlineFileSource;
+
+/**
+ * Updates the tiles of an offline region to a new version of a tile set, described by a
+ * manifest of tile hashes. Only tiles whose hash differs from the stored one, or that aren't
+ * stored yet, are downloaded again; unchanged tiles are left untouched. Lives on the
+ * database thread.
+
+ * @private
+ */
+class OfflineRegionUpdate {
+public:
+    using Callback = std::function<void (expected<OfflineRegionUpdateStats, std::exception_ptr>)>;
+
+    OfflineRegionUpdate(int64_t regionID,
+                        float pixelRatio,
+                        std::string urlTemplate,
+                        OfflineTileManifest,
+                        OfflineDatabase&,
+                        OnlineFileSource&,
+                        OfflineDownload&,
+                        Callback);
+    ~OfflineRegionUpdate();
+
+    // Invokes the callback once all changed tiles are stored, or as soon as the update fails.
+    void start();
+
+private:
+    void continueUpdate();
+    void requestTile(const Resource&);
+    void finish(expected<OfflineRegionUpdateStats, std::exception_ptr>);
+
+    const int64_t regionID;
+    const float pixelRatio;
+    const std::string urlTemplate;
+    OfflineTileManifest manifest;
+    OfflineDatabase& offlineDatabase;
+    OnlineFileSource& onlineFileSource;
+    OfflineDownload& download;
+    Callback callback;
+
+    OfflineRegionStatus status;
+    OfflineRegionUpdateStats stats;
+    std::deque<Resource> tilesRemaining;
+    std::list<std::unique_ptr<AsyncRequest>> requests;
+    std::list<std::tuple<Resource, Response>> buffer;
+};
+
+} // namespace mbgl
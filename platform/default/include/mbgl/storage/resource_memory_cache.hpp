@@ -0,0 +1,80 @@
+#pragma once
+
+#include <mbgl/storage/resource.hpp>
+#include <mbgl/storage/response.hpp>
+#include <mbgl/util/noncopyable.hpp>
+#include <mbgl/util/optional.hpp>
+
+#include <array>
+#include <atomic>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace mbgl {
+
+// Keeps recently used cache responses in memory, with their data already decompressed, so that
+// resources requested again shortly after don't have to be read from the database. Entries are
+// spread over independently locked shards, each of which gets an equal part of the byte budget.
+class ResourceMemoryCache : private util::noncopyable {
+public:
+    class Stats {
+    public:
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t entries = 0;
+        uint64_t size = 0;
+    };
+
+    explicit ResourceMemoryCache(uint64_t maximumSize);
+
+    // Shrinking the budget evicts least recently used entries; 0 disables the cache.
+    void setMaximumSize(uint64_t);
+
+    optional<Response> get(const Resource&);
+
+    // Mirrors OfflineDatabase::put(): errors aren't stored, and "not modified" responses only
+    // refresh the expiration of an existing entry.
+    void put(const Resource&, const Response&);
+
+    // Whether the cached entry is this very response, e.g. because it was passed on to several
+    // requests that shared a transfer. Doesn't count as a lookup.
+    bool contains(const Resource&, const Response&) const;
+
+    void remove(const Resource&);
+    void clear();
+
+    Stats getStats() const;
+
+private:
+    static constexpr std::size_t shardCount = 8;
+
+    class Entry {
+    public:
+        std::string key;
+        Response response;
+        uint64_t size;
+    };
+
+    class Shard {
+    public:
+        mutable std::mutex mutex;
+        // Most recently used first.
+        std::list<Entry> entries;
+        std::unordered_map<std::string, std::list<Entry>::iterator> index;
+        uint64_t size = 0;
+    };
+
+    static std::string key(const Resource&);
+    Shard& shard(const std::string&);
+    const Shard& shard(const std::string&) const;
+    void evict(Shard&, uint64_t maximumShardSize);
+
+    std::array<Shard, shardCount> shards;
+    std::atomic<uint64_t> maximumShardSize;
+    std::atomic<uint64_t> hits { 0 };
+    std::atomic<uint64_t> misses { 0 };
+};
+
+} // namespace mbgl
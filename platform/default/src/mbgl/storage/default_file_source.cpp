@@ -2,28 +2,59 @@
 #include <mbgl/storage/asset_file_source.hpp>
 #include <mbgl/storage/file_source_request.hpp>
 #include <mbgl/storage/local_file_source.hpp>
+#include <mbgl/storage/mbtiles_file_source.hpp>
 #include <mbgl/storage/online_file_source.hpp>
 #include <mbgl/storage/offline_database.hpp>
 #include <mbgl/storage/offline_download.hpp>
+#include <mbgl/storage/offline_import.hpp>
+#include <mbgl/storage/offline_region_update.hpp>
+#include <mbgl/storage/resource_memory_cache.hpp>
 #include <mbgl/storage/resource_transform.hpp>
 
 #include <mbgl/util/platform.hpp>
 #include <mbgl/util/url.hpp>
 #include <mbgl/util/thread.hpp>
+#include <mbgl/util/timer.hpp>
+#include <mbgl/util/thread_pool.hpp>
+#include <mbgl/actor/actor.hpp>
 #include <mbgl/util/work_request.hpp>
 #include <mbgl/util/stopwatch.hpp>
 
 #include <cassert>
+#include <stdexcept>
 #include <utility>
 
 namespace mbgl {
 
+// A read-only connection to the cache database that serves cache reads on a thread pool, so that
+// they don't wait behind writes on the database thread.
+class CacheReader {
+public:
+    CacheReader(ActorRef<DefaultFileSource::Impl> fileSource_, const std::string& path)
+        : fileSource(std::move(fileSource_)),
+          database(path, util::DEFAULT_MAX_CACHE_SIZE, OfflineDatabase::Mode::ReadOnly) {
+    }
+
+    void get(AsyncRequest*, uint64_t readID, const Resource&);
+
+private:
+    ActorRef<DefaultFileSource::Impl> fileSource;
+    OfflineDatabase database;
+};
+
 class DefaultFileSource::Impl {
 public:
-    Impl(std::shared_ptr<FileSource> assetFileSource_, std::string cachePath, uint64_t maximumCacheSize)
+    Impl(ActorRef<Impl> self_,
+         std::shared_ptr<FileSource> assetFileSource_,
+         std::shared_ptr<ResourceMemoryCache> memoryCache_,
+         std::string cachePath_,
+         uint64_t maximumCacheSize)
             : assetFileSource(std::move(assetFileSource_))
             , localFileSource(std::make_unique<LocalFileSource>())
-            , offlineDatabase(std::make_unique<OfflineDatabase>(cachePath, maximumCacheSize)) {
+            , memoryCache(std::move(memoryCache_))
+            , offlineDatabase(std::make_unique<OfflineDatabase>(cachePath_, maximumCacheSize))
+            , self(std::move(self_))
+            , cachePath(std::move(cachePath_)) {
     }
 
     void setAPIBaseURL(const std::string& url) {
@@ -47,7 +78,11 @@ public:
     }
 
     void setResourceCachePath(const std::string& path, optional<ActorRef<PathChangeCallback>>&& callback) {
+        stopCacheReaders();
+        memoryCache->clear();
         offlineDatabase->changePath(path);
+        cachePath = path;
+        startCacheReaders();
         if (callback) {
             callback->invoke(&PathChangeCallback::operator());
         }
@@ -65,9 +100,86 @@ public:
 
     void mergeOfflineRegions(const std::string& sideDatabasePath,
                              std::function<void (expected<OfflineRegions, std::exception_ptr>)> callback) {
+        // Merged resources may be newer than the ones held in memory.
+        memoryCache->clear();
         callback(offlineDatabase->mergeDatabase(sideDatabasePath));
      }
 
+    void importRegionTiles(int64_t regionID,
+                           const OfflineRegionDefinition& definition,
+                           const std::string& archivePath,
+                           const std::string& urlTemplate,
+                           std::function<void (std::exception_ptr)> callback) {
+        if (imports.count(regionID)) {
+            callback(std::make_exception_ptr(std::runtime_error("Region is already being imported")));
+            return;
+        }
+
+        auto download = getDownload(regionID);
+        if (!download) {
+            callback(download.error());
+            return;
+        }
+
+        // Imported tiles may be newer than the ones held in memory.
+        memoryCache->clear();
+
+        auto import = std::make_unique<OfflineImport>(regionID, definition, urlTemplate, archivePath,
+                                                      *offlineDatabase, *download.value(),
+                                                      [this, regionID, callback] (std::exception_ptr error) {
+            // The import can't be destroyed while it reports its result.
+            self.invoke(&Impl::importRegionTilesCompleted, regionID, error, callback);
+        });
+        imports.emplace(regionID, std::move(import)).first->second->start();
+    }
+
+    void importRegionTilesCompleted(int64_t regionID,
+                                    std::exception_ptr error,
+                                    std::function<void (std::exception_ptr)> callback) {
+        // Deleting the region cancels the import, even if it has already completed.
+        if (imports.erase(regionID)) {
+            callback(error);
+        }
+    }
+
+    void updateRegionTiles(int64_t regionID,
+                           float pixelRatio,
+                           const std::string& urlTemplate,
+                           OfflineTileManifest manifest,
+                           std::function<void (expected<OfflineRegionUpdateStats, std::exception_ptr>)> callback) {
+        if (updates.count(regionID)) {
+            callback(unexpected<std::exception_ptr>(
+                std::make_exception_ptr(std::runtime_error("Region is already being updated"))));
+            return;
+        }
+
+        auto download = getDownload(regionID);
+        if (!download) {
+            callback(unexpected<std::exception_ptr>(download.error()));
+            return;
+        }
+
+        // Updated tiles may be newer than the ones held in memory.
+        memoryCache->clear();
+
+        auto update = std::make_unique<OfflineRegionUpdate>(regionID, pixelRatio, urlTemplate, std::move(manifest),
+                                                            *offlineDatabase, onlineFileSource, *download.value(),
+                                                            [this, regionID, callback] (expected<OfflineRegionUpdateStats, std::exception_ptr> result) {
+            // The update can't be destroyed while it reports its result.
+            self.invoke(&Impl::updateRegionTilesCompleted, regionID, std::move(result), callback);
+        });
+        updates.emplace(regionID, std::move(update)).first->second->start();
+    }
+
+    void updateRegionTilesCompleted(int64_t regionID,
+                                    expected<OfflineRegionUpdateStats, std::exception_ptr> result,
+                                    std::function<void (expected<OfflineRegionUpdateStats, std::exception_ptr>)> callback) {
+        // Deleting the region cancels the update, even if it has already completed.
+        if (updates.erase(regionID)) {
+            callback(std::move(result));
+        }
+    }
+
     void updateMetadata(const int64_t regionID,
                       const OfflineRegionMetadata& metadata,
                       std::function<void (expected<OfflineRegionMetadata, std::exception_ptr>)> callback) {
@@ -83,8 +195,13 @@ public:
     }
 
     void deleteRegion(OfflineRegion&& region, std::function<void (std::exception_ptr)> callback) {
+        imports.erase(region.getID());
+        updates.erase(region.getID());
         downloads.erase(region.getID());
-        callback(offlineDatabase->deleteRegion(std::move(region)));
+        std::exception_ptr error = offlineDatabase->deleteRegion(std::move(region));
+        // Resources of the region may have been evicted from the database.
+        memoryCache->clear();
+        callback(error);
     }
 
     void setRegionObserver(int64_t regionID, std::unique_ptr<OfflineRegionObserver> observer) {
@@ -110,62 +227,179 @@ public:
         } else if (LocalFileSource::acceptsURL(resource.url)) {
             //Local file request
             tasks[req] = localFileSource->request(resource, callback);
+        } else if (MBTilesFileSource::acceptsURL(resource.url)) {
+            // MBTiles request. The readers are only started once a tile set is used.
+            if (!mbtilesFileSource) {
+                mbtilesFileSource = std::make_unique<MBTilesFileSource>();
+            }
+            tasks[req] = mbtilesFileSource->request(resource, callback);
+        } else if (optional<Response> memoryResponse = resource.hasLoadingMethod(Resource::LoadingMethod::Cache)
+                       ? memoryCache->get(resource) : nullopt) {
+            // Recently used resources are served from memory. They still count as accessed for
+            // the LRU eviction of the database.
+            offlineDatabase->recordAccess(resource);
+            scheduleAccessedTimestampsFlush();
+            respond(req, std::move(resource), std::move(ref), std::move(memoryResponse));
+        } else if (resource.hasLoadingMethod(Resource::LoadingMethod::Cache) && !cacheReaders.empty()) {
+            // Read from the cache on the reader pool, and continue in cacheReadCompleted().
+            readFromCache(req, PendingRead{ 0, std::move(resource), std::move(ref) });
         } else {
             // Try the offline database
+            optional<Response> offlineResponse;
             if (resource.hasLoadingMethod(Resource::LoadingMethod::Cache)) {
-                auto offlineResponse = offlineDatabase->get(resource);
-
-                if (resource.loadingMethod == Resource::LoadingMethod::CacheOnly) {
-                    if (!offlineResponse) {
-                        // Ensure there's always a response that we can send, so the caller knows that
-                        // there's no optional data available in the cache, when it's the only place
-                        // we're supposed to load from.
-                        offlineResponse.emplace();
-                        offlineResponse->noContent = true;
-                        offlineResponse->error = std::make_unique<Response::Error>(
-                                Response::Error::Reason::NotFound, "Not found in offline database");
-                    } else if (!offlineResponse->isUsable()) {
-                        // Don't return resources the server requested not to show when they're stale.
-                        // Even if we can't directly use the response, we may still use it to send a
-                        // conditional HTTP request, which is why we're saving it above.
-                        offlineResponse->error = std::make_unique<Response::Error>(
-                            Response::Error::Reason::NotFound, "Cached resource is unusable");
-                    }
+                offlineResponse = offlineDatabase->get(resource);
+                scheduleAccessedTimestampsFlush();
+                if (offlineResponse) {
+                    memoryCache->put(resource, *offlineResponse);
+                }
+            }
+            respond(req, std::move(resource), std::move(ref), std::move(offlineResponse));
+        }
+    }
+
+    void cacheReadCompleted(AsyncRequest* req,
+                            uint64_t readID,
+                            optional<Response> offlineResponse,
+                            OfflineDatabase::PendingAccesses accesses) {
+        offlineDatabase->addPendingAccesses(std::move(accesses));
+        scheduleAccessedTimestampsFlush();
+
+        // The request may have been cancelled, or read again after the readers were restarted.
+        auto it = pendingReads.find(req);
+        if (it == pendingReads.end() || it->second.readID != readID) {
+            return;
+        }
+        PendingRead read = std::move(it->second);
+        pendingReads.erase(it);
+        if (offlineResponse) {
+            memoryCache->put(read.resource, *offlineResponse);
+        }
+        respond(req, std::move(read.resource), std::move(read.ref), std::move(offlineResponse));
+    }
+
+    void setCacheReaderCount(std::size_t count) {
+        stopCacheReaders();
+        readerPool.reset();
+        readerCount = cachePath == ":memory:" ? 0 : count;
+        offlineDatabase->setWriteAheadLogging(readerCount > 0);
+        startCacheReaders();
+    }
+
+    // Responds with the cached response, if any, and requests the resource from the network if
+    // that's allowed.
+    void respond(AsyncRequest* req, Resource resource, ActorRef<FileSourceRequest> ref, optional<Response> offlineResponse) {
+        auto callback = [ref] (const Response& res) {
+            ref.invoke(&FileSourceRequest::setResponse, res);
+        };
+
+        if (resource.hasLoadingMethod(Resource::LoadingMethod::Cache)) {
+            if (resource.loadingMethod == Resource::LoadingMethod::CacheOnly) {
+                if (!offlineResponse) {
+                    // Ensure there's always a response that we can send, so the caller knows that
+                    // there's no optional data available in the cache, when it's the only place
+                    // we're supposed to load from.
+                    offlineResponse.emplace();
+                    offlineResponse->noContent = true;
+                    offlineResponse->error = std::make_unique<Response::Error>(
+                            Response::Error::Reason::NotFound, "Not found in offline database");
+                } else if (!offlineResponse->isUsable()) {
+                    // Don't return resources the server requested not to show when they're stale.
+                    // Even if we can't directly use the response, we may still use it to send a
+                    // conditional HTTP request, which is why we're saving it above.
+                    offlineResponse->error = std::make_unique<Response::Error>(
+                        Response::Error::Reason::NotFound, "Cached resource is unusable");
+                }
+                callback(*offlineResponse);
+            } else if (offlineResponse) {
+                // Copy over the fields so that we can use them when making a refresh request.
+                resource.priorModified = offlineResponse->modified;
+                resource.priorExpires = offlineResponse->expires;
+                resource.priorEtag = offlineResponse->etag;
+                resource.priorData = offlineResponse->data;
+
+                if (offlineResponse->isUsable()) {
                     callback(*offlineResponse);
-                } else if (offlineResponse) {
-                    // Copy over the fields so that we can use them when making a refresh request.
-                    resource.priorModified = offlineResponse->modified;
-                    resource.priorExpires = offlineResponse->expires;
-                    resource.priorEtag = offlineResponse->etag;
-                    resource.priorData = offlineResponse->data;
-
-                    if (offlineResponse->isUsable()) {
-                        callback(*offlineResponse);
-                    }
                 }
             }
+        }
 
-            // Get from the online file source
-            if (resource.hasLoadingMethod(Resource::LoadingMethod::Network)) {
-                MBGL_TIMING_START(watch);
-                tasks[req] = onlineFileSource.request(resource, [=] (Response onlineResponse) {
+        // Get from the online file source
+        if (resource.hasLoadingMethod(Resource::LoadingMethod::Network)) {
+            MBGL_TIMING_START(watch);
+            tasks[req] = onlineFileSource.request(resource, [=] (Response onlineResponse) {
+                // Requests that shared a transfer receive the same response, which only needs to
+                // be stored once.
+                if (!this->memoryCache->contains(resource, onlineResponse)) {
                     this->offlineDatabase->put(resource, onlineResponse);
-                    if (resource.kind == Resource::Kind::Tile) {
-                        // onlineResponse.data will be null if data not modified
-                        MBGL_TIMING_FINISH(watch,
-                                           " Action: " << "Requesting," <<
-                                           " URL: " << resource.url.c_str() <<
-                                           " Size: " << (onlineResponse.data != nullptr ? onlineResponse.data->size() : 0) << "B," <<
-                                           " Time")
-                    }
-                    callback(onlineResponse);
-                });
-            }
+                    this->memoryCache->put(resource, onlineResponse);
+                    scheduleEviction();
+                }
+                if (resource.kind == Resource::Kind::Tile) {
+                    // onlineResponse.data will be null if data not modified
+                    MBGL_TIMING_FINISH(watch,
+                                       " Action: " << "Requesting," <<
+                                       " URL: " << resource.url.c_str() <<
+                                       " Size: " << (onlineResponse.data != nullptr ? onlineResponse.data->size() : 0) << "B," <<
+                                       " Time")
+                }
+                callback(onlineResponse);
+            });
+        }
+    }
+
+    // Write the accessed timestamps of cache hits once reads settle down.
+    void scheduleAccessedTimestampsFlush() {
+        accessedTimestampsTimer.start(Seconds(10), Duration::zero(), [this] {
+            offlineDatabase->flushAccessedTimestamps();
+        });
+    }
+
+    // Evict cache entries once writes settle down, and return the freed pages to the file system
+    // some time later. Both are done in small steps so that requests can be served in between.
+    void scheduleEviction() {
+        if (!offlineDatabase->evictionNeeded()) {
+            return;
+        }
+        evictionTimer.start(Seconds(1), Duration::zero(), [this] {
+            continueEviction();
+        });
+    }
+
+    void continueEviction() {
+        if (offlineDatabase->evictToLowWatermark()) {
+            evictionTimer.start(Duration::zero(), Duration::zero(), [this] {
+                continueEviction();
+            });
+        } else {
+            reclaimTimer.start(Seconds(30), Duration::zero(), [this] {
+                continueReclaiming();
+            });
+        }
+    }
+
+    void continueReclaiming() {
+        if (offlineDatabase->reclaimFreePages()) {
+            reclaimTimer.start(Duration::zero(), Duration::zero(), [this] {
+                continueReclaiming();
+            });
         }
     }
 
     void cancel(AsyncRequest* req) {
         tasks.erase(req);
+        pendingReads.erase(req);
+    }
+
+    void setRank(AsyncRequest* req, uint32_t rank) {
+        auto task = tasks.find(req);
+        if (task != tasks.end()) {
+            task->second->setRank(rank);
+        }
+        // Reads from the cache continue with a network request, if needed.
+        auto read = pendingReads.find(req);
+        if (read != pendingReads.end()) {
+            read->second.resource.rank = rank;
+        }
     }
 
     void setOfflineMapboxTileCountLimit(uint64_t limit) {
@@ -178,13 +412,66 @@ public:
 
     void put(const Resource& resource, const Response& response) {
         offlineDatabase->put(resource, response);
+        memoryCache->put(resource, response);
+        scheduleEviction();
     }
 
     void resetCache(std::function<void (std::exception_ptr)> callback) {
-        callback(offlineDatabase->resetCache());
+        stopCacheReaders();
+        memoryCache->clear();
+        auto result = offlineDatabase->resetCache();
+        startCacheReaders();
+        callback(result);
     }
 
 private:
+    class PendingRead {
+    public:
+        uint64_t readID;
+        Resource resource;
+        ActorRef<FileSourceRequest> ref;
+    };
+
+    void readFromCache(AsyncRequest* req, PendingRead read) {
+        read.readID = ++lastReadID;
+        auto& reader = *cacheReaders[read.readID % cacheReaders.size()];
+        reader.self().invoke(&CacheReader::get, req, read.readID, read.resource);
+        pendingReads.erase(req);
+        pendingReads.emplace(req, std::move(read));
+    }
+
+    // Reader connections must be closed while the database file is replaced. Reads that are in
+    // flight are issued again once they're reopened.
+    void stopCacheReaders() {
+        cacheReaders.clear();
+    }
+
+    void startCacheReaders() {
+        if (readerCount > 0) {
+            if (!readerPool) {
+                readerPool = std::make_unique<ThreadPool>(readerCount);
+            }
+            for (std::size_t i = 0; i < readerCount; ++i) {
+                cacheReaders.push_back(std::make_unique<Actor<CacheReader>>(*readerPool, self, cachePath));
+            }
+        }
+
+        auto reads = std::move(pendingReads);
+        pendingReads.clear();
+        for (auto& read : reads) {
+            if (cacheReaders.empty()) {
+                auto offlineResponse = offlineDatabase->get(read.second.resource);
+                scheduleAccessedTimestampsFlush();
+                if (offlineResponse) {
+                    memoryCache->put(read.second.resource, *offlineResponse);
+                }
+                respond(read.first, std::move(read.second.resource), std::move(read.second.ref), std::move(offlineResponse));
+            } else {
+                readFromCache(read.first, std::move(read.second));
+            }
+        }
+    }
+
     expected<OfflineDownload*, std::exception_ptr> getDownload(int64_t regionID) {
         auto it = downloads.find(regionID);
         if (it != downloads.end()) {
@@ -195,19 +482,40 @@ private:
             return unexpected<std::exception_ptr>(definition.error());
         }
         auto download = std::make_unique<OfflineDownload>(regionID, std::move(definition.value()),
-                                                          *offlineDatabase, onlineFileSource);
+                                                          *offlineDatabase, onlineFileSource, memoryCache);
         return downloads.emplace(regionID, std::move(download)).first->second.get();
     }
 
     // shared so that destruction is done on the creating thread
     const std::shared_ptr<FileSource> assetFileSource;
     const std::unique_ptr<FileSource> localFileSource;
+    std::unique_ptr<FileSource> mbtilesFileSource;
+    const std::shared_ptr<ResourceMemoryCache> memoryCache;
     std::unique_ptr<OfflineDatabase> offlineDatabase;
     OnlineFileSource onlineFileSource;
     std::unordered_map<AsyncRequest*, std::unique_ptr<AsyncRequest>> tasks;
     std::unordered_map<int64_t, std::unique_ptr<OfflineDownload>> downloads;
+    std::unordered_map<int64_t, std::unique_ptr<OfflineImport>> imports;
+    std::unordered_map<int64_t, std::unique_ptr<OfflineRegionUpdate>> updates;
+    util::Timer accessedTimestampsTimer;
+    util::Timer evictionTimer;
+    util::Timer reclaimTimer;
+
+    const ActorRef<Impl> self;
+    std::string cachePath;
+    std::size_t readerCount = 0;
+    std::unique_ptr<ThreadPool> readerPool;
+    std::vector<std::unique_ptr<Actor<CacheReader>>> cacheReaders;
+    std::unordered_map<AsyncRequest*, PendingRead> pendingReads;
+    uint64_t lastReadID = 0;
 };
 
+void CacheReader::get(AsyncRequest* req, uint64_t readID, const Resource& resource) {
+    auto response = database.get(resource);
+    fileSource.invoke(&DefaultFileSource::Impl::cacheReadCompleted, req, readID, std::move(response),
+                      database.takePendingAccesses());
+}
+
 DefaultFileSource::DefaultFileSource(const std::string& cachePath,
                                      const std::string& assetPath,
                                      uint64_t maximumCacheSize)
@@ -218,7 +526,8 @@ DefaultFileSource::DefaultFileSource(const std::string& cachePath,
                                      std::unique_ptr<FileSource>&& assetFileSource_,
                                      uint64_t maximumCacheSize)
         : assetFileSource(std::move(assetFileSource_))
-        , impl(std::make_unique<util::Thread<Impl>>("DefaultFileSource", assetFileSource, cachePath, maximumCacheSize)) {
+        , memoryCache(std::make_shared<ResourceMemoryCache>(util::DEFAULT_MAX_MEMORY_CACHE_SIZE))
+        , impl(std::make_unique<util::Thread<Impl>>("DefaultFileSource", assetFileSource, memoryCache, cachePath, maximumCacheSize)) {
 }
 
 DefaultFileSource::~DefaultFileSource() = default;
@@ -263,6 +572,7 @@ std::unique_ptr<AsyncRequest> DefaultFileSource::request(const Resource& resourc
     auto req = std::make_unique<FileSourceRequest>(std::move(callback));
 
     req->onCancel([fs = impl->actor(), req = req.get()] () { fs.invoke(&Impl::cancel, req); });
+    req->onSetRank([fs = impl->actor(), req = req.get()] (uint32_t rank) { fs.invoke(&Impl::setRank, req, rank); });
 
     impl->actor().invoke(&Impl::request, req.get(), resource, req->actor());
 
@@ -284,6 +594,21 @@ void DefaultFileSource::mergeOfflineRegions(const std::string& sideDatabasePath,
     impl->actor().invoke(&Impl::mergeOfflineRegions, sideDatabasePath, callback);
 }
 
+void DefaultFileSource::importOfflineRegionTiles(OfflineRegion& region,
+                                                 const std::string& archivePath,
+                                                 const std::string& urlTemplate,
+                                                 std::function<void (std::exception_ptr)> callback) {
+    impl->actor().invoke(&Impl::importRegionTiles, region.getID(), region.getDefinition(), archivePath, urlTemplate, callback);
+}
+
+void DefaultFileSource::updateOfflineRegionTiles(OfflineRegion& region,
+                                                 const std::string& urlTemplate,
+                                                 OfflineTileManifest manifest,
+                                                 std::function<void (expected<OfflineRegionUpdateStats, std::exception_ptr>)> callback) {
+    const float pixelRatio = region.getDefinition().match([](auto& definition) { return definition.pixelRatio; });
+    impl->actor().invoke(&Impl::updateRegionTiles, region.getID(), pixelRatio, urlTemplate, std::move(manifest), callback);
+}
+
 void DefaultFileSource::updateOfflineMetadata(const int64_t regionID,
                                             const OfflineRegionMetadata& metadata,
                                             std::function<void (expected<OfflineRegionMetadata,
@@ -327,6 +652,24 @@ void DefaultFileSource::resetCache(std::function<void (std::exception_ptr)> call
     impl->actor().invoke(&Impl::resetCache, callback);
 }
 
+void DefaultFileSource::setCacheReaderCount(std::size_t count) {
+    impl->actor().invoke(&Impl::setCacheReaderCount, count);
+}
+
+void DefaultFileSource::setMemoryCacheSize(uint64_t size) {
+    memoryCache->setMaximumSize(size);
+}
+
+DefaultFileSource::MemoryCacheStats DefaultFileSource::getMemoryCacheStats() const {
+    const auto stats = memoryCache->getStats();
+    MemoryCacheStats result;
+    result.hits = stats.hits;
+    result.misses = stats.misses;
+    result.entries = stats.entries;
+    result.size = stats.size;
+    return result;
+}
+
 // For testing only:
 
 void DefaultFileSource::setOnlineStatus(const bool status) {
@@ -22,6 +22,16 @@ void FileSourceRequest::onCancel(std::function<void()>&& callback) {
     cancelCallback = std::move(callback);
 }
 
+void FileSourceRequest::onSetRank(std::function<void(uint32_t)>&& callback) {
+    setRankCallback = std::move(callback);
+}
+
+void FileSourceRequest::setRank(uint32_t rank) {
+    if (setRankCallback) {
+        setRankCallback(rank);
+    }
+}
+
 void FileSourceRequest::setResponse(const Response& response) {
     // Copy, because calling the callback will sometimes self
     // destroy this object. We cannot move because this method
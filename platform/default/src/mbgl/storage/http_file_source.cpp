@@ -47,9 +47,11 @@ namespace curl {
     X(multi_socket_action) \
     X(multi_setopt) \
     X(share_init) \
+    X(share_setopt) \
     X(share_cleanup) \
     X(slist_append) \
-    X(slist_free_all)
+    X(slist_free_all) \
+    X(version_info)
 
 #define X(name) static decltype(&curl_ ## name) name = nullptr;
 CURL_FUNCTIONS
@@ -139,6 +141,9 @@ public:
     // A queue that we use for storing resuable CURL easy handles to avoid creating and destroying
     // them all the time.
     std::queue<CURL *> handles;
+
+    // Whether the loaded library supports HTTP/2.
+    bool http2 = false;
 };
 
 class HTTPRequest : public AsyncRequest {
@@ -174,13 +179,32 @@ HTTPFileSource::Impl::Impl() {
         throw std::runtime_error("Could not init cURL");
     }
 
+    // The features of the library that's loaded at runtime may differ from the headers, so options
+    // that it may not support are set without treating failures as errors.
+#ifdef CURL_VERSION_HTTP2
+    const curl_version_info_data* version = curl::version_info(CURLVERSION_NOW);
+    http2 = (version->features & CURL_VERSION_HTTP2) != 0;
+#endif
+
+    // Share DNS lookups and TLS sessions between requests.
     share = curl::share_init();
+    curl::share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+    curl::share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
 
     multi = curl::multi_init();
     handleError(curl::multi_setopt(multi, CURLMOPT_SOCKETFUNCTION, handleSocket));
     handleError(curl::multi_setopt(multi, CURLMOPT_SOCKETDATA, this));
     handleError(curl::multi_setopt(multi, CURLMOPT_TIMERFUNCTION, startTimeout));
     handleError(curl::multi_setopt(multi, CURLMOPT_TIMERDATA, this));
+
+#if LIBCURL_VERSION_NUM >= ((7) << 16 | (43) << 8 | 0)
+    if (http2) {
+        // Send concurrent requests to the same host as streams over a single HTTP/2 connection.
+        // The number of requests in flight is limited by OnlineFileSource, so this turns what
+        // would be that many connections into one.
+        curl::multi_setopt(multi, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+    }
+#endif
 }
 
 HTTPFileSource::Impl::~Impl() {
@@ -332,14 +356,25 @@ HTTPRequest::HTTPRequest(HTTPFileSource::Impl* context_, Resource resource_, Fil
     handleError(curl::easy_setopt(handle, CURLOPT_WRITEDATA, this));
     handleError(curl::easy_setopt(handle, CURLOPT_HEADERFUNCTION, headerCallback));
     handleError(curl::easy_setopt(handle, CURLOPT_HEADERDATA, this));
+    // An empty string accepts all encodings the library can decode, e.g. gzip, deflate and br.
+    // Responses are decoded transparently.
 #if LIBCURL_VERSION_NUM >= ((7) << 16 | (21) << 8 | 6) // Renamed in 7.21.6
-    handleError(curl::easy_setopt(handle, CURLOPT_ACCEPT_ENCODING, "gzip, deflate"));
+    handleError(curl::easy_setopt(handle, CURLOPT_ACCEPT_ENCODING, ""));
 #else
-    handleError(curl::easy_setopt(handle, CURLOPT_ENCODING, "gzip, deflate"));
+    handleError(curl::easy_setopt(handle, CURLOPT_ENCODING, ""));
 #endif
     handleError(curl::easy_setopt(handle, CURLOPT_USERAGENT, "MapboxGL/1.0"));
     handleError(curl::easy_setopt(handle, CURLOPT_SHARE, context->share));
 
+#if LIBCURL_VERSION_NUM >= ((7) << 16 | (47) << 8 | 0)
+    if (context->http2) {
+        // Negotiate HTTP/2 for HTTPS URLs, and wait for a connection that's being established to
+        // the same host to multiplex on it, rather than opening another one.
+        curl::easy_setopt(handle, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2TLS);
+        curl::easy_setopt(handle, CURLOPT_PIPEWAIT, 1L);
+    }
+#endif
+
     // Start requesting the information.
     handleError(curl::multi_add_handle(context->multi, handle));
 }
@@ -0,0 +1,285 @@
+#include <mbgl/storage/mbtiles_file_source.hpp>
+#include <mbgl/storage/file_source_request.hpp>
+#include <mbgl/storage/response.hpp>
+#include <mbgl/storage/sqlite3.hpp>
+#include <mbgl/actor/actor.hpp>
+#include <mbgl/util/compression.hpp>
+#include <mbgl/util/logging.hpp>
+#include <mbgl/util/optional.hpp>
+#include <mbgl/util/rapidjson.hpp>
+#include <mbgl/util/string.hpp>
+#include <mbgl/util/thread_pool.hpp>
+#include <mbgl/util/url.hpp>
+
+#include <rapidjson/writer.h>
+#include <rapidjson/stringbuffer.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+const std::string mbtilesProtocol = "mbtiles://";
+
+// Tile sets are mostly read at random, so each reader has its own connection to every file.
+constexpr std::size_t readerCount = 4;
+
+// Lets SQLite read pages straight from a memory mapping of the file instead of copying them into
+// its page cache.
+constexpr uint64_t mmapSize = 256 * 1024 * 1024;
+
+struct TileAddress {
+    std::string path;
+    uint8_t z;
+    uint32_t x;
+    uint32_t y;
+};
+
+bool parseNumber(const std::string& str, uint32_t& value) {
+    if (str.empty() || str.size() > 10 || str.find_first_not_of("0123456789") != std::string::npos) {
+        return false;
+    }
+    const unsigned long number = std::strtoul(str.c_str(), nullptr, 10);
+    if (number > std::numeric_limits<uint32_t>::max()) {
+        return false;
+    }
+    value = static_cast<uint32_t>(number);
+    return true;
+}
+
+// Splits "<file>/<z>/<x>/<y>" into the file and the tile coordinates.
+mbgl::optional<TileAddress> parseTilePath(const std::string& path) {
+    std::size_t end = path.size();
+    uint32_t coordinates[3];
+    for (int i = 2; i >= 0; --i) {
+        const std::size_t slash = end == 0 ? std::string::npos : path.rfind('/', end - 1);
+        if (slash == std::string::npos || !parseNumber(path.substr(slash + 1, end - slash - 1), coordinates[i])) {
+            return {};
+        }
+        end = slash;
+    }
+
+    const uint32_t z = coordinates[0];
+    if (end == 0 || z > 30 || coordinates[1] >= (1u << z) || coordinates[2] >= (1u << z)) {
+        return {};
+    }
+
+    return TileAddress { path.substr(0, end), static_cast<uint8_t>(z), coordinates[1], coordinates[2] };
+}
+
+std::vector<double> parseNumbers(const std::string& list) {
+    std::vector<double> numbers;
+    std::size_t start = 0;
+    while (start <= list.size()) {
+        std::size_t end = list.find(',', start);
+        if (end == std::string::npos) {
+            end = list.size();
+        }
+        char* parsed = nullptr;
+        const std::string item = list.substr(start, end - start);
+        const double number = std::strtod(item.c_str(), &parsed);
+        if (item.empty() || parsed == item.c_str()) {
+            return {};
+        }
+        numbers.push_back(number);
+        start = end + 1;
+    }
+    return numbers;
+}
+
+} // namespace
+
+namespace mbgl {
+
+using namespace mapbox::sqlite;
+
+// Answers requests from its own read-only connections, opened on first use of each file.
+class MBTilesReader {
+public:
+    void request(const std::string& url, ActorRef<FileSourceRequest> req) {
+        Response response;
+
+        try {
+            // Cut off the protocol; what remains is the file, optionally followed by tile coordinates.
+            const std::string path = util::percentDecode(url.substr(mbtilesProtocol.size()));
+            if (auto tile = parseTilePath(path)) {
+                response = readTile(getFile(tile->path), *tile);
+            } else {
+                response = readTileJSON(getFile(path), url);
+            }
+        } catch (const Exception& ex) {
+            const auto reason = ex.code == ResultCode::CantOpen ? Response::Error::Reason::NotFound
+                                                                : Response::Error::Reason::Other;
+            response.error = std::make_unique<Response::Error>(reason, ex.what());
+        } catch (const std::runtime_error& ex) {
+            response.error = std::make_unique<Response::Error>(Response::Error::Reason::Other, ex.what());
+        }
+
+        req.invoke(&FileSourceRequest::setResponse, response);
+    }
+
+private:
+    struct File {
+        File(const std::string& path)
+            : db(Database::open(path, ReadOnly)) {
+            db.exec("PRAGMA mmap_size = " + util::toString(mmapSize));
+            tileStatement = std::make_unique<Statement>(
+                db, "SELECT tile_data FROM tiles WHERE zoom_level = ?1 AND tile_column = ?2 AND tile_row = ?3");
+        }
+
+        Database db;
+        std::unique_ptr<Statement> tileStatement;
+    };
+
+    File& getFile(const std::string& path) {
+        auto it = files.find(path);
+        if (it == files.end()) {
+            it = files.emplace(path, std::make_unique<File>(path)).first;
+        }
+        return *it->second;
+    }
+
+    Response readTile(File& file, const TileAddress& tile) {
+        Response response;
+
+        Query query { *file.tileStatement };
+        query.bind(1, tile.z);
+        query.bind(2, static_cast<int64_t>(tile.x));
+        // MBTiles rows count from the bottom.
+        query.bind(3, static_cast<int64_t>((1u << tile.z) - 1 - tile.y));
+
+        if (!query.run()) {
+            response.noContent = true;
+            return response;
+        }
+
+        auto data = query.get<std::string>(0);
+        // Vector tiles are usually stored gzipped.
+        if (data.size() >= 2 && uint8_t(data[0]) == 0x1F && uint8_t(data[1]) == 0x8B) {
+            data = util::decompress(data);
+        }
+        response.data = std::make_shared<std::string>(std::move(data));
+        return response;
+    }
+
+    Response readTileJSON(File& file, const std::string& url) {
+        std::unordered_map<std::string, std::string> metadata;
+        {
+            Statement stmt { file.db, "SELECT name, value FROM metadata" };
+            Query query { stmt };
+            while (query.run()) {
+                metadata.emplace(query.get<std::string>(0), query.get<std::string>(1));
+            }
+        }
+
+        rapidjson::StringBuffer s;
+        rapidjson::Writer<rapidjson::StringBuffer> writer(s);
+
+        writer.StartObject();
+        writer.Key("tilejson");
+        writer.String("2.2.0");
+        writer.Key("scheme");
+        writer.String("xyz");
+        writer.Key("tiles");
+        writer.StartArray();
+        writer.String(url + "/{z}/{x}/{y}");
+        writer.EndArray();
+
+        for (const char* key : { "name", "description", "attribution", "version" }) {
+            auto it = metadata.find(key);
+            if (it != metadata.end()) {
+                writer.Key(key);
+                writer.String(it->second);
+            }
+        }
+
+        for (const char* key : { "minzoom", "maxzoom" }) {
+            auto it = metadata.find(key);
+            uint32_t zoom;
+            if (it != metadata.end() && parseNumber(it->second, zoom)) {
+                writer.Key(key);
+                writer.Uint(zoom);
+            }
+        }
+
+        auto writeNumbers = [&](const char* key, std::size_t count) {
+            auto it = metadata.find(key);
+            if (it != metadata.end()) {
+                const auto numbers = parseNumbers(it->second);
+                if (numbers.size() == count) {
+                    writer.Key(key);
+                    writer.StartArray();
+                    for (double number : numbers) {
+                        writer.Double(number);
+                    }
+                    writer.EndArray();
+                }
+            }
+        };
+        writeNumbers("bounds", 4);
+        writeNumbers("center", 3);
+
+        // Vector tile sets describe their layers in a JSON document stored as "json".
+        auto json = metadata.find("json");
+        if (json != metadata.end()) {
+            JSDocument document;
+            document.Parse<0>(json->second.c_str());
+            if (document.HasParseError()) {
+                Log::Warning(Event::General, "Invalid json metadata in MBTiles file: %s",
+                             formatJSONParseError(document).c_str());
+            } else if (document.IsObject() && document.HasMember("vector_layers")) {
+                writer.Key("vector_layers");
+                document["vector_layers"].Accept(writer);
+            }
+        }
+
+        writer.EndObject();
+
+        Response response;
+        response.data = std::make_shared<std::string>(s.GetString(), s.GetSize());
+        return response;
+    }
+
+    std::unordered_map<std::string, std::unique_ptr<File>> files;
+};
+
+class MBTilesFileSource::Impl {
+public:
+    Impl() : pool(readerCount) {
+        for (std::size_t i = 0; i < readerCount; ++i) {
+            readers.push_back(std::make_unique<Actor<MBTilesReader>>(pool));
+        }
+    }
+
+    void request(const std::string& url, ActorRef<FileSourceRequest> req) {
+        readers[nextReader++ % readers.size()]->self().invoke(&MBTilesReader::request, url, std::move(req));
+    }
+
+private:
+    ThreadPool pool;
+    std::vector<std::unique_ptr<Actor<MBTilesReader>>> readers;
+    std::atomic<std::size_t> nextReader { 0 };
+};
+
+MBTilesFileSource::MBTilesFileSource()
+    : impl(std::make_unique<Impl>()) {
+}
+
+MBTilesFileSource::~MBTilesFileSource() = default;
+
+std::unique_ptr<AsyncRequest> MBTilesFileSource::request(const Resource& resource, Callback callback) {
+    auto req = std::make_unique<FileSourceRequest>(std::move(callback));
+
+    impl->request(resource.url, req->actor());
+
+    return std::move(req);
+}
+
+bool MBTilesFileSource::acceptsURL(const std::string& url) {
+    return 0 == url.rfind(mbtilesProtocol, 0);
+}
+
+} // namespace mbgl
@@ -10,12 +10,41 @@
 #include <mbgl/storage/offline_schema.hpp>
 #include <mbgl/storage/merge_sideloaded.hpp>
 
+#if defined(__QT__) && defined(_WIN32) && !defined(__GNUC__)
+#include <QtZlib/zlib.h>
+#else
+#include <zlib.h>
+#endif
+
+#include <algorithm>
+
 
 namespace mbgl {
 
-OfflineDatabase::OfflineDatabase(std::string path_, uint64_t maximumCacheSize_)
+namespace {
+
+// Hits on entries whose accessed timestamp is more recent than this don't need to be recorded,
+// which makes repeated reads of the same resources free. This is plenty for LRU eviction.
+constexpr const Seconds accessedTimestampGranularity { 60 };
+
+// Recorded accesses are written once there are this many of them, or once the oldest one is
+// older than the flush interval.
+constexpr const std::size_t maximumPendingAccesses = 256;
+constexpr const Seconds accessedTimestampFlushInterval { 10 };
+
+// Once the ambient cache grows past the high watermark, evictToLowWatermark() shrinks it below the
+// low watermark, so that puts rarely need to evict entries themselves.
+constexpr const double evictionHighWatermark = 0.9;
+constexpr const double evictionLowWatermark = 0.8;
+constexpr const std::size_t maximumEvictionStepsPerPass = 10;
+constexpr const uint64_t maximumReclaimedPagesPerPass = 256;
+
+} // namespace
+
+OfflineDatabase::OfflineDatabase(std::string path_, uint64_t maximumCacheSize_, Mode mode_)
     : path(std::move(path_)),
-      maximumCacheSize(maximumCacheSize_) {
+      maximumCacheSize(maximumCacheSize_),
+      mode(mode_) {
     try {
         initialize();
     } catch (const util::IOException& ex) {
@@ -34,6 +63,13 @@ void OfflineDatabase::initialize() {
     assert(!db);
     assert(statements.empty());
 
+    if (mode == Mode::ReadOnly) {
+        db = std::make_unique<mapbox::sqlite::Database>(
+            mapbox::sqlite::Database::open(path, mapbox::sqlite::ReadOnly));
+        db->setBusyTimeout(Milliseconds::max());
+        return;
+    }
+
     db = std::make_unique<mapbox::sqlite::Database>(
         mapbox::sqlite::Database::open(path, mapbox::sqlite::ReadWriteCreate));
     db->setBusyTimeout(Milliseconds::max());
@@ -46,7 +82,7 @@ void OfflineDatabase::initialize() {
         // Newly created database, or old cache-only database; remove old table if it exists.
         removeOldCacheTable();
         createSchema();
-        return;
+        break;
     case 2:
         migrateToVersion3();
         // fall through
@@ -61,12 +97,40 @@ void OfflineDatabase::initialize() {
         // fall through
     case 6:
         // Happy path; we're done
-        return;
+        break;
     default:
         // Downgrade: delete the database and try to reinitialize.
         removeExisting();
         initialize();
+        return;
+    }
+
+    // Tile hashes are kept in their own table rather than in the versioned schema, so that
+    // databases can still be merged with sideloaded ones at the same version.
+    db->exec("CREATE TABLE IF NOT EXISTS tile_hashes ("
+             "  tile_id INTEGER NOT NULL PRIMARY KEY REFERENCES tiles(id) ON DELETE CASCADE,"
+             "  hash INTEGER NOT NULL"
+             ")");
+
+    if (writeAheadLogging) {
+        db->exec("PRAGMA journal_mode = WAL");
+        db->exec("PRAGMA synchronous = FULL");
+    }
+}
+
+void OfflineDatabase::setWriteAheadLogging(bool enabled) try {
+    assert(mode == Mode::ReadWrite);
+    writeAheadLogging = enabled;
+    if (!db) {
+        initialize();
+    } else {
+        db->exec(enabled ? "PRAGMA journal_mode = WAL" : "PRAGMA journal_mode = DELETE");
+        db->exec("PRAGMA synchronous = FULL");
     }
+} catch (const util::IOException& ex) {
+    handleError(ex, "change journal mode");
+} catch (const mapbox::sqlite::Exception& ex) {
+    handleError(ex, "change journal mode");
 }
 
 void OfflineDatabase::changePath(const std::string& path_) {
@@ -77,6 +141,10 @@ void OfflineDatabase::changePath(const std::string& path_) {
 }
 
 void OfflineDatabase::cleanup() {
+    if (db) {
+        flushAccessedTimestamps();
+    }
+
     // Deleting these SQLite objects may result in exceptions
     try {
         statements.clear();
@@ -89,10 +157,12 @@ void OfflineDatabase::cleanup() {
 }
 
 void OfflineDatabase::handleError(const mapbox::sqlite::Exception& ex, const char* action) {
-    if (ex.code == mapbox::sqlite::ResultCode::NotADB ||
-        ex.code == mapbox::sqlite::ResultCode::Corrupt ||
-        (ex.code == mapbox::sqlite::ResultCode::ReadOnly &&
-         ex.extendedCode == mapbox::sqlite::ExtendedResultCode::ReadOnlyDBMoved)) {
+    // Read-only connections leave recovering from a broken database to the one that writes.
+    if (mode == Mode::ReadWrite &&
+        (ex.code == mapbox::sqlite::ResultCode::NotADB ||
+         ex.code == mapbox::sqlite::ResultCode::Corrupt ||
+         (ex.code == mapbox::sqlite::ResultCode::ReadOnly &&
+          ex.extendedCode == mapbox::sqlite::ExtendedResultCode::ReadOnlyDBMoved))) {
         // The database was corruped, moved away, or deleted. We're going to start fresh with a
         // clean slate for the next operation.
         Log::Error(Event::Database, static_cast<int>(ex.code), "Can't %s: %s", action, ex.what());
@@ -115,10 +185,16 @@ void OfflineDatabase::handleError(const util::IOException& ex, const char* actio
 void OfflineDatabase::removeExisting() {
     Log::Warning(Event::Database, "Removing existing incompatible offline database");
 
+    pendingAccesses = {};
+
     statements.clear();
     db.reset();
 
     util::deleteFile(path);
+    if (writeAheadLogging) {
+        util::deleteFile(path + "-wal");
+        util::deleteFile(path + "-shm");
+    }
 }
 
 void OfflineDatabase::removeOldCacheTable() {
@@ -130,6 +206,9 @@ void OfflineDatabase::removeOldCacheTable() {
 void OfflineDatabase::createSchema() {
     assert(db);
     db->exec("PRAGMA auto_vacuum = INCREMENTAL");
+    // Commits stay fully synced, since the database also holds offline regions that must survive
+    // a power loss. Cache hits no longer write on their own; their accessed timestamps are
+    // written in batches instead. See also the note about schema version 4 below.
     db->exec("PRAGMA journal_mode = DELETE");
     db->exec("PRAGMA synchronous = FULL");
     mapbox::sqlite::Transaction transaction(*db);
@@ -180,6 +259,9 @@ mapbox::sqlite::Statement& OfflineDatabase::getStatement(const char* sql) {
 
 optional<Response> OfflineDatabase::get(const Resource& resource) try {
     auto result = getInternal(resource);
+    if (accessedTimestampsFlushDue()) {
+        flushAccessedTimestamps();
+    }
     return result ? optional<Response>{ result->first } : nullopt;
 } catch (const util::IOException& ex) {
     handleError(ex, "read resource");
@@ -246,7 +328,7 @@ std::pair<bool, uint64_t> OfflineDatabase::putInternal(const Resource& resource,
         assert(resource.tileData);
         inserted = putTile(*resource.tileData, response,
                 compressed ? compressedData : response.data ? *response.data : "",
-                compressed);
+                compressed, tileHash(response.data ? *response.data : ""));
     } else {
         inserted = putResource(resource, response,
                 compressed ? compressedData : response.data ? *response.data : "",
@@ -257,26 +339,10 @@ std::pair<bool, uint64_t> OfflineDatabase::putInternal(const Resource& resource,
 }
 
 optional<std::pair<Response, uint64_t>> OfflineDatabase::getResource(const Resource& resource) {
-    // Update accessed timestamp used for LRU eviction.
-    try {
-        mapbox::sqlite::Query accessedQuery{ getStatement("UPDATE resources SET accessed = ?1 WHERE url = ?2") };
-        accessedQuery.bind(1, util::now());
-        accessedQuery.bind(2, resource.url);
-        accessedQuery.run();
-    } catch (const mapbox::sqlite::Exception& ex) {
-        if (ex.code == mapbox::sqlite::ResultCode::NotADB ||
-            ex.code == mapbox::sqlite::ResultCode::Corrupt) {
-            throw;
-        }
-
-        // If we don't have any indication that the database is corrupt, continue as usual.
-        Log::Warning(Event::Database, static_cast<int>(ex.code), "Can't update timestamp: %s", ex.what());
-    }
-
     // clang-format off
     mapbox::sqlite::Query query{ getStatement(
-        //        0      1            2            3       4      5
-        "SELECT etag, expires, must_revalidate, modified, data, compressed "
+        //        0      1            2            3       4      5          6
+        "SELECT etag, expires, must_revalidate, modified, data, compressed, accessed "
         "FROM resources "
         "WHERE url = ?") };
     // clang-format on
@@ -295,6 +361,15 @@ optional<std::pair<Response, uint64_t>> OfflineDatabase::getResource(const Resou
     response.mustRevalidate = query.get<bool>(2);
     response.modified       = query.get<optional<Timestamp>>(3);
 
+    // Record the accessed timestamp used for LRU eviction, to be written in a later batch.
+    const Timestamp now = util::now();
+    if (query.get<Timestamp>(6) + accessedTimestampGranularity <= now) {
+        if (!pendingAccesses.since) {
+            pendingAccesses.since = now;
+        }
+        pendingAccesses.resources[resource.url] = now;
+    }
+
     auto data = query.get<optional<std::string>>(4);
     if (!data) {
         response.noContent = true;
@@ -405,39 +480,10 @@ bool OfflineDatabase::putResource(const Resource& resource,
 }
 
 optional<std::pair<Response, uint64_t>> OfflineDatabase::getTile(const Resource::TileData& tile) {
-    // Update accessed timestamp used for LRU eviction.
-    try {
-        // clang-format off
-        mapbox::sqlite::Query accessedQuery{ getStatement(
-            "UPDATE tiles "
-            "SET accessed       = ?1 "
-            "WHERE url_template = ?2 "
-            "  AND pixel_ratio  = ?3 "
-            "  AND x            = ?4 "
-            "  AND y            = ?5 "
-            "  AND z            = ?6 ") };
-        // clang-format on
-
-        accessedQuery.bind(1, util::now());
-        accessedQuery.bind(2, tile.urlTemplate);
-        accessedQuery.bind(3, tile.pixelRatio);
-        accessedQuery.bind(4, tile.x);
-        accessedQuery.bind(5, tile.y);
-        accessedQuery.bind(6, tile.z);
-        accessedQuery.run();
-    } catch (const mapbox::sqlite::Exception& ex) {
-        if (ex.code == mapbox::sqlite::ResultCode::NotADB || ex.code == mapbox::sqlite::ResultCode::Corrupt) {
-            throw;
-        }
-
-        // If we don't have any indication that the database is corrupt, continue as usual.
-        Log::Warning(Event::Database, static_cast<int>(ex.code), "Can't update timestamp: %s", ex.what());
-    }
-
     // clang-format off
     mapbox::sqlite::Query query{ getStatement(
-        //        0      1           2,            3,      4,      5
-        "SELECT etag, expires, must_revalidate, modified, data, compressed "
+        //        0      1           2,            3,      4,      5,         6
+        "SELECT etag, expires, must_revalidate, modified, data, compressed, accessed "
         "FROM tiles "
         "WHERE url_template = ?1 "
         "  AND pixel_ratio  = ?2 "
@@ -464,6 +510,15 @@ optional<std::pair<Response, uint64_t>> OfflineDatabase::getTile(const Resource:
     response.mustRevalidate  = query.get<bool>(2);
     response.modified        = query.get<optional<Timestamp>>(3);
 
+    // Record the accessed timestamp used for LRU eviction, to be written in a later batch.
+    const Timestamp now = util::now();
+    if (query.get<Timestamp>(6) + accessedTimestampGranularity <= now) {
+        if (!pendingAccesses.since) {
+            pendingAccesses.since = now;
+        }
+        pendingAccesses.tiles[PendingAccesses::TileKey{ tile.urlTemplate, tile.pixelRatio, tile.x, tile.y, tile.z }] = now;
+    }
+
     optional<std::string> data = query.get<optional<std::string>>(4);
     if (!data) {
         response.noContent = true;
@@ -503,10 +558,15 @@ optional<int64_t> OfflineDatabase::hasTile(const Resource::TileData& tile) {
     return size.get<optional<int64_t>>(0);
 }
 
+uint32_t OfflineDatabase::tileHash(const std::string& data) {
+    return static_cast<uint32_t>(crc32(0, reinterpret_cast<const Bytef*>(data.data()), uInt(data.size())));
+}
+
 bool OfflineDatabase::putTile(const Resource::TileData& tile,
                               const Response& response,
                               const std::string& data,
-                              bool compressed) {
+                              bool compressed,
+                              uint32_t hash) {
     if (response.notModified) {
         // clang-format off
         mapbox::sqlite::Query notModifiedQuery{ getStatement(
@@ -573,6 +633,7 @@ bool OfflineDatabase::putTile(const Resource::TileData& tile,
 
     updateQuery.run();
     if (updateQuery.changes() != 0) {
+        putTileHash(tile, hash);
         return false;
     }
 
@@ -602,10 +663,32 @@ bool OfflineDatabase::putTile(const Resource::TileData& tile,
     }
 
     insertQuery.run();
+    putTileHash(tile, hash);
 
     return true;
 }
 
+void OfflineDatabase::putTileHash(const Resource::TileData& tile, uint32_t hash) {
+    // clang-format off
+    mapbox::sqlite::Query query{ getStatement(
+        "REPLACE INTO tile_hashes (tile_id, hash) "
+        "SELECT id, ?1 FROM tiles "
+        "WHERE url_template = ?2 "
+        "  AND pixel_ratio  = ?3 "
+        "  AND x            = ?4 "
+        "  AND y            = ?5 "
+        "  AND z            = ?6 ") };
+    // clang-format on
+
+    query.bind(1, static_cast<int64_t>(hash));
+    query.bind(2, tile.urlTemplate);
+    query.bind(3, tile.pixelRatio);
+    query.bind(4, tile.x);
+    query.bind(5, tile.y);
+    query.bind(6, tile.z);
+    query.run();
+}
+
 std::exception_ptr OfflineDatabase::invalidateTileCache() try {
     // clang-format off
     mapbox::sqlite::Query query{ getStatement(
@@ -735,6 +818,15 @@ OfflineDatabase::mergeDatabase(const std::string& sideDatabasePath) {
         queryTiles.reset();
 
         mapbox::sqlite::Transaction transaction(*db);
+        // Merged tiles replace existing ones under the same id, so their hashes would be stale.
+        // Sideloaded databases don't carry hashes; those tiles are treated as changed by delta updates.
+        db->exec("DELETE FROM tile_hashes WHERE tile_id IN ("
+                 "    SELECT t.id FROM side.region_tiles srt "
+                 "    JOIN side.tiles st ON srt.tile_id = st.id "
+                 "    JOIN tiles t ON st.url_template = t.url_template AND st.pixel_ratio = t.pixel_ratio "
+                 "        AND st.z = t.z AND st.x = t.x AND st.y = t.y "
+                 "    WHERE st.modified > t.modified"
+                 ")");
         db->exec(mergeSideloadedDatabaseSQL);
         transaction.commit();
 
@@ -789,6 +881,7 @@ std::exception_ptr OfflineDatabase::deleteRegion(OfflineRegion&& region) try {
         query.run();
     }
 
+    flushAccessedTimestamps();
     evict(0);
     assert(db);
     db->exec("PRAGMA incremental_vacuum");
@@ -893,6 +986,12 @@ uint64_t OfflineDatabase::putRegionResourceInternal(int64_t regionID, const Reso
     }
 
     uint64_t size = putInternal(resource, response, false).second;
+    markRegionResourceUsed(regionID, resource);
+
+    return size;
+}
+
+void OfflineDatabase::markRegionResourceUsed(int64_t regionID, const Resource& resource) {
     bool previouslyUnused = markUsed(regionID, resource);
 
     if (offlineMapboxTileCount
@@ -901,8 +1000,51 @@ uint64_t OfflineDatabase::putRegionResourceInternal(int64_t regionID, const Reso
         && previouslyUnused) {
         *offlineMapboxTileCount += 1;
     }
+}
 
-    return size;
+std::exception_ptr OfflineDatabase::putRegionTiles(int64_t regionID,
+                                                   const std::vector<PreparedTile>& tiles,
+                                                   OfflineRegionStatus& status) try {
+    if (!db) {
+        initialize();
+    }
+    mapbox::sqlite::Transaction transaction(*db);
+
+    // Accumulate all statistics locally first before adding them to the OfflineRegionStatus object
+    // to ensure correctness when the transaction fails.
+    uint64_t completedTileCount = 0;
+    uint64_t completedTileSize = 0;
+    Response response;
+
+    auto commit = [&] {
+        transaction.commit();
+        status.completedResourceCount += completedTileCount;
+        status.completedResourceSize += completedTileSize;
+        status.completedTileCount += completedTileCount;
+        status.completedTileSize += completedTileSize;
+    };
+
+    for (const auto& tile : tiles) {
+        assert(tile.resource.tileData);
+
+        if (exceedsOfflineMapboxTileCountLimit(tile.resource)) {
+            // Commit and count the rest of the batch and throw
+            commit();
+            throw MapboxTileLimitExceededException();
+        }
+
+        putTile(*tile.resource.tileData, response, tile.data, tile.compressed, tile.hash);
+        markRegionResourceUsed(regionID, tile.resource);
+        completedTileCount++;
+        completedTileSize += tile.data.size();
+    }
+
+    // Commit the completed batch
+    commit();
+    return nullptr;
+} catch (const mapbox::sqlite::Exception& ex) {
+    handleError(ex, "write region tiles");
+    return std::current_exception();
 }
 
 bool OfflineDatabase::markUsed(int64_t regionID, const Resource& resource) {
@@ -984,6 +1126,76 @@ bool OfflineDatabase::markUsed(int64_t regionID, const Resource& resource) {
     }
 }
 
+expected<OfflineDatabase::RegionTileDelta, std::exception_ptr>
+OfflineDatabase::diffRegionTiles(int64_t regionID,
+                                 const std::string& urlTemplate,
+                                 float pixelRatio,
+                                 const OfflineTileManifest& manifest) try {
+    if (!db) {
+        initialize();
+    }
+    mapbox::sqlite::Transaction transaction(*db);
+
+    RegionTileDelta delta;
+
+    for (const auto& entry : manifest) {
+        Resource resource = Resource::tile(urlTemplate, pixelRatio, entry.x, entry.y, entry.z,
+                                           Tileset::Scheme::XYZ, Resource::Priority::Low);
+        const auto& tile = *resource.tileData;
+
+        optional<int64_t> tileID;
+        optional<int64_t> hash;
+        int64_t size = 0;
+        {
+            // clang-format off
+            mapbox::sqlite::Query query{ getStatement(
+                //      0       1           2
+                "SELECT t.id, h.hash, LENGTH(t.data) "
+                "FROM tiles t "
+                "LEFT JOIN tile_hashes h ON h.tile_id = t.id "
+                "WHERE t.url_template = ?1 "
+                "  AND t.pixel_ratio  = ?2 "
+                "  AND t.x            = ?3 "
+                "  AND t.y            = ?4 "
+                "  AND t.z            = ?5 ") };
+            // clang-format on
+
+            query.bind(1, tile.urlTemplate);
+            query.bind(2, tile.pixelRatio);
+            query.bind(3, tile.x);
+            query.bind(4, tile.y);
+            query.bind(5, tile.z);
+            if (query.run()) {
+                tileID = query.get<int64_t>(0);
+                hash = query.get<optional<int64_t>>(1);
+                size = query.get<optional<int64_t>>(2).value_or(0);
+            }
+        }
+
+        if (tileID && hash == static_cast<int64_t>(entry.hash)) {
+            markRegionResourceUsed(regionID, resource);
+            delta.unchangedTileCount++;
+            delta.unchangedTileSize += size;
+            continue;
+        }
+
+        if (tileID) {
+            mapbox::sqlite::Query invalidateQuery{ getStatement(
+                "UPDATE tiles SET expires = 0, must_revalidate = 1 WHERE id = ?") };
+            invalidateQuery.bind(1, *tileID);
+            invalidateQuery.run();
+        }
+
+        delta.changedTiles.push_back(std::move(resource));
+    }
+
+    transaction.commit();
+    return delta;
+} catch (const mapbox::sqlite::Exception& ex) {
+    handleError(ex, "diff region tiles");
+    return unexpected<std::exception_ptr>(std::current_exception());
+}
+
 expected<OfflineRegionDefinition, std::exception_ptr> OfflineDatabase::getRegionDefinition(int64_t regionID) try {
     mapbox::sqlite::Query query{ getStatement("SELECT definition FROM regions WHERE id = ?1") };
     query.bind(1, regionID);
@@ -1045,6 +1257,12 @@ T OfflineDatabase::getPragma(const char* sql) {
     return query.get<T>(0);
 }
 
+uint64_t OfflineDatabase::getUsedSize() {
+    const uint64_t pageSize = getPragma<int64_t>("PRAGMA page_size");
+    const uint64_t pageCount = getPragma<int64_t>("PRAGMA page_count");
+    return pageSize * (pageCount - getPragma<int64_t>("PRAGMA freelist_count"));
+}
+
 // Remove least-recently used resources and tiles until the used database size,
 // as calculated by multiplying the number of in-use pages by the page size, is
 // less than the maximum cache size. Returns false if this condition cannot be
@@ -1055,81 +1273,249 @@ T OfflineDatabase::getPragma(const char* sql) {
 // and as it approaches to the hard limit (i.e. the actual file size) we
 // delete an arbitrary number of old cache entries. The free pages approach saves
 // us from calling VACCUM or keeping a running total, which can be costly.
+//
+// This only happens when a put would otherwise exceed the maximum cache size.
+// Usually, evictToLowWatermark() keeps the cache well below that limit.
 bool OfflineDatabase::evict(uint64_t neededFreeSize) {
-    uint64_t pageSize = getPragma<int64_t>("PRAGMA page_size");
-    uint64_t pageCount = getPragma<int64_t>("PRAGMA page_count");
+    // Eviction order depends on the accessed timestamps, so they need to be current.
+    updateAccessedTimestamps();
 
-    auto usedSize = [&] {
-        return pageSize * (pageCount - getPragma<int64_t>("PRAGMA freelist_count"));
-    };
+    const uint64_t pageSize = getPragma<int64_t>("PRAGMA page_size");
 
     // The addition of pageSize is a fudge factor to account for non `data` column
     // size, and because pages can get fragmented on the database.
-    while (usedSize() + neededFreeSize + pageSize > maximumCacheSize) {
-        // clang-format off
-        mapbox::sqlite::Query accessedQuery{ getStatement(
-            "SELECT max(accessed) "
-            "FROM ( "
-            "    SELECT accessed "
-            "    FROM resources "
-            "    LEFT JOIN region_resources "
-            "    ON resource_id = resources.id "
-            "    WHERE resource_id IS NULL "
-            "  UNION ALL "
-            "    SELECT accessed "
-            "    FROM tiles "
-            "    LEFT JOIN region_tiles "
-            "    ON tile_id = tiles.id "
-            "    WHERE tile_id IS NULL "
-            "  ORDER BY accessed ASC LIMIT ?1 "
-            ") "
-        ) };
-        accessedQuery.bind(1, 50);
-        // clang-format on
-        if (!accessedQuery.run()) {
+    uint64_t usedSize = getUsedSize();
+    while (usedSize + neededFreeSize + pageSize > maximumCacheSize) {
+        if (!evictLeastRecentlyUsed()) {
             return false;
         }
-        Timestamp accessed = accessedQuery.get<Timestamp>(0);
+        usedSize = getUsedSize();
+    }
 
-        // clang-format off
-        mapbox::sqlite::Query resourceQuery{ getStatement(
-            "DELETE FROM resources "
-            "WHERE id IN ( "
-            "  SELECT id FROM resources "
-            "  LEFT JOIN region_resources "
-            "  ON resource_id = resources.id "
-            "  WHERE resource_id IS NULL "
-            "  AND accessed <= ?1 "
-            ") ") };
-        // clang-format on
-        resourceQuery.bind(1, accessed);
-        resourceQuery.run();
-        const uint64_t resourceChanges = resourceQuery.changes();
+    if (usedSize + neededFreeSize > uint64_t(maximumCacheSize * evictionHighWatermark)) {
+        needsEviction = true;
+    }
 
-        // clang-format off
-        mapbox::sqlite::Query tileQuery{ getStatement(
-            "DELETE FROM tiles "
-            "WHERE id IN ( "
-            "  SELECT id FROM tiles "
-            "  LEFT JOIN region_tiles "
-            "  ON tile_id = tiles.id "
-            "  WHERE tile_id IS NULL "
-            "  AND accessed <= ?1 "
-            ") ") };
-        // clang-format on
-        tileQuery.bind(1, accessed);
-        tileQuery.run();
-        const uint64_t tileChanges = tileQuery.changes();
+    return true;
+}
 
-        // The cached value of offlineTileCount does not need to be updated
-        // here because only non-offline tiles can be removed by eviction.
+bool OfflineDatabase::evictToLowWatermark() try {
+    if (!needsEviction) {
+        return false;
+    }
+    if (!db) {
+        initialize();
+    }
 
-        if (resourceChanges == 0 && tileChanges == 0) {
-            return false;
+    mapbox::sqlite::Transaction transaction(*db, mapbox::sqlite::Transaction::Immediate);
+    updateAccessedTimestamps();
+
+    // Bound the work done in one pass, so that requests queued behind it don't wait too long.
+    const auto lowWatermark = uint64_t(maximumCacheSize * evictionLowWatermark);
+    for (std::size_t step = 0; step < maximumEvictionStepsPerPass; ++step) {
+        if (getUsedSize() <= lowWatermark || !evictLeastRecentlyUsed()) {
+            needsEviction = false;
+            break;
         }
     }
 
-    return true;
+    transaction.commit();
+    return needsEviction;
+} catch (const util::IOException& ex) {
+    handleError(ex, "evict cache entries");
+    needsEviction = false;
+    return false;
+} catch (const mapbox::sqlite::Exception& ex) {
+    handleError(ex, "evict cache entries");
+    needsEviction = false;
+    return false;
+}
+
+bool OfflineDatabase::reclaimFreePages() try {
+    if (!db) {
+        return false;
+    }
+
+    const uint64_t pageSize = getPragma<int64_t>("PRAGMA page_size");
+    const uint64_t freePages = getPragma<int64_t>("PRAGMA freelist_count");
+    if (freePages == 0) {
+        return false;
+    }
+
+    db->exec("PRAGMA incremental_vacuum(" + util::toString(maximumReclaimedPagesPerPass) + ")");
+
+    const uint64_t remainingFreePages = getPragma<int64_t>("PRAGMA freelist_count");
+    evictionStats.reclaimedBytes += pageSize * (freePages - std::min(freePages, remainingFreePages));
+    return remainingFreePages > 0;
+} catch (const mapbox::sqlite::Exception& ex) {
+    handleError(ex, "reclaim free pages");
+    return false;
+}
+
+// Deletes the least recently used ambient resources and tiles, in batches of at least 50 entries.
+// Returns false if there was nothing left to delete.
+bool OfflineDatabase::evictLeastRecentlyUsed() {
+    const auto start = Clock::now();
+    const uint64_t usedSizeBefore = getUsedSize();
+
+    // clang-format off
+    mapbox::sqlite::Query accessedQuery{ getStatement(
+        "SELECT max(accessed) "
+        "FROM ( "
+        "    SELECT accessed "
+        "    FROM resources "
+        "    LEFT JOIN region_resources "
+        "    ON resource_id = resources.id "
+        "    WHERE resource_id IS NULL "
+        "  UNION ALL "
+        "    SELECT accessed "
+        "    FROM tiles "
+        "    LEFT JOIN region_tiles "
+        "    ON tile_id = tiles.id "
+        "    WHERE tile_id IS NULL "
+        "  ORDER BY accessed ASC LIMIT ?1 "
+        ") "
+    ) };
+    accessedQuery.bind(1, 50);
+    // clang-format on
+    if (!accessedQuery.run()) {
+        return false;
+    }
+    Timestamp accessed = accessedQuery.get<Timestamp>(0);
+
+    // clang-format off
+    mapbox::sqlite::Query resourceQuery{ getStatement(
+        "DELETE FROM resources "
+        "WHERE id IN ( "
+        "  SELECT id FROM resources "
+        "  LEFT JOIN region_resources "
+        "  ON resource_id = resources.id "
+        "  WHERE resource_id IS NULL "
+        "  AND accessed <= ?1 "
+        ") ") };
+    // clang-format on
+    resourceQuery.bind(1, accessed);
+    resourceQuery.run();
+    const uint64_t resourceChanges = resourceQuery.changes();
+
+    // clang-format off
+    mapbox::sqlite::Query tileQuery{ getStatement(
+        "DELETE FROM tiles "
+        "WHERE id IN ( "
+        "  SELECT id FROM tiles "
+        "  LEFT JOIN region_tiles "
+        "  ON tile_id = tiles.id "
+        "  WHERE tile_id IS NULL "
+        "  AND accessed <= ?1 "
+        ") ") };
+    // clang-format on
+    tileQuery.bind(1, accessed);
+    tileQuery.run();
+    const uint64_t tileChanges = tileQuery.changes();
+
+    // The cached value of offlineTileCount does not need to be updated
+    // here because only non-offline tiles can be removed by eviction.
+
+    const uint64_t usedSizeAfter = getUsedSize();
+    evictionStats.evictedEntries += resourceChanges + tileChanges;
+    evictionStats.evictedBytes += usedSizeBefore - std::min(usedSizeBefore, usedSizeAfter);
+    evictionStats.evictionTime += Clock::now() - start;
+
+    return resourceChanges != 0 || tileChanges != 0;
+}
+
+bool OfflineDatabase::accessedTimestampsFlushDue() const {
+    return pendingAccesses.since &&
+           (pendingAccesses.resources.size() + pendingAccesses.tiles.size() >= maximumPendingAccesses ||
+            *pendingAccesses.since + accessedTimestampFlushInterval <= util::now());
+}
+
+OfflineDatabase::PendingAccesses OfflineDatabase::takePendingAccesses() {
+    auto accesses = std::move(pendingAccesses);
+    pendingAccesses = {};
+    return accesses;
+}
+
+void OfflineDatabase::addPendingAccesses(PendingAccesses&& accesses) {
+    if (!accesses.since) {
+        return;
+    }
+    for (auto& access : accesses.resources) {
+        pendingAccesses.resources[access.first] = access.second;
+    }
+    for (auto& access : accesses.tiles) {
+        pendingAccesses.tiles[access.first] = access.second;
+    }
+    if (!pendingAccesses.since || *accesses.since < *pendingAccesses.since) {
+        pendingAccesses.since = accesses.since;
+    }
+}
+
+void OfflineDatabase::recordAccess(const Resource& resource) {
+    const Timestamp now = util::now();
+    if (!pendingAccesses.since) {
+        pendingAccesses.since = now;
+    }
+    if (resource.kind == Resource::Kind::Tile) {
+        assert(resource.tileData);
+        const auto& tile = *resource.tileData;
+        pendingAccesses.tiles[PendingAccesses::TileKey{ tile.urlTemplate, tile.pixelRatio, tile.x, tile.y, tile.z }] = now;
+    } else {
+        pendingAccesses.resources[resource.url] = now;
+    }
+    if (accessedTimestampsFlushDue()) {
+        flushAccessedTimestamps();
+    }
+}
+
+void OfflineDatabase::flushAccessedTimestamps() try {
+    if (!pendingAccesses.since || mode == Mode::ReadOnly) {
+        return;
+    }
+    if (!db) {
+        initialize();
+    }
+    mapbox::sqlite::Transaction transaction(*db, mapbox::sqlite::Transaction::Immediate);
+    updateAccessedTimestamps();
+    transaction.commit();
+} catch (const util::IOException& ex) {
+    handleError(ex, "update timestamp");
+} catch (const mapbox::sqlite::Exception& ex) {
+    handleError(ex, "update timestamp");
+}
+
+// Must be called within a transaction. Timestamps that can't be written are dropped, since
+// they're only used to pick the entries that are evicted first.
+void OfflineDatabase::updateAccessedTimestamps() {
+    const PendingAccesses accesses = takePendingAccesses();
+
+    for (const auto& access : accesses.resources) {
+        mapbox::sqlite::Query query{ getStatement("UPDATE resources SET accessed = ?1 WHERE url = ?2") };
+        query.bind(1, access.second);
+        query.bind(2, access.first);
+        query.run();
+    }
+
+    for (const auto& access : accesses.tiles) {
+        // clang-format off
+        mapbox::sqlite::Query query{ getStatement(
+            "UPDATE tiles "
+            "SET accessed       = ?1 "
+            "WHERE url_template = ?2 "
+            "  AND pixel_ratio  = ?3 "
+            "  AND x            = ?4 "
+            "  AND y            = ?5 "
+            "  AND z            = ?6 ") };
+        // clang-format on
+
+        query.bind(1, access.second);
+        query.bind(2, std::get<0>(access.first));
+        query.bind(3, std::get<1>(access.first));
+        query.bind(4, std::get<2>(access.first));
+        query.bind(5, std::get<3>(access.first));
+        query.bind(6, std::get<4>(access.first));
+        query.run();
+    }
 }
 
 void OfflineDatabase::setOfflineMapboxTileCountLimit(uint64_t limit) {
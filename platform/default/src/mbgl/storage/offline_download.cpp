@@ -1,6 +1,7 @@
 #include <mbgl/storage/online_file_source.hpp>
 #include <mbgl/storage/offline_database.hpp>
 #include <mbgl/storage/offline_download.hpp>
+#include <mbgl/storage/resource_memory_cache.hpp>
 #include <mbgl/storage/resource.hpp>
 #include <mbgl/storage/response.hpp>
 #include <mbgl/storage/http_file_source.hpp>
@@ -85,11 +86,13 @@ uint64_t tileCount(const OfflineRegionDefinition& definition, style::SourceType
 OfflineDownload::OfflineDownload(int64_t id_,
                                  OfflineRegionDefinition&& definition_,
                                  OfflineDatabase& offlineDatabase_,
-                                 OnlineFileSource& onlineFileSource_)
+                                 OnlineFileSource& onlineFileSource_,
+                                 std::shared_ptr<ResourceMemoryCache> memoryCache_)
     : id(id_),
       definition(definition_),
       offlineDatabase(offlineDatabase_),
-      onlineFileSource(onlineFileSource_) {
+      onlineFileSource(onlineFileSource_),
+      memoryCache(std::move(memoryCache_)) {
     setObserver(nullptr);
 }
 
@@ -440,6 +443,12 @@ void OfflineDownload::ensureResource(const Resource& resource,
                     return;
                 }
 
+                if (memoryCache) {
+                    for (const auto& entry : buffer) {
+                        memoryCache->remove(std::get<0>(entry));
+                    }
+                }
+
                 buffer.clear();
                 observer->statusChanged(status);
             }
@@ -0,0 +1,384 @@
+#include <mbgl/storage/offline_import.hpp>
+#include <mbgl/storage/offline_download.hpp>
+#include <mbgl/storage/sqlite3.hpp>
+#include <mbgl/actor/actor.hpp>
+#include <mbgl/actor/mailbox.hpp>
+#include <mbgl/actor/scheduler.hpp>
+#include <mbgl/util/compression.hpp>
+#include <mbgl/util/io.hpp>
+#include <mbgl/util/logging.hpp>
+#include <mbgl/util/tile_range.hpp>
+#include <mbgl/util/tileset.hpp>
+
+#include <mapbox/geometry/envelope.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
+#include <iterator>
+#include <limits>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <dirent.h>
+#endif
+
+#if defined(_WIN32) && !defined(S_ISDIR)
+#define S_ISDIR(m) (((m) & S_IFMT) == S_IFDIR)
+#endif
+
+namespace {
+
+// Tiles stored per transaction.
+constexpr std::size_t batchSize = 4096;
+
+// Each batch is split into this many chunks, compressed concurrently on the background pool.
+constexpr std::size_t compressorCount = 4;
+
+bool isGzipped(const std::string& data) {
+    return data.size() >= 2 && uint8_t(data[0]) == 0x1F && uint8_t(data[1]) == 0x8B;
+}
+
+// Names of the entries of a directory, in no particular order.
+std::vector<std::string> readDirectory(const std::string& path) {
+    std::vector<std::string> names;
+#if defined(_WIN32)
+    WIN32_FIND_DATAA entry;
+    HANDLE find = FindFirstFileA((path + "/*").c_str(), &entry);
+    if (find == INVALID_HANDLE_VALUE) {
+        throw mbgl::util::IOException(ENOENT, "Cannot read directory " + path);
+    }
+    do {
+        names.emplace_back(entry.cFileName);
+    } while (FindNextFileA(find, &entry));
+    FindClose(find);
+#else
+    DIR* dir = opendir(path.c_str());
+    if (!dir) {
+        throw mbgl::util::IOException(errno, "Cannot read directory " + path);
+    }
+    while (const dirent* entry = readdir(dir)) {
+        names.emplace_back(entry->d_name);
+    }
+    closedir(dir);
+#endif
+    return names;
+}
+
+mbgl::LatLngBounds regionBounds(const mbgl::OfflineRegionDefinition& definition) {
+    return definition.match(
+        [](const mbgl::OfflineTilePyramidRegionDefinition& region) {
+            return region.bounds;
+        },
+        [](const mbgl::OfflineGeometryRegionDefinition& region) {
+            const auto box = mapbox::geometry::envelope(region.geometry);
+            return mbgl::LatLngBounds::hull({ box.min.y, box.min.x }, { box.max.y, box.max.x });
+        });
+}
+
+} // namespace
+
+namespace mbgl {
+
+class ArchiveTile {
+public:
+    uint8_t z;
+    uint32_t x;
+    uint32_t y;
+    std::string data;
+};
+
+class TileArchive {
+public:
+    virtual ~TileArchive() = default;
+
+    // Returns fewer tiles than asked for only once the archive is exhausted.
+    virtual std::vector<ArchiveTile> read(std::size_t count) = 0;
+};
+
+namespace {
+
+class MBTilesArchive : public TileArchive {
+public:
+    MBTilesArchive(const std::string& path)
+        : db(mapbox::sqlite::Database::open(path, mapbox::sqlite::ReadOnly)),
+          statement(db, "SELECT zoom_level, tile_column, tile_row, tile_data FROM tiles"),
+          query(statement) {
+    }
+
+    std::vector<ArchiveTile> read(std::size_t count) override {
+        std::vector<ArchiveTile> tiles;
+        while (!exhausted && tiles.size() < count) {
+            if (!query.run()) {
+                exhausted = true;
+                break;
+            }
+
+            const auto z = query.get<int>(0);
+            if (z < 0 || z > 30) {
+                continue;
+            }
+            // MBTiles rows count from the bottom.
+            tiles.push_back({ static_cast<uint8_t>(z),
+                              static_cast<uint32_t>(query.get<int64_t>(1)),
+                              static_cast<uint32_t>((1 << z) - 1 - query.get<int64_t>(2)),
+                              query.get<std::string>(3) });
+        }
+        return tiles;
+    }
+
+private:
+    mapbox::sqlite::Database db;
+    mapbox::sqlite::Statement statement;
+    // Stays open across batches, so that the archive is read in a single pass.
+    mapbox::sqlite::Query query;
+    bool exhausted = false;
+};
+
+class DirectoryArchive : public TileArchive {
+public:
+    DirectoryArchive(std::string root_)
+        : root(std::move(root_)),
+          zooms(list(root)) {
+    }
+
+    std::vector<ArchiveTile> read(std::size_t count) override {
+        std::vector<ArchiveTile> tiles;
+        while (tiles.size() < count) {
+            if (nextY < ys.size()) {
+                const auto& y = ys[nextY++];
+                const std::string column = root + "/" + zooms[nextZ - 1].second + "/" + xs[nextX - 1].second;
+                if (auto data = util::readFile(column + "/" + y.second)) {
+                    tiles.push_back({ static_cast<uint8_t>(zooms[nextZ - 1].first), xs[nextX - 1].first,
+                                      y.first, std::move(*data) });
+                }
+            } else if (nextX < xs.size()) {
+                ys = list(root + "/" + zooms[nextZ - 1].second + "/" + xs[nextX++].second);
+                nextY = 0;
+            } else if (nextZ < zooms.size()) {
+                xs = zooms[nextZ].first <= 30 ? list(root + "/" + zooms[nextZ].second) : Entries();
+                nextZ++;
+                nextX = 0;
+                ys.clear();
+                nextY = 0;
+            } else {
+                break;
+            }
+        }
+        return tiles;
+    }
+
+private:
+    // Numbered entries of a directory, ordered by number. Tile files are numbered by their name
+    // up to the extension.
+    using Entries = std::vector<std::pair<uint32_t, std::string>>;
+
+    static Entries list(const std::string& path) {
+        Entries entries;
+        for (const std::string& name : readDirectory(path)) {
+            char* end = nullptr;
+            const unsigned long number = std::strtoul(name.c_str(), &end, 10);
+            if (end == name.c_str() || (*end != '\0' && *end != '.') || number > std::numeric_limits<uint32_t>::max()) {
+                continue;
+            }
+            entries.emplace_back(static_cast<uint32_t>(number), name);
+        }
+
+        std::sort(entries.begin(), entries.end());
+        return entries;
+    }
+
+    const std::string root;
+    const Entries zooms;
+    Entries xs;
+    Entries ys;
+    std::size_t nextZ = 0;
+    std::size_t nextX = 0;
+    std::size_t nextY = 0;
+};
+
+std::unique_ptr<TileArchive> openArchive(const std::string& path) {
+    struct stat buf;
+    if (stat(path.c_str(), &buf) != 0) {
+        throw util::IOException(errno, "Cannot open tile archive " + path);
+    }
+
+    if (S_ISDIR(buf.st_mode)) {
+        return std::make_unique<DirectoryArchive>(path);
+    }
+    return std::make_unique<MBTilesArchive>(path);
+}
+
+} // namespace
+
+// Prepares tiles for storage on the background pool, the same way OfflineDatabase::put() does.
+class TileCompressor {
+public:
+    TileCompressor(ActorRef<OfflineImport> import_, float pixelRatio_, std::string urlTemplate_)
+        : import(std::move(import_)),
+          pixelRatio(pixelRatio_),
+          urlTemplate(std::move(urlTemplate_)) {
+    }
+
+    void compress(std::vector<ArchiveTile> tiles) {
+        std::vector<OfflineDatabase::PreparedTile> prepared;
+        prepared.reserve(tiles.size());
+
+        for (auto& tile : tiles) {
+            std::string data = std::move(tile.data);
+            // Archives usually hold vector tiles gzipped, while tiles are stored the way they
+            // were served, after their content encoding was decoded.
+            if (isGzipped(data)) {
+                try {
+                    data = util::decompress(data);
+                } catch (const std::runtime_error& ex) {
+                    Log::Warning(Event::Database, "Skipping tile %d/%d/%d of archive: %s",
+                                 int(tile.z), int(tile.x), int(tile.y), ex.what());
+                    continue;
+                }
+            }
+
+            const uint32_t hash = OfflineDatabase::tileHash(data);
+            std::string compressedData = util::compress(data);
+            const bool compressed = compressedData.size() < data.size();
+            prepared.push_back({ Resource::tile(urlTemplate, pixelRatio, tile.x, tile.y, tile.z, Tileset::Scheme::XYZ),
+                                 compressed ? std::move(compressedData) : std::move(data),
+                                 compressed,
+                                 hash });
+        }
+
+        import.invoke(&OfflineImport::tilesCompressed, std::move(prepared));
+    }
+
+private:
+    ActorRef<OfflineImport> import;
+    const float pixelRatio;
+    const std::string urlTemplate;
+};
+
+OfflineImport::OfflineImport(int64_t regionID_,
+                             const OfflineRegionDefinition& definition,
+                             std::string urlTemplate_,
+                             std::string archivePath_,
+                             OfflineDatabase& offlineDatabase_,
+                             OfflineDownload& download_,
+                             Callback callback_)
+    : regionID(regionID_),
+      pixelRatio(definition.match([](auto& region) { return region.pixelRatio; })),
+      minZoom(definition.match([](auto& region) { return region.minZoom; })),
+      maxZoom(definition.match([](auto& region) { return region.maxZoom; })),
+      bounds(regionBounds(definition)),
+      urlTemplate(std::move(urlTemplate_)),
+      archivePath(std::move(archivePath_)),
+      offlineDatabase(offlineDatabase_),
+      download(download_),
+      callback(std::move(callback_)),
+      mailbox(std::make_shared<Mailbox>(*Scheduler::GetCurrent())) {
+    for (std::size_t i = 0; i < compressorCount; ++i) {
+        compressors.push_back(std::make_unique<Actor<TileCompressor>>(
+            Scheduler::GetBackground(), ActorRef<OfflineImport>(*this, mailbox), pixelRatio, urlTemplate));
+    }
+}
+
+OfflineImport::~OfflineImport() = default;
+
+void OfflineImport::start() {
+    try {
+        archive = openArchive(archivePath);
+        status = download.getStatus();
+        if (!compressNextBatch()) {
+            finish(nullptr);
+        }
+    } catch (const std::exception&) {
+        finish(std::current_exception());
+    }
+}
+
+bool OfflineImport::contains(const ArchiveTile& tile) const {
+    if (tile.z < std::floor(minZoom) || tile.z > std::ceil(maxZoom) ||
+        tile.x >= (1ull << tile.z) || tile.y >= (1ull << tile.z)) {
+        return false;
+    }
+    return util::TileRange::fromLatLngBounds(bounds, tile.z).contains({ tile.z, tile.x, tile.y });
+}
+
+bool OfflineImport::compressNextBatch() {
+    std::vector<ArchiveTile> tiles;
+    while (tiles.empty()) {
+        tiles = archive->read(batchSize);
+        if (tiles.empty()) {
+            return false;
+        }
+        tiles.erase(std::remove_if(tiles.begin(), tiles.end(), [&](const ArchiveTile& tile) {
+            return !contains(tile);
+        }), tiles.end());
+    }
+
+    const std::size_t chunkSize = (tiles.size() + compressors.size() - 1) / compressors.size();
+    for (std::size_t begin = 0; begin < tiles.size(); begin += chunkSize) {
+        const std::size_t end = std::min(begin + chunkSize, tiles.size());
+        std::vector<ArchiveTile> chunk(std::make_move_iterator(tiles.begin() + begin),
+                                       std::make_move_iterator(tiles.begin() + end));
+        compressors[pendingChunks++]->self().invoke(&TileCompressor::compress, std::move(chunk));
+    }
+    return true;
+}
+
+void OfflineImport::tilesCompressed(std::vector<OfflineDatabase::PreparedTile> chunk) {
+    if (finished) {
+        return;
+    }
+
+    std::move(chunk.begin(), chunk.end(), std::back_inserter(batch));
+    if (--pendingChunks > 0) {
+        return;
+    }
+
+    auto tiles = std::move(batch);
+    batch.clear();
+
+    try {
+        // Let the compressors work on the next batch while this one is written.
+        const bool more = compressNextBatch();
+
+        // The tiles of the archive may not be accounted for yet, e.g. when the style of the region
+        // hasn't been downloaded.
+        status.requiredResourceCount = std::max<uint64_t>(status.requiredResourceCount,
+                                                          status.completedResourceCount + tiles.size());
+
+        std::exception_ptr error;
+        try {
+            error = offlineDatabase.putRegionTiles(regionID, tiles, status);
+        } catch (const MapboxTileLimitExceededException&) {
+            download.getObserver().mapboxTileCountLimitExceeded(offlineDatabase.getOfflineMapboxTileCountLimit());
+            throw;
+        }
+        if (error) {
+            finish(error);
+            return;
+        }
+
+        download.getObserver().statusChanged(status);
+        if (!more) {
+            finish(nullptr);
+        }
+    } catch (const std::exception&) {
+        finish(std::current_exception());
+    }
+}
+
+void OfflineImport::finish(std::exception_ptr error) {
+    finished = true;
+    archive.reset();
+    callback(error);
+}
+
+} // namespace mbgl
@@ -0,0 +1,102 @@
+#include <mbgl/storage/offline_region_update.hpp>
+#include <mbgl/storage/offline_database.hpp>
+#include <mbgl/storage/offline_download.hpp>
+#include <mbgl/storage/online_file_source.hpp>
+#include <mbgl/storage/response.hpp>
+
+#include <iterator>
+
+namespace mbgl {
+
+OfflineRegionUpdate::OfflineRegionUpdate(int64_t regionID_,
+                                         float pixelRatio_,
+                                         std::string urlTemplate_,
+                                         OfflineTileManifest manifest_,
+                                         OfflineDatabase& offlineDatabase_,
+                                         OnlineFileSource& onlineFileSource_,
+                                         OfflineDownload& download_,
+                                         Callback callback_)
+    : regionID(regionID_),
+      pixelRatio(pixelRatio_),
+      urlTemplate(std::move(urlTemplate_)),
+      manifest(std::move(manifest_)),
+      offlineDatabase(offlineDatabase_),
+      onlineFileSource(onlineFileSource_),
+      download(download_),
+      callback(std::move(callback_)) {
+}
+
+OfflineRegionUpdate::~OfflineRegionUpdate() = default;
+
+void OfflineRegionUpdate::start() {
+    auto delta = offlineDatabase.diffRegionTiles(regionID, urlTemplate, pixelRatio, manifest);
+    if (!delta) {
+        finish(unexpected<std::exception_ptr>(delta.error()));
+        return;
+    }
+
+    // The manifest isn't needed anymore, and may be large.
+    manifest = {};
+
+    stats.unchangedTileCount = delta->unchangedTileCount;
+    stats.savedBytes = delta->unchangedTileSize;
+    tilesRemaining.assign(std::make_move_iterator(delta->changedTiles.begin()),
+                          std::make_move_iterator(delta->changedTiles.end()));
+
+    status = download.getStatus();
+    download.getObserver().statusChanged(status);
+    continueUpdate();
+}
+
+void OfflineRegionUpdate::continueUpdate() {
+    if (tilesRemaining.empty() && requests.empty()) {
+        finish(stats);
+        return;
+    }
+
+    while (!tilesRemaining.empty() && requests.size() < onlineFileSource.getMaximumConcurrentRequests()) {
+        requestTile(tilesRemaining.front());
+        tilesRemaining.pop_front();
+    }
+}
+
+void OfflineRegionUpdate::requestTile(const Resource& resource) {
+    auto requestsIt = requests.insert(requests.begin(), nullptr);
+    *requestsIt = onlineFileSource.request(resource, [=](Response response) {
+        if (response.error) {
+            // The request is retried after some delay.
+            download.getObserver().responseError(*response.error);
+            return;
+        }
+
+        requests.erase(requestsIt);
+        buffer.emplace_back(resource, response);
+
+        // Store the tiles in batches, like downloads do.
+        if (buffer.size() == 64 || (tilesRemaining.empty() && requests.empty())) {
+            const uint64_t completedTileSize = status.completedTileSize;
+            try {
+                offlineDatabase.putRegionResources(regionID, buffer, status);
+            } catch (const MapboxTileLimitExceededException&) {
+                download.getObserver().mapboxTileCountLimitExceeded(offlineDatabase.getOfflineMapboxTileCountLimit());
+                finish(unexpected<std::exception_ptr>(std::current_exception()));
+                return;
+            }
+
+            stats.updatedTileCount += buffer.size();
+            stats.updatedTileSize += status.completedTileSize - completedTileSize;
+            buffer.clear();
+            download.getObserver().statusChanged(status);
+        }
+
+        continueUpdate();
+    });
+}
+
+void OfflineRegionUpdate::finish(expected<OfflineRegionUpdateStats, std::exception_ptr> result) {
+    tilesRemaining.clear();
+    requests.clear();
+    callback(std::move(result));
+}
+
+} // namespace mbgl
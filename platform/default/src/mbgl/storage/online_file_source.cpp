@@ -16,12 +16,15 @@
 #include <mbgl/util/run_loop.hpp>
 #include <mbgl/util/timer.hpp>
 #include <mbgl/util/http_timeout.hpp>
+#include <mbgl/util/string.hpp>
 
 #include <algorithm>
 #include <cassert>
-#include <list>
+#include <map>
+#include <tuple>
 #include <unordered_set>
 #include <unordered_map>
+#include <vector>
 
 namespace mbgl {
 
@@ -42,9 +45,10 @@ public:
     void setTransformedURL(const std::string&& url);
     ActorRef<OnlineFileRequest> actor();
 
+    void setRank(uint32_t) override;
+
     OnlineFileSource::Impl& impl;
     Resource resource;
-    std::unique_ptr<AsyncRequest> request;
     util::Timer timer;
     Callback callback;
 
@@ -90,7 +94,17 @@ public:
     void remove(OnlineFileRequest* request) {
         allRequests.erase(request);
         if (activeRequests.erase(request)) {
-            activatePendingRequest();
+            // Cancel the transfer once none of the requests sharing it are left. It's gone already
+            // if it completed and the request was cancelled before receiving the response.
+            auto it = transfers.find(transferKey(request->resource));
+            if (it != transfers.end()) {
+                auto& waiting = it->second.requests;
+                waiting.erase(std::remove(waiting.begin(), waiting.end(), request), waiting.end());
+                if (waiting.empty()) {
+                    transfers.erase(it);
+                    activatePendingRequest();
+                }
+            }
         } else {
             pendingRequests.remove(request);
         }
@@ -99,9 +113,11 @@ public:
     void activateOrQueueRequest(OnlineFileRequest* request) {
         assert(allRequests.find(request) != allRequests.end());
         assert(activeRequests.find(request) == activeRequests.end());
-        assert(!request->request);
 
-        if (activeRequests.size() >= getMaximumConcurrentRequests()) {
+        // Requests that can share a transfer that's already in progress don't need room for
+        // another one.
+        if (transfers.size() >= getMaximumConcurrentRequests() &&
+            transfers.find(transferKey(request->resource)) == transfers.end()) {
             queueRequest(request);
         } else {
             activateRequest(request);
@@ -113,24 +129,46 @@ public:
     }
 
     void activateRequest(OnlineFileRequest* request) {
-        auto callback = [=](Response response) {
-            activeRequests.erase(request);
-            request->request.reset();
-            request->completed(response);
-            activatePendingRequest();
-        };
-
         activeRequests.insert(request);
 
+        const std::string key = transferKey(request->resource);
+        auto it = transfers.find(key);
+        if (it != transfers.end()) {
+            // An identical request is already in flight, e.g. from another map or an offline
+            // download; its response is passed on to this request too.
+            it->second.requests.push_back(request);
+            return;
+        }
+
+        Transfer& transfer = transfers[key];
+        transfer.requests.push_back(request);
+
         if (online) {
-            request->request = httpFileSource.request(request->resource, callback);
+            transfer.request = httpFileSource.request(request->resource, [this, key](Response response) {
+                completeTransfer(key, response);
+            });
         } else {
             Response response;
             response.error = std::make_unique<Response::Error>(Response::Error::Reason::Connection,
                                                                "Online connectivity is disabled.");
-            callback(response);
+            completeTransfer(key, response);
         }
+    }
+
+    void completeTransfer(const std::string& key, const Response& response) {
+        auto it = transfers.find(key);
+        assert(it != transfers.end());
+        const std::vector<OnlineFileRequest*> waiting = std::move(it->second.requests);
+        transfers.erase(it);
 
+        for (auto request : waiting) {
+            // Completing one request may cancel others that were waiting for the same response.
+            if (activeRequests.erase(request)) {
+                request->completed(response);
+            }
+        }
+
+        activatePendingRequest();
     }
 
     void activatePendingRequest() {
@@ -150,6 +188,10 @@ public:
         return activeRequests.find(request) != activeRequests.end();
     }
 
+    void updatePendingRequest(OnlineFileRequest* request) {
+        pendingRequests.update(request);
+    }
+
     void setResourceTransform(optional<ActorRef<ResourceTransform>>&& transform) {
         resourceTransform = std::move(transform);
     }
@@ -188,64 +230,82 @@ private:
     // Using Pending Requests as an priority queue which processes
     // file requests in a FIFO manner but prefers regular requests
     // over offline requests with a low priority such that low priority
-    // requests do not throttle regular requests.
+    // requests do not throttle regular requests. Requests of the same
+    // priority are processed in order of their rank, which may change
+    // while they're waiting, e.g. as tiles move in and out of view.
     //
     // The order of a queue is therefore:
     //
-    // hi0 -- hi1 -- hi2 -- hi3 -- lo0 -- lo1 --lo2
-    //                              ^
-    //                              firstLowPriorityRequest
+    // hi(rank 0) -- hi(rank 0) -- hi(rank 3) -- lo(rank 0) -- lo(rank 2)
 
     struct PendingRequests {
-        PendingRequests() : queue(), firstLowPriorityRequest(queue.begin()) {}
+        // Priority, rank, and the order in which requests were queued.
+        using Key = std::tuple<Resource::Priority, uint32_t, uint64_t>;
 
-        std::list<OnlineFileRequest*> queue;
-        std::list<OnlineFileRequest*>::iterator firstLowPriorityRequest;
+        std::map<Key, OnlineFileRequest*> queue;
+        std::unordered_map<const OnlineFileRequest*, Key> keys;
+        uint64_t queued = 0;
 
         void remove(const OnlineFileRequest* request) {
-            auto it = std::find(queue.begin(), queue.end(), request);
-            if (it != queue.end()) {
-                if (it == firstLowPriorityRequest) {
-                    firstLowPriorityRequest++;
-                }
-                queue.erase(it);
+            auto it = keys.find(request);
+            if (it != keys.end()) {
+                queue.erase(it->second);
+                keys.erase(it);
             }
         }
 
         void insert(OnlineFileRequest* request) {
-            if (request->resource.priority == Resource::Priority::Regular) {
-                firstLowPriorityRequest = queue.insert(firstLowPriorityRequest, request);
-                firstLowPriorityRequest++;
-            }
-            else {
-                if (firstLowPriorityRequest == queue.end()) {
-                    firstLowPriorityRequest = queue.insert(queue.end(), request);
-                }
-                else {
-                    queue.insert(queue.end(), request);
-                }
-            }
+            const Key key { request->resource.priority, request->resource.rank, queued++ };
+            queue.emplace(key, request);
+            keys.emplace(request, key);
         }
 
+        // Moves a request to the position of its current rank, ahead of requests with the same
+        // rank that were queued after it.
+        void update(OnlineFileRequest* request) {
+            auto it = keys.find(request);
+            if (it != keys.end()) {
+                queue.erase(it->second);
+                it->second = Key { request->resource.priority, request->resource.rank, std::get<2>(it->second) };
+                queue.emplace(it->second, request);
+            }
+        }
 
         optional<OnlineFileRequest*> pop() {
             if (queue.empty()) {
                 return optional<OnlineFileRequest*>();
             }
 
-            if (queue.begin() == firstLowPriorityRequest) {
-                firstLowPriorityRequest++;
-            }
-
-            OnlineFileRequest* next = queue.front();
-            queue.pop_front();
+            OnlineFileRequest* next = queue.begin()->second;
+            keys.erase(next);
+            queue.erase(queue.begin());
             return optional<OnlineFileRequest*>(next);
         }
 
         bool contains(OnlineFileRequest* request) const {
-            return (std::find(queue.begin(), queue.end(), request) != queue.end());
+            return keys.find(request) != keys.end();
+        }
+
+    };
+
+    // Requests for the same URL with the same conditional headers share a single transfer while
+    // it's in progress. They're keyed accordingly.
+    static std::string transferKey(const Resource& resource) {
+        std::string key = resource.url;
+        if (resource.priorEtag) {
+            key += "\netag:" + *resource.priorEtag;
+        }
+        if (resource.priorModified) {
+            key += "\nmodified:" + util::toString(static_cast<int64_t>(resource.priorModified->time_since_epoch().count()));
         }
+        return key;
+    }
 
+    class Transfer {
+    public:
+        std::unique_ptr<AsyncRequest> request;
+        // Active requests waiting for the response, in the order they were activated.
+        std::vector<OnlineFileRequest*> requests;
     };
 
     optional<ActorRef<ResourceTransform>> resourceTransform;
@@ -259,7 +319,9 @@ private:
      * 4. Back to #1
      *
      * Requests in any state are in `allRequests`. Requests in the pending state are in
-     * `pendingRequests`. Requests in the active state are in `activeRequests`.
+     * `pendingRequests`. Requests in the active state are in `activeRequests`, and wait for one
+     * of the `transfers`, which may be shared by several of them. The concurrency limit applies
+     * to transfers.
      */
     std::unordered_set<OnlineFileRequest*> allRequests;
 
@@ -267,6 +329,8 @@ private:
 
     std::unordered_set<OnlineFileRequest*> activeRequests;
 
+    std::unordered_map<std::string, Transfer> transfers;
+
     bool online = true;
     uint32_t maximumConcurrentRequests;
     HTTPFileSource httpFileSource;
@@ -470,6 +534,11 @@ void OnlineFileRequest::setTransformedURL(const std::string&& url) {
      schedule();
 }
 
+void OnlineFileRequest::setRank(uint32_t rank) {
+    resource.rank = rank;
+    impl.updatePendingRequest(this);
+}
+
 ActorRef<OnlineFileRequest> OnlineFileRequest::actor() {
     if (!mailbox) {
         // Lazy constructed because this can be costly and
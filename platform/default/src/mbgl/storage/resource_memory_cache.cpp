@@ -0,0 +1,170 @@
+#include <mbgl/storage/resource_memory_cache.hpp>
+#include <mbgl/util/string.hpp>
+
+#include <cassert>
+#include <functional>
+
+namespace mbgl {
+
+ResourceMemoryCache::ResourceMemoryCache(uint64_t maximumSize)
+    : maximumShardSize(maximumSize / shardCount) {
+}
+
+void ResourceMemoryCache::setMaximumSize(uint64_t maximumSize) {
+    maximumShardSize = maximumSize / shardCount;
+    for (auto& shard_ : shards) {
+        std::lock_guard<std::mutex> lock(shard_.mutex);
+        evict(shard_, maximumShardSize);
+    }
+}
+
+// Tiles are keyed like the database keys them, so that the same tile requested through
+// different URLs, e.g. with another access token, is found.
+std::string ResourceMemoryCache::key(const Resource& resource) {
+    if (resource.kind == Resource::Kind::Tile) {
+        assert(resource.tileData);
+        const auto& tile = *resource.tileData;
+        return tile.urlTemplate + '\n' + util::toString(tile.pixelRatio) + '/' + util::toString(tile.z) +
+               '/' + util::toString(tile.x) + '/' + util::toString(tile.y);
+    }
+    return resource.url;
+}
+
+ResourceMemoryCache::Shard& ResourceMemoryCache::shard(const std::string& key_) {
+    return shards[std::hash<std::string>()(key_) % shardCount];
+}
+
+const ResourceMemoryCache::Shard& ResourceMemoryCache::shard(const std::string& key_) const {
+    return shards[std::hash<std::string>()(key_) % shardCount];
+}
+
+optional<Response> ResourceMemoryCache::get(const Resource& resource) {
+    if (maximumShardSize == 0) {
+        return nullopt;
+    }
+
+    const std::string key_ = key(resource);
+    Shard& shard_ = shard(key_);
+    std::lock_guard<std::mutex> lock(shard_.mutex);
+
+    auto it = shard_.index.find(key_);
+    if (it == shard_.index.end()) {
+        ++misses;
+        return nullopt;
+    }
+
+    ++hits;
+    shard_.entries.splice(shard_.entries.begin(), shard_.entries, it->second);
+    return it->second->response;
+}
+
+void ResourceMemoryCache::put(const Resource& resource, const Response& response) {
+    if (maximumShardSize == 0 || response.error) {
+        return;
+    }
+
+    const std::string key_ = key(resource);
+    Shard& shard_ = shard(key_);
+    std::lock_guard<std::mutex> lock(shard_.mutex);
+
+    auto it = shard_.index.find(key_);
+
+    if (response.notModified) {
+        if (it != shard_.index.end()) {
+            it->second->response.expires = response.expires;
+            it->second->response.mustRevalidate = response.mustRevalidate;
+            shard_.entries.splice(shard_.entries.begin(), shard_.entries, it->second);
+        }
+        return;
+    }
+
+    Entry entry { key_, {}, key_.size() + (response.data ? response.data->size() : 0) };
+    entry.response.etag = response.etag;
+    entry.response.expires = response.expires;
+    entry.response.mustRevalidate = response.mustRevalidate;
+    entry.response.modified = response.modified;
+    entry.response.data = response.data;
+    entry.response.noContent = !response.data;
+
+    if (it != shard_.index.end()) {
+        shard_.size -= it->second->size;
+        shard_.entries.erase(it->second);
+        shard_.index.erase(it);
+    }
+
+    // Entries that would take up more than the whole budget of their shard aren't kept.
+    if (entry.size > maximumShardSize) {
+        return;
+    }
+
+    shard_.size += entry.size;
+    shard_.entries.push_front(std::move(entry));
+    shard_.index.emplace(key_, shard_.entries.begin());
+    evict(shard_, maximumShardSize);
+}
+
+bool ResourceMemoryCache::contains(const Resource& resource, const Response& response) const {
+    if (!response.data) {
+        return false;
+    }
+
+    const std::string key_ = key(resource);
+    const Shard& shard_ = shard(key_);
+    std::lock_guard<std::mutex> lock(shard_.mutex);
+
+    auto it = shard_.index.find(key_);
+    if (it == shard_.index.end()) {
+        return false;
+    }
+
+    const Response& cached = it->second->response;
+    return cached.data == response.data && cached.expires == response.expires &&
+           cached.mustRevalidate == response.mustRevalidate && cached.modified == response.modified &&
+           cached.etag == response.etag;
+}
+
+void ResourceMemoryCache::remove(const Resource& resource) {
+    const std::string key_ = key(resource);
+    Shard& shard_ = shard(key_);
+    std::lock_guard<std::mutex> lock(shard_.mutex);
+
+    auto it = shard_.index.find(key_);
+    if (it != shard_.index.end()) {
+        shard_.size -= it->second->size;
+        shard_.entries.erase(it->second);
+        shard_.index.erase(it);
+    }
+}
+
+void ResourceMemoryCache::clear() {
+    for (auto& shard_ : shards) {
+        std::lock_guard<std::mutex> lock(shard_.mutex);
+        shard_.entries.clear();
+        shard_.index.clear();
+        shard_.size = 0;
+    }
+}
+
+void ResourceMemoryCache::evict(Shard& shard_, uint64_t maximumSize) {
+    while (shard_.size > maximumSize) {
+        assert(!shard_.entries.empty());
+        const Entry& entry = shard_.entries.back();
+        shard_.size -= entry.size;
+        shard_.index.erase(entry.key);
+        shard_.entries.pop_back();
+    }
+}
+
+ResourceMemoryCache::Stats ResourceMemoryCache::getStats() const {
+    Stats stats;
+    stats.hits = hits;
+    stats.misses = misses;
+    for (auto& shard_ : shards) {
+        std::lock_guard<std::mutex> lock(shard_.mutex);
+        stats.entries += shard_.entries.size();
+        stats.size += shard_.size;
+    }
+    return stats;
+}
+
+} // namespace mbgl
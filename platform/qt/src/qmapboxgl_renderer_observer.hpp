@@ -41,6 +41,10 @@ public:
         delegate.invoke(&mbgl::RendererObserver::onDidFinishRenderingFrame, mode, repaintNeeded);
     }
 
+    void onRenderingStats(const mbgl::RenderingStats& stats) final {
+        delegate.invoke(&mbgl::RendererObserver::onRenderingStats, stats);
+    }
+
     void onDidFinishRenderingMap() final {
         delegate.invoke(&mbgl::RendererObserver::onDidFinishRenderingMap);
     }
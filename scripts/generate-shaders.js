@@ -11,6 +11,16 @@ var shaders = require('../mapbox-gl-js/src/shaders');
 
 require('./style-code');
 
+// Instanced circles draw one shared quad per circle. They reuse the circle shaders, but read the
+// quad corner from a_pos and the circle center from the per-instance a_center attribute.
+shaders.circleInstanced = {
+    vertexSource: shaders.circle.vertexSource
+        .replace('attribute vec2 a_pos;', 'attribute vec2 a_pos;\nattribute vec2 a_center;')
+        .replace(/\/\/ unencode the extrusion vector[^]*?floor\(a_pos \* 0\.5\);/,
+                 'vec2 extrude = a_pos;\n    vec2 circle_center = a_center;'),
+    fragmentSource: shaders.circle.fragmentSource
+};
+
 let concatenated = '';
 let offsets = {};
 
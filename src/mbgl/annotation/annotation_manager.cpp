@@ -10,9 +10,17 @@
 #include <mbgl/style/layers/symbol_layer.hpp>
 #include <mbgl/style/layers/symbol_layer_impl.hpp>
 #include <mbgl/style/expression/dsl.hpp>
+#include <mbgl/math/clamp.hpp>
+#include <mbgl/util/constants.hpp>
+
+#include <mapbox/geometry/for_each_point.hpp>
 
 #include <boost/function_output_iterator.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <set>
+
 // Note: LayerManager::annotationsEnabled is defined
 // at compile time, so that linker (with LTO on) is able
 // to optimize out the unreachable code.
@@ -53,7 +61,6 @@ AnnotationID AnnotationManager::addAnnotation(const Annotation& annotation) {
     Annotation::visit(annotation, [&] (const auto& annotation_) {
         this->add(id, annotation_);
     });
-    dirty = true;
     return id;
 }
 
@@ -63,34 +70,123 @@ bool AnnotationManager::updateAnnotation(const AnnotationID& id, const Annotatio
     Annotation::visit(annotation, [&] (const auto& annotation_) {
         this->update(id, annotation_);
     });
-    return dirty;
+    return !dirtyAreas.empty();
 }
 
 void AnnotationManager::removeAnnotation(const AnnotationID& id) {
     CHECK_ANNOTATIONS_ENABLED_AND_RETURN();
     std::lock_guard<std::mutex> lock(mutex);
     remove(id);
-    dirty = true;
+}
+
+std::vector<AnnotationID> AnnotationManager::addAnnotations(const std::vector<Annotation>& annotations) {
+    CHECK_ANNOTATIONS_ENABLED_AND_RETURN({});
+    std::lock_guard<std::mutex> lock(mutex);
+    std::vector<AnnotationID> ids;
+    ids.reserve(annotations.size());
+    for (const auto& annotation : annotations) {
+        AnnotationID id = nextID++;
+        Annotation::visit(annotation, [&] (const auto& annotation_) {
+            this->add(id, annotation_);
+        });
+        ids.push_back(id);
+    }
+    return ids;
+}
+
+bool AnnotationManager::updateAnnotations(const std::vector<std::pair<AnnotationID, Annotation>>& annotations) {
+    CHECK_ANNOTATIONS_ENABLED_AND_RETURN(true);
+    std::lock_guard<std::mutex> lock(mutex);
+    for (const auto& annotation : annotations) {
+        Annotation::visit(annotation.second, [&] (const auto& annotation_) {
+            this->update(annotation.first, annotation_);
+        });
+    }
+    return !dirtyAreas.empty();
+}
+
+void AnnotationManager::removeAnnotations(const std::vector<AnnotationID>& ids) {
+    CHECK_ANNOTATIONS_ENABLED_AND_RETURN();
+    std::lock_guard<std::mutex> lock(mutex);
+    for (const auto& id : ids) {
+        remove(id);
+    }
 }
 
 void AnnotationManager::add(const AnnotationID& id, const SymbolAnnotation& annotation) {
     auto impl = std::make_shared<SymbolAnnotationImpl>(id, annotation);
     symbolTree.insert(impl);
     symbolAnnotations.emplace(id, impl);
+    dirtyAreas.push_back(symbolBounds(*impl));
 }
 
 void AnnotationManager::add(const AnnotationID& id, const LineAnnotation& annotation) {
-    ShapeAnnotationImpl& impl = *shapeAnnotations.emplace(id,
-        std::make_unique<LineAnnotationImpl>(id, annotation)).first->second;
-    impl.updateStyle(*style.get().impl);
+    insertShape(std::make_unique<LineAnnotationImpl>(id, annotation));
 }
 
 void AnnotationManager::add(const AnnotationID& id, const FillAnnotation& annotation) {
-    ShapeAnnotationImpl& impl = *shapeAnnotations.emplace(id,
-        std::make_unique<FillAnnotationImpl>(id, annotation)).first->second;
+    insertShape(std::make_unique<FillAnnotationImpl>(id, annotation));
+}
+
+void AnnotationManager::insertShape(std::unique_ptr<ShapeAnnotationImpl> shape) {
+    const AnnotationID id = shape->id;
+    ShapeAnnotationImpl& impl = *shapeAnnotations.emplace(id, std::move(shape)).first->second;
+    if (auto bounds = shapeBounds(impl)) {
+        shapeTree.insert({ *bounds, id });
+        dirtyAreas.push_back(*bounds);
+    }
     impl.updateStyle(*style.get().impl);
 }
 
+// Removes the shape, but not its style layer.
+void AnnotationManager::eraseShape(const AnnotationID& id) {
+    auto it = shapeAnnotations.find(id);
+    if (auto bounds = shapeBounds(*it->second)) {
+        shapeTree.remove(std::make_pair(*bounds, id));
+        dirtyAreas.push_back(*bounds);
+    }
+    shapeAnnotations.erase(it);
+}
+
+// Projects the same way geojson-vt does.
+static boost::geometry::model::point<double, 2, boost::geometry::cs::cartesian> project(const Point<double>& point) {
+    const double sine = std::sin(point.y * util::DEG2RAD);
+    const double y = 0.5 - 0.25 * std::log((1 + sine) / (1 - sine)) / M_PI;
+    return { point.x / 360 + 0.5, util::clamp(y, 0.0, 1.0) };
+}
+
+optional<AnnotationManager::AnnotationBox> AnnotationManager::shapeBounds(const ShapeAnnotationImpl& shape) {
+    optional<AnnotationBox> bounds;
+    ShapeAnnotationGeometry::visit(shape.geometry(), [&] (const auto& geometry) {
+        mapbox::geometry::for_each_point(geometry, [&] (const Point<double>& point) {
+            const auto projected = project(point);
+            if (!bounds) {
+                bounds = AnnotationBox { projected, projected };
+            } else {
+                boost::geometry::expand(*bounds, projected);
+            }
+        });
+    });
+    return bounds;
+}
+
+AnnotationManager::AnnotationBox AnnotationManager::symbolBounds(const SymbolAnnotationImpl& symbol) {
+    const auto projected = project(symbol.annotation.geometry);
+    return { projected, projected };
+}
+
+std::array<AnnotationManager::AnnotationBox, 3> AnnotationManager::tileAreas(const CanonicalTileID& tileID) {
+    const double scale = std::pow(2, tileID.z);
+    const double buffer = double(ShapeAnnotationImpl::buffer) / util::EXTENT;
+    const auto area = [&] (double wrap) {
+        return AnnotationBox {
+            { (tileID.x - buffer) / scale + wrap, (tileID.y - buffer) / scale },
+            { (tileID.x + 1 + buffer) / scale + wrap, (tileID.y + 1 + buffer) / scale }
+        };
+    };
+    return {{ area(-1), area(0), area(1) }};
+}
+
 void AnnotationManager::update(const AnnotationID& id, const SymbolAnnotation& annotation) {
     auto it = symbolAnnotations.find(id);
     if (it == symbolAnnotations.end()) {
@@ -101,8 +197,6 @@ void AnnotationManager::update(const AnnotationID& id, const SymbolAnnotation& a
     const SymbolAnnotation& existing = it->second->annotation;
 
     if (existing.geometry != annotation.geometry || existing.icon != annotation.icon) {
-        dirty = true;
-
         remove(id);
         add(id, annotation);
     }
@@ -115,9 +209,8 @@ void AnnotationManager::update(const AnnotationID& id, const LineAnnotation& ann
         return;
     }
 
-    shapeAnnotations.erase(it);
+    eraseShape(id);
     add(id, annotation);
-    dirty = true;
 }
 
 void AnnotationManager::update(const AnnotationID& id, const FillAnnotation& annotation) {
@@ -127,20 +220,19 @@ void AnnotationManager::update(const AnnotationID& id, const FillAnnotation& ann
         return;
     }
 
-    shapeAnnotations.erase(it);
+    eraseShape(id);
     add(id, annotation);
-    dirty = true;
 }
 
 void AnnotationManager::remove(const AnnotationID& id) {
     CHECK_ANNOTATIONS_ENABLED_AND_RETURN();
     if (symbolAnnotations.find(id) != symbolAnnotations.end()) {
+        dirtyAreas.push_back(symbolBounds(*symbolAnnotations.at(id)));
         symbolTree.remove(symbolAnnotations.at(id));
         symbolAnnotations.erase(id);
     } else if (shapeAnnotations.find(id) != shapeAnnotations.end()) {
-        auto it = shapeAnnotations.find(id);
-        *style.get().impl->removeLayer(it->second->layerID);
-        shapeAnnotations.erase(it);
+        *style.get().impl->removeLayer(shapeAnnotations.at(id)->layerID);
+        eraseShape(id);
     } else {
         assert(false); // Should never happen
     }
@@ -167,8 +259,16 @@ std::unique_ptr<AnnotationTileData> AnnotationManager::getTileData(const Canonic
             val->updateLayer(tileID, *pointLayer);
         }));
 
-    for (const auto& shape : shapeAnnotations) {
-        shape.second->updateTileData(tileID, *tileData);
+    std::set<AnnotationID> shapes;
+    for (const auto& area : tileAreas(tileID)) {
+        shapeTree.query(boost::geometry::index::intersects(area),
+            boost::make_function_output_iterator([&](const auto& val){
+                shapes.insert(val.second);
+            }));
+    }
+
+    for (const AnnotationID id : shapes) {
+        shapeAnnotations.at(id)->updateTileData(tileID, *tileData);
     }
 
     return tileData;
@@ -211,12 +311,22 @@ void AnnotationManager::updateStyle() {
 void AnnotationManager::updateData() {
     CHECK_ANNOTATIONS_ENABLED_AND_RETURN();
     std::lock_guard<std::mutex> lock(mutex);
-    if (dirty) {
-        for (auto& tile : tiles) {
+    if (dirtyAreas.empty()) {
+        return;
+    }
+
+    for (auto& tile : tiles) {
+        const auto areas = tileAreas(tile->id.canonical);
+        const bool touched = std::any_of(dirtyAreas.begin(), dirtyAreas.end(), [&] (const AnnotationBox& dirtyArea) {
+            return std::any_of(areas.begin(), areas.end(), [&] (const AnnotationBox& area) {
+                return boost::geometry::intersects(dirtyArea, area);
+            });
+        });
+        if (touched) {
             tile->setData(getTileData(tile->id.canonical));
         }
-        dirty = false;
     }
+    dirtyAreas.clear();
 }
 
 void AnnotationManager::addTile(AnnotationTile& tile) {
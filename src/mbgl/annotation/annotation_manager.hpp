@@ -4,7 +4,9 @@
 #include <mbgl/annotation/symbol_annotation_impl.hpp>
 #include <mbgl/style/image.hpp>
 #include <mbgl/util/noncopyable.hpp>
+#include <mbgl/util/optional.hpp>
 
+#include <array>
 #include <mutex>
 #include <string>
 #include <vector>
@@ -32,6 +34,10 @@ public:
     bool updateAnnotation(const AnnotationID&, const Annotation&);
     void removeAnnotation(const AnnotationID&);
 
+    std::vector<AnnotationID> addAnnotations(const std::vector<Annotation>&);
+    bool updateAnnotations(const std::vector<std::pair<AnnotationID, Annotation>>&);
+    void removeAnnotations(const std::vector<AnnotationID>&);
+
     void addImage(std::unique_ptr<style::Image>);
     void removeImage(const std::string&);
     double getTopOffsetPixelsForImage(const std::string&);
@@ -49,6 +55,10 @@ public:
     static const std::string ShapeLayerID;
 
 private:
+    // Annotations are located by their bounds in projected coordinates, where the world spans 0..1
+    // on both axes.
+    using AnnotationBox = boost::geometry::model::box<boost::geometry::model::point<double, 2, boost::geometry::cs::cartesian>>;
+
     void add(const AnnotationID&, const SymbolAnnotation&);
     void add(const AnnotationID&, const LineAnnotation&);
     void add(const AnnotationID&, const FillAnnotation&);
@@ -59,6 +69,15 @@ private:
 
     void remove(const AnnotationID&);
 
+    void insertShape(std::unique_ptr<ShapeAnnotationImpl>);
+    void eraseShape(const AnnotationID&);
+    static optional<AnnotationBox> shapeBounds(const ShapeAnnotationImpl&);
+    static AnnotationBox symbolBounds(const SymbolAnnotationImpl&);
+
+    // The areas that annotations in a tile may come from: the tile with its buffer, and its copies
+    // on either side of the antimeridian.
+    static std::array<AnnotationBox, 3> tileAreas(const CanonicalTileID&);
+
     void updateStyle();
 
     std::unique_ptr<AnnotationTileData> getTileData(const CanonicalTileID&);
@@ -67,11 +86,16 @@ private:
 
     std::mutex mutex;
 
-    bool dirty = false;
-    
+    // The areas in which annotations changed since tiles were last updated. Only the tiles that
+    // intersect them get their data rebuilt.
+    std::vector<AnnotationBox> dirtyAreas;
+
     AnnotationID nextID = 0;
 
     using SymbolAnnotationTree = boost::geometry::index::rtree<std::shared_ptr<const SymbolAnnotationImpl>, boost::geometry::index::rstar<16, 4>>;
+    // Shape annotations are indexed by their bounds, so that only the shapes that may reach into a
+    // tile get tiled for it.
+    using ShapeAnnotationTree = boost::geometry::index::rtree<std::pair<AnnotationBox, AnnotationID>, boost::geometry::index::rstar<16, 4>>;
     // Unlike std::unordered_map, std::map is guaranteed to sort by AnnotationID, ensuring that older annotations are below newer annotations.
     // <https://github.com/mapbox/mapbox-gl-native/issues/5691>
     using SymbolAnnotationMap = std::map<AnnotationID, std::shared_ptr<SymbolAnnotationImpl>>;
@@ -80,6 +104,7 @@ private:
 
     SymbolAnnotationTree symbolTree;
     SymbolAnnotationMap symbolAnnotations;
+    ShapeAnnotationTree shapeTree;
     ShapeAnnotationMap shapeAnnotations;
     ImageMap images;
 
@@ -72,6 +72,14 @@ RenderAnnotationSource::queryRenderedFeatures(const ScreenLineString& geometry,
     return tilePyramid.queryRenderedFeatures(geometry, transformState, layers, options, projMatrix);
 }
 
+void RenderAnnotationSource::prepareRenderedQuery(RenderedFeatureQuery& query,
+                                                  const ScreenLineString& geometry,
+                                                  const TransformState& transformState,
+                                                  const std::vector<const RenderLayer*>& layers,
+                                                  const mat4& projMatrix) const {
+    tilePyramid.prepareRenderedQuery(query, geometry, transformState, layers, projMatrix);
+}
+
 std::vector<Feature> RenderAnnotationSource::querySourceFeatures(const SourceQueryOptions&) const {
     return {};
 }
@@ -31,6 +31,12 @@ public:
                           const RenderedQueryOptions& options,
                           const mat4& projMatrix) const final;
 
+    void prepareRenderedQuery(RenderedFeatureQuery&,
+                              const ScreenLineString& geometry,
+                              const TransformState& transformState,
+                              const std::vector<const RenderLayer*>& layers,
+                              const mat4& projMatrix) const final;
+
     std::vector<Feature>
     querySourceFeatures(const SourceQueryOptions&) const final;
 
@@ -13,6 +13,8 @@ namespace mbgl {
 using namespace style;
 namespace geojsonvt = mapbox::geojsonvt;
 
+constexpr uint16_t ShapeAnnotationImpl::buffer;
+
 ShapeAnnotationImpl::ShapeAnnotationImpl(const AnnotationID id_)
     : id(id_),
       layerID(AnnotationManager::ShapeLayerID + util::toString(id)) {
@@ -30,7 +32,7 @@ void ShapeAnnotationImpl::updateTileData(const CanonicalTileID& tileID, Annotati
         // The annotation source is currently hard coded to maxzoom 16, so we're topping out at z16
         // here as well.
         options.maxZoom = 16;
-        options.buffer = 255u;
+        options.buffer = buffer;
         options.extent = util::EXTENT;
         options.tolerance = baseTolerance;
         shapeTiler = std::make_unique<mapbox::geojsonvt::GeoJSONVT>(features, options);
@@ -25,6 +25,9 @@ public:
 
     void updateTileData(const CanonicalTileID&, AnnotationTileData&);
 
+    // The buffer around tiles, in tile units, within which shapes are included in them.
+    static constexpr uint16_t buffer = 255;
+
     const AnnotationID id;
     const std::string layerID;
     std::unique_ptr<mapbox::geojsonvt::GeoJSONVT> shapeTiler;
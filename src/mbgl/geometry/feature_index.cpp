@@ -166,7 +166,7 @@ void FeatureIndex::addFeature(
             continue;
         }
 
-        result[layerID].push_back(convertFeature(*geometryTileFeature, tileID));
+        result[layerID].push_back(convertFeature(*geometryTileFeature, tileID, options.properties, options.geometry));
     }
 }
 
@@ -17,5 +17,15 @@ optional<AttributeBinding> offsetAttributeBinding(const optional<AttributeBindin
     }
 }
 
+optional<AttributeBinding> perInstanceAttributeBinding(const optional<AttributeBinding>& binding) {
+    if (binding) {
+        AttributeBinding result = *binding;
+        result.vertexDivisor = 1;
+        return result;
+    } else {
+        return binding;
+    }
+}
+
 } // namespace gfx
 } // namespace mbgl
@@ -88,12 +88,15 @@ public:
     uint8_t vertexStride;
     const VertexBufferResource* vertexBufferResource;
     uint32_t vertexOffset;
+    // Number of instances that share one vertex. 0 advances the attribute per vertex.
+    uint32_t vertexDivisor;
 
     friend bool operator==(const AttributeBinding& lhs, const AttributeBinding& rhs) {
         return lhs.attribute == rhs.attribute &&
                lhs.vertexStride == rhs.vertexStride &&
                lhs.vertexBufferResource == rhs.vertexBufferResource &&
-               lhs.vertexOffset == rhs.vertexOffset;
+               lhs.vertexOffset == rhs.vertexOffset &&
+               lhs.vertexDivisor == rhs.vertexDivisor;
     }
 };
 
@@ -252,10 +255,12 @@ AttributeBinding attributeBinding(const VertexBuffer<detail::VertexType<As...>>&
         Descriptor::data.stride,
         &buffer.getResource(),
         0,
+        0,
     };
 }
 
 optional<gfx::AttributeBinding> offsetAttributeBinding(const optional<gfx::AttributeBinding>& binding, std::size_t vertexOffset);
+optional<gfx::AttributeBinding> perInstanceAttributeBinding(const optional<gfx::AttributeBinding>& binding);
 
 template <class>
 class AttributeBindings;
@@ -280,6 +285,11 @@ public:
         return { offsetAttributeBinding(Base::template get<As>(), vertexOffset)... };
     }
 
+    // Advances all present attributes once per instance instead of once per vertex.
+    AttributeBindings perInstance() const {
+        return { perInstanceAttributeBinding(Base::template get<As>())... };
+    }
+
     uint32_t activeCount() const {
         uint32_t result = 0;
         util::ignore({ ((result += bool(Base::template get<As>())), 0)... });
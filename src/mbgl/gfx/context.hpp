@@ -4,6 +4,7 @@
 #include <mbgl/gfx/command_encoder.hpp>
 #include <mbgl/gfx/draw_scope.hpp>
 #include <mbgl/gfx/program.hpp>
+#include <mbgl/gfx/rendering_stats.hpp>
 #include <mbgl/gfx/types.hpp>
 #include <mbgl/gfx/texture.hpp>
 
@@ -26,6 +27,8 @@ public:
     static constexpr const uint32_t minimumRequiredVertexBindingCount = 8;
     const uint32_t maximumVertexBindingCount;
     bool supportsHalfFloatTextures = false;
+    // Per-instance vertex attributes and instanced draw calls are available.
+    bool supportsInstancing = false;
 
 public:
     Context(Context&&) = delete;
@@ -38,6 +41,14 @@ public:
     // Called at the end of a frame.
     virtual void performCleanup() = 0;
 
+    // Returns the counters accumulated since this context was created.
+    virtual RenderingStats getRenderingStats() const = 0;
+
+    // Returns the number of draw calls issued since this context was created. Unlike
+    // getRenderingStats(), this doesn't sum up the state counters, and is cheap enough to be
+    // read around every layer.
+    virtual std::size_t getDrawCallCount() const = 0;
+
 public:
     virtual std::unique_ptr<OffscreenTexture>
         createOffscreenTexture(Size,
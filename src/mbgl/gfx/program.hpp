@@ -49,6 +49,23 @@ public:
                       const IndexBuffer&,
                       std::size_t indexOffset,
                       std::size_t indexLength) = 0;
+
+    // Draws the index range once per instance. Only available if the context supportsInstancing.
+    virtual void drawInstanced(Context&,
+                               RenderPass&,
+                               const DrawMode&,
+                               const DepthMode&,
+                               const StencilMode&,
+                               const ColorMode&,
+                               const CullFaceMode&,
+                               const UniformValues<UniformList>&,
+                               DrawScope&,
+                               const AttributeBindings<AttributeList>&,
+                               const TextureBindings<TextureList>&,
+                               const IndexBuffer&,
+                               std::size_t indexOffset,
+                               std::size_t indexLength,
+                               std::size_t instanceCount) = 0;
 };
 
 } // namespace gfx
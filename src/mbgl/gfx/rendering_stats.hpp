@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstddef>
+
+namespace mbgl {
+namespace gfx {
+
+// Counters accumulated by a context over its lifetime. Subtract two snapshots to obtain the
+// work done in between, e.g. during a single frame.
+class RenderingStats {
+public:
+    std::size_t numDrawCalls = 0;
+    // State changes that resulted in an actual graphics API call.
+    std::size_t numStateChanges = 0;
+    // State changes that were elided because the value was already current.
+    std::size_t numRedundantStateChanges = 0;
+    std::size_t bufferUploadBytes = 0;
+    std::size_t textureUploadBytes = 0;
+
+    RenderingStats operator-(const RenderingStats& rhs) const {
+        RenderingStats result;
+        result.numDrawCalls = numDrawCalls - rhs.numDrawCalls;
+        result.numStateChanges = numStateChanges - rhs.numStateChanges;
+        result.numRedundantStateChanges = numRedundantStateChanges - rhs.numRedundantStateChanges;
+        result.bufferUploadBytes = bufferUploadBytes - rhs.bufferUploadBytes;
+        result.textureUploadBytes = textureUploadBytes - rhs.textureUploadBytes;
+        return result;
+    }
+};
+
+} // namespace gfx
+} // namespace mbgl
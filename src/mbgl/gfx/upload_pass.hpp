@@ -42,6 +42,16 @@ public:
         updateVertexBufferResource(buffer.getResource(), v.data(), v.bytes());
     }
 
+    // Uploads only the vertices in [start, end) to an existing buffer.
+    template <class Vertex>
+    void updateVertexBufferSub(VertexBuffer<Vertex>& buffer, const VertexVector<Vertex>& v,
+                               std::size_t start, std::size_t end) {
+        assert(v.elements() == buffer.elements);
+        assert(start < end && end <= v.elements());
+        updateVertexBufferResourceSub(buffer.getResource(), start * sizeof(Vertex),
+                                      v.data() + start, (end - start) * sizeof(Vertex));
+    }
+
     template <class DrawMode>
     IndexBuffer createIndexBuffer(IndexVector<DrawMode>&& v,
                                   const BufferUsageType usage = BufferUsageType::StaticDraw) {
@@ -59,6 +69,8 @@ protected:
     createVertexBufferResource(const void* data, std::size_t size, const BufferUsageType) = 0;
     virtual void
     updateVertexBufferResource(VertexBufferResource&, const void* data, std::size_t size) = 0;
+    virtual void
+    updateVertexBufferResourceSub(VertexBufferResource&, std::size_t offset, const void* data, std::size_t size) = 0;
 
     virtual std::unique_ptr<IndexBufferResource>
     createIndexBufferResource(const void* data, std::size_t size, const BufferUsageType) = 0;
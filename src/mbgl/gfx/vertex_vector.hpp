@@ -2,6 +2,7 @@
 
 #include <mbgl/util/ignore.hpp>
 
+#include <cassert>
 #include <vector>
 
 namespace mbgl {
@@ -34,6 +35,11 @@ public:
         v.clear();
     }
 
+    Vertex& at(std::size_t n) {
+        assert(n < v.size());
+        return v.at(n);
+    }
+
     const Vertex* data() const {
         return v.data();
     }
@@ -9,6 +9,7 @@
 #include <mbgl/gl/command_encoder.hpp>
 #include <mbgl/gl/debugging_extension.hpp>
 #include <mbgl/gl/vertex_array_extension.hpp>
+#include <mbgl/gl/instancing_extension.hpp>
 #include <mbgl/util/traits.hpp>
 #include <mbgl/util/std.hpp>
 #include <mbgl/util/logging.hpp>
@@ -104,6 +105,14 @@ void Context::initializeExtensions(const std::function<gl::ProcAddress(const cha
                 vertexArray = std::make_unique<extension::VertexArray>(fn);
         }
 
+        if (!disableInstancingExtension) {
+            instancing = std::make_unique<extension::Instancing>(fn);
+            // Instanced programs bind one attribute more than their per-vertex counterparts, so
+            // only use them if that doesn't push layers past the guaranteed attribute count.
+            supportsInstancing = supportsInstancedDrawing() &&
+                                 maximumVertexBindingCount > minimumRequiredVertexBindingCount;
+        }
+
 #if MBGL_USE_GLES2
         constexpr const char* halfFloatExtensionName = "OES_texture_half_float";
         constexpr const char* halfFloatColorBufferExtensionName = "EXT_color_buffer_half_float";
@@ -220,6 +229,12 @@ bool Context::supportsVertexArrays() const {
            vertexArray->deleteVertexArrays;
 }
 
+bool Context::supportsInstancedDrawing() const {
+    return instancing &&
+           instancing->vertexAttribDivisor &&
+           instancing->drawElementsInstanced;
+}
+
 VertexArray Context::createVertexArray() {
     if (supportsVertexArrays()) {
         VertexArrayID id = 0;
@@ -578,6 +593,57 @@ void Context::setColorMode(const gfx::ColorMode& color) {
     colorMask = color.mask;
 }
 
+gfx::RenderingStats Context::getRenderingStats() const {
+    gfx::RenderingStats result = stats;
+    // Attribute bindings of individual vertex arrays are not included.
+    auto add = [&result](const auto& state) {
+        result.numStateChanges += state.getIssuedChanges();
+        result.numRedundantStateChanges += state.getSkippedChanges();
+    };
+    add(activeTextureUnit);
+    add(bindFramebuffer);
+    add(viewport);
+    add(scissorTest);
+    for (const auto& tex : texture) {
+        add(tex);
+    }
+    add(program);
+    add(vertexBuffer);
+    add(bindVertexArray);
+    add(globalVertexArrayState.indexBuffer);
+    add(pixelStorePack);
+    add(pixelStoreUnpack);
+#if not MBGL_USE_GLES2
+    add(pixelZoom);
+    add(rasterPos);
+    add(pixelTransferDepth);
+    add(pixelTransferStencil);
+    add(pointSize);
+#endif // MBGL_USE_GLES2
+    add(stencilFunc);
+    add(stencilMask);
+    add(stencilTest);
+    add(stencilOp);
+    add(depthRange);
+    add(depthMask);
+    add(depthTest);
+    add(depthFunc);
+    add(blend);
+    add(blendEquation);
+    add(blendFunc);
+    add(blendColor);
+    add(colorMask);
+    add(clearDepth);
+    add(clearColor);
+    add(clearStencil);
+    add(lineWidth);
+    add(bindRenderbuffer);
+    add(cullFace);
+    add(cullFaceSide);
+    add(cullFaceWinding);
+    return result;
+}
+
 std::unique_ptr<gfx::CommandEncoder> Context::createCommandEncoder() {
     backend.updateAssumedState();
     if (backend.contextIsShared()) {
@@ -586,9 +652,7 @@ std::unique_ptr<gfx::CommandEncoder> Context::createCommandEncoder() {
     return std::make_unique<gl::CommandEncoder>(*this);
 }
 
-void Context::draw(const gfx::DrawMode& drawMode,
-                   std::size_t indexOffset,
-                   std::size_t indexLength) {
+void Context::setDrawModeSize(const gfx::DrawMode& drawMode) {
     switch (drawMode.type) {
     case gfx::DrawModeType::Points:
 #if not MBGL_USE_GLES2
@@ -604,12 +668,37 @@ void Context::draw(const gfx::DrawMode& drawMode,
     default:
         break;
     }
+}
+
+void Context::draw(const gfx::DrawMode& drawMode,
+                   std::size_t indexOffset,
+                   std::size_t indexLength) {
+    setDrawModeSize(drawMode);
 
     MBGL_CHECK_ERROR(glDrawElements(
         Enum<gfx::DrawModeType>::to(drawMode.type),
         static_cast<GLsizei>(indexLength),
         GL_UNSIGNED_SHORT,
         reinterpret_cast<GLvoid*>(sizeof(uint16_t) * indexOffset)));
+
+    stats.numDrawCalls++;
+}
+
+void Context::drawInstanced(const gfx::DrawMode& drawMode,
+                            std::size_t indexOffset,
+                            std::size_t indexLength,
+                            std::size_t instanceCount) {
+    assert(supportsInstancedDrawing());
+    setDrawModeSize(drawMode);
+
+    MBGL_CHECK_ERROR(instancing->drawElementsInstanced(
+        Enum<gfx::DrawModeType>::to(drawMode.type),
+        static_cast<GLsizei>(indexLength),
+        GL_UNSIGNED_SHORT,
+        reinterpret_cast<GLvoid*>(sizeof(uint16_t) * indexOffset),
+        static_cast<GLsizei>(instanceCount)));
+
+    stats.numDrawCalls++;
 }
 
 void Context::performCleanup() {
@@ -32,6 +32,7 @@ class RendererBackend;
 namespace extension {
 class VertexArray;
 class Debugging;
+class Instancing;
 } // namespace extension
 
 class Context final : public gfx::Context {
@@ -92,6 +93,12 @@ public:
               std::size_t indexOffset,
               std::size_t indexLength);
 
+    // Draws the indexed range once per instance. Requires supportsInstancing.
+    void drawInstanced(const gfx::DrawMode&,
+                       std::size_t indexOffset,
+                       std::size_t indexLength,
+                       std::size_t instanceCount);
+
     // Actually remove the objects we marked as abandoned with the above methods.
     // Only call this while the OpenGL context is exclusive to this thread.
     void performCleanup() override;
@@ -112,6 +119,19 @@ public:
 
     void setDirtyState();
 
+    gfx::RenderingStats getRenderingStats() const override;
+    std::size_t getDrawCallCount() const override {
+        return stats.numDrawCalls;
+    }
+
+    void didUploadBuffer(std::size_t size) {
+        stats.bufferUploadBytes += size;
+    }
+
+    void didUploadTexture(std::size_t size) {
+        stats.textureUploadBytes += size;
+    }
+
     extension::Debugging* getDebuggingExtension() const {
         return debugging.get();
     }
@@ -120,6 +140,10 @@ public:
         return vertexArray.get();
     }
 
+    extension::Instancing* getInstancingExtension() const {
+        return instancing.get();
+    }
+
     void setCleanupOnDestruction(bool cleanup) {
         cleanupOnDestruction = cleanup;
     }
@@ -127,9 +151,11 @@ public:
 private:
     RendererBackend& backend;
     bool cleanupOnDestruction = true;
+    gfx::RenderingStats stats;
 
     std::unique_ptr<extension::Debugging> debugging;
     std::unique_ptr<extension::VertexArray> vertexArray;
+    std::unique_ptr<extension::Instancing> instancing;
 
 public:
     State<value::ActiveTextureUnit> activeTextureUnit;
@@ -201,6 +227,8 @@ private:
 
     VertexArray createVertexArray();
     bool supportsVertexArrays() const;
+    bool supportsInstancedDrawing() const;
+    void setDrawModeSize(const gfx::DrawMode&);
 
     friend detail::ProgramDeleter;
     friend detail::ShaderDeleter;
@@ -223,6 +251,7 @@ private:
 public:
     // For testing
     bool disableVAOExtension = false;
+    bool disableInstancingExtension = false;
 
 #if not defined(NDEBUG)
 public:
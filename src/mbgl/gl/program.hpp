@@ -99,6 +99,51 @@ public:
               std::size_t indexLength) override {
         auto& context = static_cast<gl::Context&>(genericContext);
 
+        bind(context, depthMode, stencilMode, colorMode, cullFaceMode, uniformValues,
+             drawScope, attributeBindings, textureBindings, indexBuffer);
+
+        context.draw(drawMode,
+                     indexOffset,
+                     indexLength);
+    }
+
+    void drawInstanced(gfx::Context& genericContext,
+                       gfx::RenderPass&,
+                       const gfx::DrawMode& drawMode,
+                       const gfx::DepthMode& depthMode,
+                       const gfx::StencilMode& stencilMode,
+                       const gfx::ColorMode& colorMode,
+                       const gfx::CullFaceMode& cullFaceMode,
+                       const gfx::UniformValues<UniformList>& uniformValues,
+                       gfx::DrawScope& drawScope,
+                       const gfx::AttributeBindings<AttributeList>& attributeBindings,
+                       const gfx::TextureBindings<TextureList>& textureBindings,
+                       const gfx::IndexBuffer& indexBuffer,
+                       std::size_t indexOffset,
+                       std::size_t indexLength,
+                       std::size_t instanceCount) override {
+        auto& context = static_cast<gl::Context&>(genericContext);
+
+        bind(context, depthMode, stencilMode, colorMode, cullFaceMode, uniformValues,
+             drawScope, attributeBindings, textureBindings, indexBuffer);
+
+        context.drawInstanced(drawMode,
+                              indexOffset,
+                              indexLength,
+                              instanceCount);
+    }
+
+private:
+    void bind(gl::Context& context,
+              const gfx::DepthMode& depthMode,
+              const gfx::StencilMode& stencilMode,
+              const gfx::ColorMode& colorMode,
+              const gfx::CullFaceMode& cullFaceMode,
+              const gfx::UniformValues<UniformList>& uniformValues,
+              gfx::DrawScope& drawScope,
+              const gfx::AttributeBindings<AttributeList>& attributeBindings,
+              const gfx::TextureBindings<TextureList>& textureBindings,
+              const gfx::IndexBuffer& indexBuffer) {
         context.setDepthMode(depthMode);
         context.setStencilMode(stencilMode);
         context.setColorMode(colorMode);
@@ -127,13 +172,8 @@ public:
         vertexArray.bind(context,
                         indexBuffer,
                         instance.attributeLocations.toBindingArray(attributeBindings));
-
-        context.draw(drawMode,
-                     indexOffset,
-                     indexLength);
     }
 
-private:
     std::map<uint32_t, std::unique_ptr<Instance>> instances;
 };
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <tuple>
 
 namespace mbgl {
@@ -24,6 +25,9 @@ public:
         if (*this != value) {
             setCurrentValue(value);
             set(std::index_sequence_for<Args...>{});
+            ++issuedChanges;
+        } else {
+            ++skippedChanges;
         }
     }
 
@@ -54,6 +58,16 @@ public:
         return dirty;
     }
 
+    // Number of assignments that resulted in an OpenGL call, and those that were elided
+    // because the value was already current.
+    std::size_t getIssuedChanges() const {
+        return issuedChanges;
+    }
+
+    std::size_t getSkippedChanges() const {
+        return skippedChanges;
+    }
+
 private:
     template <std::size_t... I>
     void set(std::index_sequence<I...>) {
@@ -63,6 +77,8 @@ private:
 private:
     typename T::Type currentValue = T::Default;
     bool dirty = true;
+    std::size_t issuedChanges = 0;
+    std::size_t skippedChanges = 0;
     const std::tuple<Args...> params;
 };
 
@@ -12,6 +12,16 @@ namespace gl {
 
 using namespace platform;
 
+namespace {
+
+std::size_t textureByteSize(const Size size, gfx::TexturePixelType format, gfx::TextureChannelDataType type) {
+    const std::size_t channels = format == gfx::TexturePixelType::RGBA ? 4 : 1;
+    const std::size_t channelSize = type == gfx::TextureChannelDataType::HalfFloat ? 2 : 1;
+    return std::size_t(size.width) * size.height * channels * channelSize;
+}
+
+} // namespace
+
 UploadPass::UploadPass(gl::CommandEncoder& commandEncoder_, const char* name)
     : commandEncoder(commandEncoder_), debugGroup(commandEncoder.createDebugGroup(name)) {
 }
@@ -24,6 +34,7 @@ std::unique_ptr<gfx::VertexBufferResource> UploadPass::createVertexBufferResourc
     commandEncoder.context.vertexBuffer = result;
     MBGL_CHECK_ERROR(
         glBufferData(GL_ARRAY_BUFFER, size, data, Enum<gfx::BufferUsageType>::to(usage)));
+    commandEncoder.context.didUploadBuffer(size);
     return std::make_unique<gl::VertexBufferResource>(std::move(result));
 }
 
@@ -32,6 +43,16 @@ void UploadPass::updateVertexBufferResource(gfx::VertexBufferResource& resource,
                                             std::size_t size) {
     commandEncoder.context.vertexBuffer = static_cast<gl::VertexBufferResource&>(resource).buffer;
     MBGL_CHECK_ERROR(glBufferSubData(GL_ARRAY_BUFFER, 0, size, data));
+    commandEncoder.context.didUploadBuffer(size);
+}
+
+void UploadPass::updateVertexBufferResourceSub(gfx::VertexBufferResource& resource,
+                                               std::size_t offset,
+                                               const void* data,
+                                               std::size_t size) {
+    commandEncoder.context.vertexBuffer = static_cast<gl::VertexBufferResource&>(resource).buffer;
+    MBGL_CHECK_ERROR(glBufferSubData(GL_ARRAY_BUFFER, offset, size, data));
+    commandEncoder.context.didUploadBuffer(size);
 }
 
 std::unique_ptr<gfx::IndexBufferResource> UploadPass::createIndexBufferResource(
@@ -43,6 +64,7 @@ std::unique_ptr<gfx::IndexBufferResource> UploadPass::createIndexBufferResource(
     commandEncoder.context.globalVertexArrayState.indexBuffer = result;
     MBGL_CHECK_ERROR(
         glBufferData(GL_ELEMENT_ARRAY_BUFFER, size, data, Enum<gfx::BufferUsageType>::to(usage)));
+    commandEncoder.context.didUploadBuffer(size);
     return std::make_unique<gl::IndexBufferResource>(std::move(result));
 }
 
@@ -55,6 +77,7 @@ void UploadPass::updateIndexBufferResource(gfx::IndexBufferResource& resource,
     commandEncoder.context.globalVertexArrayState.indexBuffer =
         static_cast<gl::IndexBufferResource&>(resource).buffer;
     MBGL_CHECK_ERROR(glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, size, data));
+    commandEncoder.context.didUploadBuffer(size);
 }
 
 std::unique_ptr<gfx::TextureResource>
@@ -88,6 +111,9 @@ void UploadPass::updateTextureResource(gfx::TextureResource& resource,
                                   size.width, size.height, 0,
                                   Enum<gfx::TexturePixelType>::to(format),
                                   Enum<gfx::TextureChannelDataType>::to(type), data));
+    if (data) {
+        commandEncoder.context.didUploadTexture(textureByteSize(size, format, type));
+    }
 }
 
 void UploadPass::updateTextureResourceSub(gfx::TextureResource& resource,
@@ -103,6 +129,7 @@ void UploadPass::updateTextureResourceSub(gfx::TextureResource& resource,
     MBGL_CHECK_ERROR(glTexSubImage2D(GL_TEXTURE_2D, 0, xOffset, yOffset, size.width, size.height,
                                      Enum<gfx::TexturePixelType>::to(format),
                                      Enum<gfx::TextureChannelDataType>::to(type), data));
+    commandEncoder.context.didUploadTexture(textureByteSize(size, format, type));
 }
 
 void UploadPass::pushDebugGroup(const char* name) {
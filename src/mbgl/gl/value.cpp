@@ -2,6 +2,7 @@
 #include <mbgl/gl/context.hpp>
 #include <mbgl/gl/vertex_buffer_resource.hpp>
 #include <mbgl/gl/vertex_array_extension.hpp>
+#include <mbgl/gl/instancing_extension.hpp>
 #include <mbgl/gl/enum.hpp>
 
 namespace mbgl {
@@ -495,6 +496,10 @@ void VertexAttribute::Set(const Type& binding, Context& context, AttributeLocati
             static_cast<GLboolean>(false),
             static_cast<GLsizei>(binding->vertexStride),
             reinterpret_cast<GLvoid*>(binding->attribute.offset + (binding->vertexStride * binding->vertexOffset))));
+        // The divisor is part of the attribute state, so reset it for per-vertex attributes too.
+        if (context.supportsInstancing) {
+            MBGL_CHECK_ERROR(context.getInstancingExtension()->vertexAttribDivisor(location, binding->vertexDivisor));
+        }
     } else {
         MBGL_CHECK_ERROR(glDisableVertexAttribArray(location));
     }
@@ -409,6 +409,30 @@ void Map::removeAnnotation(AnnotationID annotation) {
     }
 }
 
+std::vector<AnnotationID> Map::addAnnotations(const std::vector<Annotation>& annotations) {
+    if (LayerManager::annotationsEnabled) {
+        auto result = impl->annotationManager.addAnnotations(annotations);
+        impl->onUpdate();
+        return result;
+    }
+    return {};
+}
+
+void Map::updateAnnotations(const std::vector<std::pair<AnnotationID, Annotation>>& annotations) {
+    if (LayerManager::annotationsEnabled) {
+        if (impl->annotationManager.updateAnnotations(annotations)) {
+            impl->onUpdate();
+        }
+    }
+}
+
+void Map::removeAnnotations(const std::vector<AnnotationID>& annotations) {
+    if (LayerManager::annotationsEnabled) {
+        impl->annotationManager.removeAnnotations(annotations);
+        impl->onUpdate();
+    }
+}
+
 #pragma mark - Toggles
 
 void Map::setDebug(MapDebugOptions debugOptions) {
@@ -0,0 +1,4 @@
+#pragma once
+
+// Alias
+#include <mbgl/programs/circle_program.hpp>
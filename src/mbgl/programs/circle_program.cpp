@@ -4,7 +4,9 @@
 namespace mbgl {
 
 template std::unique_ptr<gfx::Program<CircleProgram>> gfx::Context::createProgram(const ProgramParameters&);
+template std::unique_ptr<gfx::Program<CircleInstancedProgram>> gfx::Context::createProgram(const ProgramParameters&);
 
 static_assert(sizeof(CircleLayoutVertex) == 4, "expected CircleLayoutVertex size");
+static_assert(sizeof(CircleInstanceVertex) == 4, "expected CircleInstanceVertex size");
 
 } // namespace mbgl
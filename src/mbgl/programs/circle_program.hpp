@@ -49,11 +49,65 @@ public:
 using CircleLayoutVertex = CircleProgram::LayoutVertex;
 using CircleAttributes = CircleProgram::AttributeList;
 
+// Draws every circle as an instance of one shared quad. The quad corners are the only
+// per-vertex attribute; the circle center and the data-driven paint attributes advance
+// once per instance.
+class CircleInstancedProgram : public Program<
+    CircleInstancedProgram,
+    gfx::PrimitiveType::Triangle,
+    TypeList<
+        attributes::pos,
+        attributes::center>,
+    TypeList<
+        uniforms::matrix,
+        uniforms::scale_with_map,
+        uniforms::extrude_scale,
+        uniforms::device_pixel_ratio,
+        uniforms::camera_to_center_distance,
+        uniforms::pitch_with_map>,
+    TypeList<>,
+    style::CirclePaintProperties>
+{
+public:
+    using Program::Program;
+
+    using QuadVertex = gfx::Vertex<TypeList<attributes::pos>>;
+    using InstanceVertex = gfx::Vertex<TypeList<attributes::center>>;
+
+    /*
+     * @param {number} ex extrude normal
+     * @param {number} ey extrude normal
+     */
+    static QuadVertex quadVertex(int16_t ex, int16_t ey) {
+        return QuadVertex { {{ ex, ey }} };
+    }
+
+    static InstanceVertex instanceVertex(Point<int16_t> p) {
+        return InstanceVertex { {{ p.x, p.y }} };
+    }
+
+    static AttributeBindings computeAllAttributeBindings(
+        const gfx::VertexBuffer<QuadVertex>& quadVertexBuffer,
+        const gfx::VertexBuffer<InstanceVertex>& instanceVertexBuffer,
+        const Binders& paintPropertyBinders,
+        const typename PaintProperties::PossiblyEvaluated& currentProperties) {
+        return gfx::AttributeBindings<TypeList<attributes::pos>>(quadVertexBuffer)
+            .concat(gfx::AttributeBindings<TypeList<attributes::center>>(instanceVertexBuffer).perInstance())
+            .concat(paintPropertyBinders.attributeBindings(currentProperties).perInstance());
+    }
+};
+
+using CircleQuadVertex = CircleInstancedProgram::QuadVertex;
+using CircleInstanceVertex = CircleInstancedProgram::InstanceVertex;
+using CircleInstancedAttributes = CircleInstancedProgram::AttributeList;
+
 class CircleLayerPrograms final : public LayerTypePrograms  {
 public:
     CircleLayerPrograms(gfx::Context& context, const ProgramParameters& programParameters)
-        : circle(context, programParameters) {}
+        : circle(context, programParameters),
+          circleInstanced(context, programParameters) {}
     CircleProgram circle;
+    CircleInstancedProgram circleInstanced;
 };
 
 } // namespace mbgl
@@ -10,454 +10,486 @@ namespace programs {
 namespace gl {
 
 constexpr const uint8_t compressedShaderSource[] = {
-    0x78, 0xda, 0xed, 0x3d, 0xfd, 0x6f, 0xe3, 0x36, 0xb2, 0xf7, 0x73, 0xfe, 0x0a, 0x17, 0x05, 0x0e,
-    0x92, 0x2c, 0x5b, 0xb6, 0x93, 0xec, 0x47, 0x75, 0x7a, 0xc5, 0xa2, 0xbb, 0xed, 0x0b, 0xd0, 0xee,
-    0x2e, 0x36, 0xed, 0xbd, 0xc3, 0x15, 0x0b, 0x43, 0xb2, 0x65, 0x47, 0xef, 0x6c, 0xcb, 0x4f, 0x56,
-    0x12, 0x3b, 0x87, 0xfc, 0xef, 0x8f, 0x33, 0xfc, 0x10, 0x49, 0x51, 0xf2, 0x47, 0x62, 0x27, 0x9b,
-    0x33, 0x8a, 0x6e, 0x2c, 0x72, 0x38, 0x1c, 0x92, 0xc3, 0xe1, 0xcc, 0x90, 0x1c, 0x7e, 0x9f, 0x8c,
-    0x86, 0xf1, 0xa8, 0xf1, 0xcb, 0xaf, 0xfd, 0x0f, 0x97, 0x27, 0xf3, 0x2c, 0x1e, 0x24, 0x8b, 0x24,
-    0x9d, 0x35, 0xae, 0x92, 0xf1, 0xd5, 0xbc, 0x31, 0x9a, 0xa4, 0x61, 0xee, 0x9f, 0x7c, 0x1f, 0x4f,
-    0x16, 0xf1, 0xc9, 0xf7, 0xc9, 0xa8, 0xf1, 0x1d, 0x81, 0x4d, 0x66, 0xf1, 0xd0, 0x9a, 0xa4, 0xb7,
-    0x73, 0xfb, 0xe4, 0x7b, 0xfa, 0xd9, 0x80, 0x2f, 0x02, 0x35, 0x1b, 0x26, 0x23, 0x15, 0x6c, 0x1a,
-    0x0f, 0x93, 0xeb, 0xa9, 0x04, 0xc9, 0x12, 0x8c, 0xc0, 0x58, 0x67, 0x01, 0x8a, 0x9f, 0x02, 0x90,
-    0xfe, 0xb9, 0x89, 0x07, 0xbd, 0xc6, 0xf5, 0x6c, 0x1e, 0x0e, 0xfe, 0xd5, 0x47, 0xe2, 0xac, 0x41,
-    0x3a, 0x5b, 0xe4, 0x94, 0xd0, 0x06, 0x24, 0xc7, 0xc3, 0xbf, 0x87, 0x93, 0xeb, 0xd8, 0x6e, 0xfc,
-    0x3b, 0x99, 0xf1, 0x94, 0x8b, 0x59, 0x8e, 0x89, 0x01, 0x49, 0xb2, 0x64, 0x20, 0x1f, 0x60, 0x6e,
-    0x3a, 0x81, 0x0a, 0xe6, 0xf5, 0xce, 0x5f, 0xf9, 0x59, 0x9c, 0x5f, 0x67, 0xb3, 0x06, 0x54, 0x68,
-    0xdd, 0x74, 0x5c, 0x15, 0xa2, 0x75, 0xd3, 0x71, 0x08, 0x90, 0xed, 0xdf, 0xcb, 0x04, 0xa5, 0xe4,
-    0xdf, 0x24, 0x5f, 0x19, 0x48, 0xfa, 0x44, 0x73, 0x18, 0x51, 0xe4, 0x7f, 0x96, 0x20, 0x11, 0xc4,
-    0x41, 0xbc, 0x9e, 0x52, 0x35, 0x6d, 0x64, 0x51, 0xc2, 0xf6, 0xba, 0xbd, 0xd7, 0xed, 0x8e, 0x3b,
-    0x4d, 0x87, 0x6a, 0x41, 0xb7, 0xd7, 0xee, 0xd8, 0x94, 0xa0, 0xb3, 0xc6, 0x30, 0x1e, 0xa4, 0xc3,
-    0xb8, 0x3f, 0x48, 0x27, 0x69, 0xc6, 0xc8, 0x41, 0x42, 0xe3, 0x19, 0xa4, 0x0f, 0x7f, 0x82, 0x74,
-    0x42, 0x4c, 0x51, 0xd1, 0x99, 0xa5, 0x74, 0xaa, 0x0c, 0xf7, 0x67, 0xe7, 0x2b, 0x21, 0xea, 0xfc,
-    0x9c, 0x54, 0x5a, 0x0d, 0xd3, 0xe5, 0x30, 0x27, 0x84, 0x04, 0xda, 0x72, 0x06, 0x3c, 0x4d, 0x96,
-    0x7d, 0x6c, 0x89, 0x44, 0x86, 0x34, 0x04, 0xae, 0xdc, 0x59, 0x79, 0x41, 0x13, 0x29, 0x26, 0x8f,
-    0x14, 0x21, 0xc2, 0x95, 0x3f, 0xbb, 0x5f, 0xdd, 0x9c, 0x37, 0x56, 0xaa, 0x48, 0x6b, 0xf0, 0x19,
-    0xab, 0x09, 0x69, 0x5c, 0x94, 0xaa, 0x42, 0x88, 0x69, 0x32, 0xc3, 0xec, 0x40, 0xe9, 0x33, 0xa4,
-    0x58, 0x2e, 0x5c, 0x10, 0xc0, 0xbe, 0x49, 0x8b, 0x6d, 0x9f, 0x62, 0x08, 0x97, 0x1b, 0x61, 0xe8,
-    0x69, 0x18, 0x4e, 0x01, 0x83, 0xd4, 0x5c, 0x4e, 0x89, 0xcb, 0x11, 0xf2, 0x26, 0xf6, 0x1a, 0xe3,
-    0x38, 0xef, 0xcf, 0xc3, 0x3c, 0x8f, 0xb3, 0x59, 0x7f, 0x9e, 0x2e, 0x94, 0xbe, 0x4c, 0x96, 0xf1,
-    0x84, 0xd4, 0x99, 0x66, 0xc3, 0xfe, 0xf5, 0x7c, 0x1e, 0x67, 0x6e, 0x45, 0x26, 0x99, 0xa3, 0x5a,
-    0x26, 0x43, 0xb8, 0x48, 0xee, 0xb4, 0x61, 0x48, 0x26, 0x71, 0xff, 0x7a, 0x96, 0xe4, 0x8b, 0x7e,
-    0x9e, 0xf6, 0x11, 0xc7, 0x42, 0x29, 0x98, 0x2e, 0x68, 0xef, 0xf5, 0x1a, 0xe9, 0x68, 0xb4, 0x88,
-    0xf3, 0x00, 0xb8, 0x91, 0xff, 0x5f, 0x26, 0x48, 0xae, 0xc8, 0x86, 0x79, 0xd3, 0xee, 0x98, 0xd2,
-    0x9a, 0x65, 0x6a, 0x15, 0x28, 0xde, 0x57, 0x96, 0x89, 0x3e, 0x87, 0x10, 0xd5, 0xa4, 0xd4, 0xd8,
-    0x9e, 0x5c, 0xcc, 0xbf, 0x3f, 0xf9, 0xcb, 0xf7, 0x66, 0x19, 0xc7, 0x64, 0xd1, 0xf3, 0x93, 0x72,
-    0x7f, 0x21, 0xf4, 0x67, 0x49, 0x74, 0x9d, 0xc7, 0xb4, 0xc3, 0x43, 0x18, 0x74, 0x9f, 0xb4, 0x78,
-    0x94, 0x66, 0x53, 0xc2, 0x6f, 0x39, 0x61, 0xfa, 0x3e, 0xf9, 0x93, 0x25, 0x4b, 0xff, 0x26, 0x4d,
-    0x86, 0x24, 0x29, 0x99, 0x59, 0x64, 0x4c, 0xc6, 0x93, 0xfe, 0xe7, 0x74, 0x91, 0xe4, 0xa4, 0x75,
-    0x01, 0x87, 0x70, 0x70, 0x7a, 0x23, 0x0a, 0xb7, 0xe3, 0x76, 0x6d, 0xe8, 0x10, 0x8e, 0x8a, 0xce,
-    0x1f, 0xca, 0xb1, 0x02, 0x3f, 0x9b, 0xbe, 0x5c, 0x9c, 0x95, 0x6a, 0xf8, 0x39, 0x0b, 0xc7, 0x94,
-    0xe1, 0x59, 0x49, 0xa7, 0x80, 0x3d, 0x61, 0x5d, 0xfd, 0xe9, 0xef, 0x1f, 0xbe, 0xbc, 0xff, 0xf2,
-    0xee, 0x7f, 0xfa, 0x17, 0x1f, 0x2f, 0x3f, 0x7f, 0xf8, 0xe9, 0xf7, 0x4f, 0x5f, 0x4e, 0x94, 0x92,
-    0x48, 0x53, 0x97, 0x48, 0x2c, 0x9f, 0xb7, 0x59, 0xa2, 0x4a, 0x6d, 0xa0, 0x44, 0x2b, 0x91, 0xb4,
-    0x7d, 0x79, 0x6c, 0xfb, 0x61, 0x6d, 0x6e, 0x54, 0xca, 0xd5, 0x59, 0xb3, 0x0e, 0x00, 0x39, 0xb0,
-    0xd4, 0x29, 0x8b, 0x41, 0x38, 0x91, 0xeb, 0x55, 0xd3, 0xa3, 0x52, 0xba, 0x89, 0x57, 0x7d, 0xe3,
-    0xf0, 0xde, 0x84, 0xd9, 0x2a, 0x99, 0x8d, 0x69, 0xd2, 0x0d, 0x24, 0x91, 0x6a, 0x0c, 0x89, 0xd1,
-    0x0e, 0x43, 0xce, 0xd0, 0x05, 0xba, 0x1c, 0x31, 0x74, 0x89, 0x6b, 0xe8, 0x05, 0x57, 0xb4, 0xdb,
-    0xd1, 0x07, 0xc0, 0x35, 0x37, 0xd1, 0xc5, 0xca, 0x79, 0xc5, 0xd1, 0x83, 0x2b, 0x8e, 0xf4, 0x8a,
-    0xa3, 0x35, 0x15, 0xab, 0x4c, 0x2e, 0xb3, 0x46, 0x3e, 0xa9, 0x66, 0x9b, 0x28, 0xab, 0xce, 0x23,
-    0xe5, 0xa2, 0x9a, 0x72, 0xa5, 0xbc, 0x3c, 0x5e, 0xa2, 0xfc, 0xd1, 0x39, 0x62, 0x2a, 0xf1, 0xb4,
-    0x3e, 0xd5, 0x78, 0xfa, 0x22, 0x9c, 0xce, 0x27, 0x71, 0xd6, 0x7b, 0x4f, 0xf2, 0x92, 0x69, 0x38,
-    0x8e, 0x77, 0xe5, 0x0e, 0xcc, 0x41, 0x0c, 0xd8, 0xab, 0x28, 0xa8, 0x59, 0x69, 0x17, 0xa7, 0x1f,
-    0x17, 0xe8, 0x01, 0xac, 0x40, 0x6a, 0x27, 0x79, 0xa2, 0x0d, 0xae, 0xda, 0x43, 0x52, 0x46, 0x81,
-    0x9a, 0x2d, 0x86, 0x28, 0x10, 0xba, 0x01, 0xc9, 0x27, 0xb2, 0x3a, 0xee, 0xbd, 0xb7, 0x58, 0x03,
-    0x5c, 0xca, 0x0e, 0x2a, 0x39, 0x84, 0x31, 0x0a, 0x82, 0x22, 0x95, 0xa0, 0x5e, 0x99, 0xa2, 0xa8,
-    0x8a, 0xa2, 0xc8, 0x48, 0x51, 0x3f, 0x92, 0x69, 0xea, 0x99, 0x69, 0xea, 0xd9, 0xbe, 0x22, 0x98,
-    0xa0, 0x52, 0xda, 0x06, 0x97, 0x16, 0x73, 0x71, 0xc4, 0xec, 0xc3, 0xc8, 0xb8, 0x28, 0x4d, 0x27,
-    0x42, 0x98, 0xdc, 0x26, 0xf9, 0x15, 0x01, 0x98, 0xeb, 0xb9, 0xf3, 0x24, 0x1f, 0x5c, 0x95, 0x73,
-    0x19, 0xdb, 0x91, 0x46, 0x66, 0xd7, 0x44, 0x0b, 0x41, 0x1c, 0x22, 0x13, 0x96, 0x2e, 0xc1, 0x6d,
-    0xc3, 0xf8, 0x26, 0x19, 0xc4, 0x6c, 0xb6, 0x65, 0x21, 0x11, 0x1d, 0x02, 0x4e, 0x52, 0xfb, 0x61,
-    0x5d, 0x08, 0xa7, 0x71, 0x16, 0xc2, 0xe4, 0x1a, 0xc4, 0x33, 0xd2, 0xd9, 0xfd, 0x61, 0xb2, 0xc8,
-    0xc3, 0xd9, 0x20, 0x5e, 0x2b, 0xc1, 0x4e, 0x09, 0x3b, 0x0e, 0xc3, 0x3c, 0xc4, 0xce, 0x9a, 0x41,
-    0x6f, 0xfd, 0xf7, 0xbb, 0xcb, 0xfe, 0x1f, 0x1f, 0x2f, 0x7e, 0xfe, 0xf4, 0xe5, 0xb7, 0x3e, 0x5b,
-    0x37, 0x4e, 0x8c, 0xd4, 0x61, 0x56, 0x3f, 0x97, 0xaa, 0xa0, 0x44, 0xe1, 0x50, 0x86, 0x6c, 0xad,
-    0xe2, 0x55, 0x49, 0x59, 0x34, 0x83, 0xad, 0xe2, 0x6a, 0x7b, 0x94, 0x65, 0x4e, 0x5a, 0x94, 0x0d,
-    0x84, 0x65, 0x21, 0x59, 0xb9, 0x17, 0x66, 0xca, 0x68, 0x9e, 0x42, 0x1a, 0x57, 0x21, 0x58, 0x2f,
-    0x50, 0x08, 0x41, 0x9d, 0xa2, 0x60, 0x34, 0x58, 0xa6, 0x46, 0xa1, 0x0a, 0xc3, 0x2b, 0x59, 0x43,
-    0x65, 0x34, 0xb9, 0xae, 0xe8, 0x3d, 0xc8, 0x51, 0x28, 0xc4, 0x5c, 0x46, 0x1e, 0x64, 0x0a, 0xe2,
-    0xa4, 0x62, 0x98, 0xae, 0xd1, 0x55, 0xc2, 0xba, 0x86, 0x24, 0x36, 0x3b, 0xcc, 0xe5, 0x59, 0x66,
-    0x25, 0x61, 0x42, 0xd5, 0x28, 0xd3, 0x56, 0xcc, 0xba, 0x6a, 0xf2, 0x24, 0x98, 0x1a, 0x0a, 0x17,
-    0x79, 0x96, 0xfe, 0x2b, 0xae, 0x63, 0x3d, 0x19, 0xa2, 0x9a, 0x03, 0x65, 0x28, 0x13, 0x23, 0x2a,
-    0xf9, 0x75, 0xfc, 0xa8, 0x03, 0xae, 0xa7, 0xfd, 0x36, 0x19, 0xe6, 0x57, 0xb5, 0xb4, 0x23, 0x44,
-    0x1d, 0x8b, 0xca, 0x70, 0x15, 0x8c, 0xaa, 0x80, 0xac, 0x61, 0x57, 0x1d, 0x76, 0x7d, 0x1b, 0x6a,
-    0x19, 0x45, 0x85, 0xa9, 0xe4, 0x17, 0x15, 0xcc, 0xc4, 0x36, 0x1a, 0x44, 0x1d, 0xf7, 0x94, 0x41,
-    0xa9, 0xab, 0x41, 0xac, 0xa3, 0xf0, 0x8b, 0xac, 0xa5, 0xb5, 0xa2, 0x6c, 0x40, 0x15, 0x62, 0xdd,
-    0x14, 0x65, 0xf2, 0xca, 0x15, 0x62, 0xcd, 0xe6, 0xa4, 0xe8, 0x92, 0x2b, 0xd8, 0x4a, 0x3e, 0xd1,
-    0x3f, 0x81, 0x6e, 0x63, 0x73, 0x09, 0xe4, 0x16, 0xc2, 0x4a, 0x54, 0x68, 0x12, 0x46, 0xc1, 0x36,
-    0xf2, 0x06, 0xfe, 0x31, 0xd4, 0x08, 0xc9, 0x2e, 0x17, 0x3c, 0xa2, 0x36, 0x4d, 0xba, 0x04, 0x5b,
-    0xc9, 0x10, 0xf6, 0xd7, 0x50, 0x19, 0xcb, 0x71, 0x25, 0x91, 0x62, 0xaa, 0x52, 0x20, 0xd8, 0x45,
-    0x34, 0xc8, 0x1f, 0xa6, 0x11, 0x95, 0xf3, 0x5d, 0x5d, 0x68, 0x98, 0xc6, 0x57, 0x45, 0xb8, 0xf3,
-    0xb4, 0x97, 0x3f, 0x0c, 0x5d, 0x23, 0x67, 0xbb, 0xba, 0x3c, 0xa8, 0xe0, 0x02, 0x15, 0xe5, 0x03,
-    0x26, 0xb3, 0xfa, 0x59, 0x4d, 0x5d, 0x31, 0x7e, 0xfa, 0x4c, 0x37, 0x0d, 0xa3, 0x8e, 0xb5, 0x72,
-    0xaa, 0xa2, 0x6f, 0x8b, 0x2a, 0x3e, 0x01, 0x56, 0x08, 0x6a, 0x25, 0xb5, 0x7f, 0xc0, 0x2d, 0xe6,
-    0x90, 0x7f, 0x5a, 0x85, 0x76, 0x39, 0x48, 0xb2, 0x01, 0xd1, 0xaf, 0xa8, 0x4e, 0x13, 0x90, 0xaa,
-    0x70, 0x58, 0x09, 0xb0, 0xd3, 0x69, 0x9f, 0xdb, 0x3e, 0x31, 0xd6, 0x2d, 0x5d, 0xcb, 0xe2, 0xaa,
-    0xf4, 0x20, 0xcd, 0x66, 0x44, 0x0f, 0x9a, 0x73, 0x8b, 0x4b, 0x41, 0xc5, 0x4a, 0xaa, 0xda, 0x1b,
-    0x29, 0xa9, 0x15, 0x6a, 0x06, 0x8c, 0x54, 0xc7, 0xa2, 0x93, 0xaf, 0x29, 0xf7, 0x3b, 0x68, 0x9a,
-    0xaa, 0x0e, 0x77, 0xdf, 0x80, 0x7e, 0x61, 0xee, 0xaa, 0x79, 0x96, 0xfe, 0x6f, 0x3c, 0xc8, 0xe3,
-    0x21, 0x27, 0x5f, 0xb5, 0xf9, 0x14, 0x7a, 0xa8, 0xed, 0xf7, 0xb0, 0xda, 0x1d, 0x4b, 0xaf, 0xb1,
-    0x7d, 0xeb, 0xd5, 0x68, 0x86, 0xc4, 0xf2, 0xaa, 0xb6, 0x48, 0x35, 0x52, 0x98, 0x3b, 0x82, 0x35,
-    0xaf, 0xa6, 0x58, 0xb9, 0x51, 0x15, 0x3d, 0x2d, 0xe1, 0x68, 0x2f, 0x57, 0xdb, 0x36, 0xb5, 0x4e,
-    0xe1, 0x35, 0x50, 0xb9, 0x43, 0x0d, 0x72, 0xe9, 0x5b, 0xff, 0xfe, 0x5e, 0xe2, 0xf5, 0x70, 0x96,
-    0x27, 0xe1, 0x24, 0x09, 0x17, 0x28, 0x2e, 0x09, 0xb3, 0x7a, 0x26, 0x45, 0xdd, 0x33, 0xd6, 0xe3,
-    0x53, 0x65, 0x1b, 0x58, 0xff, 0xd4, 0x62, 0x35, 0xb6, 0x97, 0x2e, 0xff, 0xb5, 0x72, 0x15, 0xe4,
-    0x68, 0x1c, 0x6f, 0xad, 0xab, 0xef, 0x5b, 0xe3, 0x3e, 0x8c, 0xce, 0xbc, 0x67, 0xe5, 0xf7, 0x70,
-    0xfa, 0xeb, 0x53, 0xe8, 0x9d, 0x4f, 0xa9, 0x2d, 0xee, 0x59, 0xc5, 0x63, 0xea, 0x5d, 0x15, 0xf3,
-    0x6f, 0xa2, 0xac, 0x55, 0x72, 0xf6, 0xc6, 0x8a, 0x57, 0x05, 0xcf, 0xae, 0x57, 0xa5, 0xaa, 0x19,
-    0x72, 0x53, 0x9d, 0x68, 0x0d, 0xb7, 0x6d, 0xaf, 0xcc, 0xac, 0x61, 0xa5, 0x9d, 0xd4, 0x90, 0xb5,
-    0x4c, 0xf2, 0x60, 0xd5, 0x01, 0xe5, 0x20, 0x91, 0xeb, 0x3e, 0x45, 0xc2, 0x85, 0xf7, 0x24, 0x9e,
-    0x8d, 0x09, 0x65, 0xf4, 0x0f, 0x17, 0xb0, 0xb6, 0x5f, 0x29, 0xbd, 0x19, 0x9e, 0x3b, 0x5f, 0xcb,
-    0x24, 0x6b, 0x28, 0xe6, 0xb7, 0xa6, 0xe1, 0xd2, 0x42, 0xbd, 0x59, 0x13, 0xcc, 0xca, 0x48, 0xf5,
-    0xf3, 0x60, 0x31, 0x4d, 0xd3, 0xfc, 0x6a, 0x91, 0xc7, 0x73, 0xab, 0xd3, 0xee, 0xb8, 0x3a, 0x22,
-    0x57, 0x25, 0x90, 0xaa, 0x38, 0x14, 0x07, 0x53, 0x47, 0x03, 0xb9, 0x2f, 0x1b, 0x7f, 0x6b, 0x10,
-    0x2c, 0xdd, 0xc6, 0x8f, 0xf0, 0xa7, 0xf1, 0x43, 0x43, 0xc2, 0x5e, 0xc2, 0x0c, 0xd5, 0x69, 0xd8,
-    0x29, 0xc3, 0x9a, 0x57, 0x20, 0xcd, 0x8b, 0x26, 0x5a, 0xe0, 0x08, 0x7f, 0x9a, 0xc3, 0x55, 0x3f,
-    0x99, 0x63, 0x1c, 0x4d, 0x2d, 0x94, 0x94, 0xe8, 0x07, 0xf8, 0xd8, 0xf6, 0xbd, 0x7b, 0x52, 0xbd,
-    0x21, 0x52, 0x90, 0xb3, 0xd6, 0xd5, 0xc7, 0x45, 0x93, 0xd9, 0x5f, 0x57, 0xe5, 0x18, 0xe6, 0xe9,
-    0x09, 0xd1, 0x4e, 0x66, 0x0b, 0xc8, 0xd9, 0x64, 0x2f, 0x81, 0xd5, 0x51, 0xb5, 0xc0, 0xdf, 0xc6,
-    0x64, 0x7a, 0xe7, 0x66, 0xc9, 0x49, 0xf3, 0xcc, 0xce, 0x10, 0xa8, 0x8d, 0xe6, 0x6b, 0x6e, 0x10,
-    0x5a, 0x98, 0x65, 0x19, 0x57, 0x22, 0x15, 0xfd, 0x21, 0x7c, 0x72, 0xdb, 0xa9, 0x10, 0x74, 0xb7,
-    0x53, 0xa6, 0xf5, 0x9f, 0x1f, 0xbe, 0x7c, 0x42, 0xb5, 0x0c, 0xb7, 0xb9, 0xbd, 0xee, 0xab, 0x76,
-    0xc7, 0x17, 0x9b, 0x78, 0xbf, 0xbc, 0xfb, 0xe3, 0xf2, 0xb2, 0xff, 0xd3, 0xa7, 0x0f, 0x3f, 0x93,
-    0xa9, 0x75, 0xfa, 0xf6, 0xcd, 0xdb, 0xb3, 0x5e, 0xef, 0x4d, 0xe7, 0xac, 0xd3, 0x3d, 0x3b, 0xed,
-    0xbd, 0xde, 0xd8, 0x93, 0xc0, 0xc6, 0x81, 0xfe, 0x31, 0xd8, 0x50, 0x34, 0xc3, 0x2d, 0x06, 0x45,
-    0x33, 0x36, 0xe5, 0x6e, 0x0f, 0xb6, 0xeb, 0x5b, 0xf3, 0x1a, 0xf5, 0xe8, 0xde, 0x05, 0x76, 0x5a,
-    0x02, 0x79, 0x7d, 0xd8, 0xdf, 0xc8, 0x62, 0xa3, 0x08, 0x2f, 0x83, 0xc5, 0xff, 0x65, 0xb9, 0xd5,
-    0x22, 0xc9, 0xce, 0x24, 0x1d, 0x5b, 0x30, 0x1a, 0x1e, 0x6d, 0xa0, 0x27, 0xcd, 0x06, 0xaf, 0x18,
-    0x08, 0xdb, 0xf6, 0x4e, 0xc9, 0x10, 0x09, 0xe6, 0x0f, 0x2e, 0x1d, 0xbd, 0x62, 0x5f, 0x13, 0xfe,
-    0x5c, 0x97, 0xa7, 0x44, 0x97, 0xec, 0x30, 0x6a, 0x7f, 0xa5, 0x0b, 0x3a, 0xcb, 0x75, 0xb3, 0xb1,
-    0xc9, 0x80, 0xa9, 0x94, 0x30, 0x8a, 0x12, 0x98, 0x99, 0x92, 0x5c, 0x50, 0x67, 0x42, 0x31, 0xa3,
-    0x77, 0x9a, 0xbc, 0x8f, 0x35, 0x01, 0xb7, 0x64, 0xe8, 0x4a, 0xbd, 0x89, 0x91, 0xb5, 0x09, 0x63,
-    0xd2, 0xdc, 0x61, 0xd0, 0x22, 0xdd, 0xe8, 0x90, 0x31, 0xc3, 0xff, 0x87, 0x69, 0x6e, 0x89, 0xb6,
-    0xbb, 0xe2, 0x17, 0xe7, 0x87, 0x9b, 0x70, 0x12, 0x50, 0x34, 0x8e, 0xd4, 0x75, 0x4e, 0x41, 0xb6,
-    0x13, 0x2f, 0xe7, 0xd6, 0x50, 0x5b, 0x96, 0x70, 0xe0, 0x48, 0x51, 0xd8, 0x69, 0xe2, 0xff, 0xdb,
-    0x07, 0xd8, 0xb3, 0xbe, 0x4d, 0xb3, 0xc9, 0x70, 0xd3, 0x5d, 0xdf, 0xad, 0xd6, 0x24, 0x87, 0x21,
-    0x97, 0xb6, 0x79, 0xdb, 0xcb, 0x20, 0xa4, 0x7f, 0xd9, 0xf7, 0x0a, 0xc4, 0x56, 0x8b, 0xa6, 0xad,
-    0x64, 0x06, 0x2c, 0xef, 0x32, 0x9a, 0x72, 0xe8, 0x9a, 0x9c, 0x91, 0x94, 0xea, 0x13, 0x02, 0x6b,
-    0x1a, 0xc1, 0x8e, 0x95, 0x18, 0x76, 0xe0, 0x10, 0xd8, 0x6e, 0x67, 0xd2, 0x46, 0x9d, 0x02, 0x55,
-    0x54, 0xee, 0xa2, 0x94, 0xc8, 0x5d, 0x98, 0x6b, 0xda, 0xb0, 0x3e, 0xe8, 0x10, 0x42, 0x67, 0x13,
-    0xe5, 0xa1, 0x94, 0x18, 0xce, 0x06, 0x57, 0x69, 0x66, 0xce, 0xe3, 0x13, 0xb6, 0x8c, 0x69, 0x12,
-    0x0e, 0x62, 0x03, 0x1f, 0x2c, 0xae, 0x92, 0x51, 0xee, 0x6f, 0xc4, 0x49, 0xf5, 0xda, 0x42, 0xb5,
-    0xfb, 0x82, 0x8f, 0x10, 0x9b, 0x3d, 0x9c, 0x14, 0x3d, 0x79, 0x96, 0xe6, 0x7f, 0x2c, 0x20, 0x5d,
-    0xdb, 0x43, 0x96, 0xfc, 0x4e, 0x9f, 0x53, 0x32, 0xdd, 0x4a, 0xac, 0x58, 0xf4, 0x07, 0xe5, 0x44,
-    0x79, 0xde, 0x17, 0x54, 0x31, 0x28, 0x4e, 0x55, 0xa0, 0x22, 0x6d, 0xdf, 0xaa, 0xc5, 0xd2, 0xc9,
-    0x04, 0xcf, 0xe9, 0xf4, 0xe7, 0x71, 0xb6, 0x98, 0x13, 0xb8, 0xe4, 0x26, 0xa6, 0x5e, 0x90, 0x60,
-    0x30, 0x21, 0x1c, 0x41, 0x86, 0xee, 0xbc, 0x09, 0x32, 0xc3, 0xaa, 0x69, 0xb9, 0x57, 0x59, 0xbb,
-    0x8d, 0x3a, 0xee, 0x19, 0x0c, 0xff, 0x5a, 0xc5, 0x8f, 0x8b, 0x0a, 0xdd, 0xfb, 0x63, 0x89, 0xd1,
-    0x6e, 0xb2, 0x61, 0x5c, 0xe3, 0xf3, 0x71, 0x6a, 0x5a, 0xe5, 0xf3, 0x61, 0x09, 0x38, 0xab, 0xe0,
-    0x14, 0x66, 0x63, 0x52, 0x24, 0xae, 0x64, 0xff, 0xcd, 0x2e, 0x03, 0xca, 0xac, 0x92, 0xc9, 0xfc,
-    0x2a, 0x0c, 0x48, 0xff, 0xf9, 0x46, 0x29, 0x87, 0x8d, 0xe6, 0x0d, 0x77, 0x10, 0x18, 0xbd, 0x6e,
-    0xbc, 0xaa, 0xc6, 0x7f, 0x35, 0x60, 0x2a, 0x9a, 0x14, 0x60, 0xa9, 0x24, 0x4e, 0x57, 0x56, 0xfa,
-    0x9e, 0x16, 0x67, 0x24, 0x19, 0xcb, 0x3b, 0x41, 0xbb, 0xeb, 0xdf, 0x1f, 0x64, 0x16, 0x3e, 0xab,
-    0xe9, 0xa6, 0xa5, 0x6b, 0xdb, 0xc8, 0x9a, 0x22, 0x60, 0x4e, 0xe6, 0x4a, 0xca, 0x71, 0xe6, 0x1a,
-    0x67, 0xae, 0x4c, 0xdf, 0x3c, 0x1c, 0x0e, 0x49, 0x07, 0xf6, 0x47, 0xe1, 0x20, 0x4f, 0xc1, 0xd7,
-    0xda, 0x2b, 0x4d, 0x6c, 0xc1, 0x3f, 0xa5, 0xe9, 0xac, 0x16, 0xde, 0xc7, 0xec, 0xe6, 0xe3, 0x1f,
-    0x84, 0xd1, 0xa2, 0x10, 0x30, 0xed, 0x95, 0x2d, 0x29, 0xb3, 0x05, 0x7d, 0x2a, 0x3d, 0xbe, 0xc6,
-    0x0f, 0xc1, 0x16, 0x3e, 0xee, 0x5a, 0xea, 0x25, 0xb5, 0x41, 0xac, 0xfe, 0x37, 0x04, 0x0a, 0x3d,
-    0xf0, 0xbc, 0xee, 0xe7, 0xc1, 0xf5, 0xba, 0x78, 0x93, 0x54, 0x8b, 0xad, 0x85, 0xdb, 0x60, 0x57,
-    0xa9, 0x36, 0x60, 0xe2, 0xac, 0xc7, 0x8f, 0x43, 0x2b, 0x04, 0x6b, 0x1e, 0x25, 0xad, 0x39, 0x76,
-    0xad, 0xfb, 0xa9, 0xd0, 0x85, 0x1d, 0x13, 0x4e, 0xdf, 0xe0, 0x52, 0xeb, 0x12, 0x8b, 0xd5, 0x08,
-    0xec, 0x19, 0x46, 0x51, 0xb1, 0xe0, 0xf8, 0xa8, 0xd4, 0x55, 0xc5, 0xf9, 0x07, 0x58, 0x2a, 0x1e,
-    0x8e, 0x63, 0xe4, 0x5b, 0xa3, 0xef, 0xa8, 0xd6, 0xc1, 0xd5, 0x52, 0x36, 0x30, 0xa1, 0xa7, 0x5b,
-    0x3a, 0xe6, 0x4a, 0x2f, 0x13, 0x75, 0x3f, 0xde, 0x1f, 0xee, 0xe0, 0xac, 0x61, 0x97, 0x63, 0xed,
-    0x31, 0xd9, 0x2d, 0xe9, 0xfb, 0xd6, 0x4e, 0x4e, 0x3d, 0xa7, 0x03, 0x40, 0x25, 0x03, 0xf5, 0xc9,
-    0xcf, 0x6d, 0x1c, 0xe0, 0x68, 0xc3, 0xa6, 0x3c, 0xfc, 0x24, 0xbb, 0x7c, 0x8f, 0xbc, 0x43, 0xb6,
-    0xe7, 0x9d, 0x9b, 0xad, 0xb6, 0x4f, 0x0c, 0xb6, 0xe8, 0xa3, 0x1c, 0x15, 0xdd, 0x42, 0x56, 0x18,
-    0xfd, 0x0d, 0x06, 0xab, 0xbc, 0x6a, 0x70, 0xae, 0xf3, 0x49, 0x32, 0xab, 0x3d, 0x1a, 0xa7, 0x80,
-    0x54, 0xcb, 0x18, 0x05, 0xcc, 0x24, 0x6b, 0x54, 0x80, 0x3a, 0xae, 0x2a, 0x41, 0xbe, 0x20, 0xd9,
-    0xa3, 0x76, 0xb8, 0xf2, 0x65, 0x92, 0x45, 0x0a, 0x80, 0x5b, 0x1a, 0x0c, 0x93, 0x6c, 0xd2, 0x70,
-    0xee, 0xd4, 0x9b, 0x4f, 0x2d, 0xab, 0x90, 0x67, 0x03, 0x4b, 0xd5, 0xcd, 0x3d, 0x45, 0xe3, 0x6e,
-    0xc2, 0xa4, 0xf1, 0xc0, 0x2b, 0xcc, 0xb9, 0x5e, 0x3d, 0xdb, 0xb0, 0x15, 0xe3, 0x1f, 0x9c, 0x5d,
-    0x0f, 0x27, 0x0c, 0xd5, 0x86, 0xee, 0xc2, 0x27, 0x0f, 0x14, 0x92, 0x85, 0xaa, 0x58, 0xe8, 0xb1,
-    0x64, 0x60, 0x5a, 0x42, 0x0c, 0xa6, 0x19, 0x31, 0x88, 0x56, 0x5c, 0x43, 0xa4, 0xda, 0x3b, 0xf8,
-    0x2d, 0xb5, 0x2d, 0x50, 0xd0, 0xbe, 0x01, 0x8b, 0xae, 0x0a, 0xca, 0x64, 0x3b, 0x16, 0x16, 0xe7,
-    0x52, 0xf8, 0x70, 0x1e, 0xde, 0xc7, 0xbb, 0x6e, 0xc4, 0x4f, 0x6a, 0xa0, 0x75, 0xf3, 0xd0, 0xeb,
-    0x42, 0x9b, 0x4f, 0x87, 0x67, 0x7f, 0x86, 0x9b, 0x5f, 0xfa, 0x18, 0x65, 0xe9, 0xd4, 0x8c, 0x47,
-    0x86, 0x30, 0xd2, 0x0a, 0xcb, 0x94, 0x0c, 0xa4, 0x12, 0xcc, 0x6e, 0x8d, 0x4a, 0xd9, 0x26, 0xa2,
-    0xd9, 0xf0, 0xe8, 0x70, 0x1b, 0x10, 0x9e, 0xa7, 0xf5, 0x64, 0x13, 0x4b, 0x67, 0x1d, 0xd1, 0x79,
-    0x5a, 0x43, 0x32, 0xc9, 0xdc, 0x80, 0x60, 0x0a, 0xb5, 0xf9, 0x72, 0xf5, 0x54, 0xe7, 0x72, 0x95,
-    0xe1, 0x96, 0x3f, 0x82, 0xb0, 0x6f, 0x1a, 0x24, 0x69, 0xeb, 0x57, 0x1d, 0xc5, 0x60, 0xd7, 0xc1,
-    0x2a, 0x7e, 0x06, 0x61, 0xbf, 0xdc, 0xc9, 0xc6, 0x0a, 0x09, 0xac, 0xb9, 0xab, 0xe5, 0x5b, 0xb7,
-    0x70, 0xc3, 0x2a, 0x90, 0x69, 0x82, 0x63, 0x27, 0x0a, 0x04, 0x5c, 0xb5, 0x52, 0x21, 0xee, 0x6e,
-    0x7d, 0x1d, 0x47, 0x14, 0x14, 0x15, 0x99, 0x30, 0x28, 0xf9, 0xa4, 0x3c, 0xf3, 0x80, 0x81, 0xe0,
-    0xf9, 0x82, 0x0e, 0x39, 0x26, 0x64, 0xda, 0x4b, 0xbf, 0xb8, 0xfc, 0xab, 0xe6, 0xf0, 0xd3, 0x30,
-    0x40, 0xc2, 0x25, 0x73, 0x2a, 0xd1, 0x1c, 0x7e, 0xc0, 0x25, 0x4f, 0xd5, 0xf4, 0x5b, 0x7f, 0xb3,
-    0xf5, 0x1d, 0x68, 0x25, 0xc2, 0x7c, 0x3e, 0x09, 0x57, 0xec, 0x3a, 0x21, 0xdd, 0x0b, 0xb6, 0xe4,
-    0x2e, 0x68, 0x2f, 0x5b, 0x72, 0x9f, 0xb5, 0x97, 0xb6, 0x57, 0x90, 0xef, 0xaa, 0xa0, 0x2b, 0x15,
-    0x74, 0x25, 0x83, 0x9a, 0xea, 0x8b, 0xca, 0xf5, 0x45, 0x6a, 0x7d, 0x51, 0x4d, 0x7d, 0x91, 0x5a,
-    0x5f, 0x54, 0xaa, 0xef, 0x81, 0xb7, 0x2e, 0x45, 0x87, 0x3b, 0x6a, 0x27, 0xb9, 0x62, 0x8c, 0x1e,
-    0xeb, 0x9a, 0x25, 0x1b, 0x40, 0xb5, 0x9e, 0xa8, 0xa2, 0x9e, 0x1d, 0x34, 0xb2, 0x35, 0x57, 0x23,
-    0xab, 0x37, 0x22, 0xb9, 0x78, 0x1c, 0x85, 0xc3, 0x78, 0xaf, 0x4b, 0xde, 0xe1, 0x56, 0xad, 0x43,
-    0x2f, 0x37, 0xfb, 0x5c, 0x2b, 0xf6, 0x71, 0xf0, 0x50, 0xe9, 0xac, 0x5d, 0x04, 0x7a, 0x6d, 0x6f,
-    0x7c, 0x73, 0x02, 0x7b, 0xbb, 0x1b, 0xbc, 0x15, 0xf7, 0x77, 0x9f, 0xe8, 0xf6, 0x6e, 0xc5, 0xdd,
-    0xdd, 0x47, 0xbb, 0xb9, 0xbb, 0x67, 0xa3, 0xc2, 0x74, 0x17, 0x18, 0x04, 0x11, 0x73, 0xfd, 0x3b,
-    0x07, 0x0c, 0x7a, 0xf0, 0x3c, 0x2c, 0x89, 0xa3, 0xd9, 0x70, 0x34, 0x1b, 0x8e, 0x66, 0xc3, 0xd1,
-    0x6c, 0xa8, 0x30, 0x1b, 0xfe, 0x99, 0xa6, 0xd3, 0x87, 0x9b, 0x0e, 0x2f, 0xdd, 0x2a, 0x38, 0x48,
-    0xc0, 0x96, 0x5a, 0xd3, 0x41, 0x8c, 0xd3, 0x01, 0xcc, 0x87, 0x52, 0x5d, 0xeb, 0xad, 0x01, 0x45,
-    0xe7, 0x7f, 0x8c, 0x88, 0x28, 0x47, 0xd5, 0xff, 0xa8, 0xfa, 0x1f, 0x55, 0xff, 0x97, 0xa5, 0xfa,
-    0x6f, 0xa8, 0xa8, 0x1f, 0x46, 0x45, 0x3f, 0x25, 0xa9, 0x13, 0x38, 0x8c, 0xae, 0x06, 0x52, 0xe3,
-    0x53, 0x4a, 0x64, 0xcb, 0x1b, 0xb8, 0x8a, 0x2c, 0xc1, 0xdc, 0xe2, 0x06, 0x80, 0x2e, 0x09, 0x6f,
-    0xe2, 0x2c, 0x4f, 0x88, 0x84, 0xed, 0x8f, 0xe1, 0x1c, 0x4d, 0x3c, 0xcb, 0xfd, 0x5a, 0x89, 0xb4,
-    0xfe, 0xf0, 0x24, 0xe8, 0x85, 0x33, 0x52, 0x9e, 0xa0, 0x8c, 0x95, 0x8d, 0xe2, 0x33, 0x22, 0x34,
-    0xf9, 0xd6, 0x8f, 0xf9, 0x16, 0x6d, 0x58, 0x79, 0x4d, 0x96, 0xe4, 0x54, 0xdf, 0x13, 0x82, 0xdc,
-    0xfa, 0x9b, 0x08, 0x1c, 0xa2, 0x46, 0xb4, 0x5d, 0xd5, 0x5c, 0x54, 0xba, 0x5a, 0x73, 0x51, 0xe9,
-    0x6a, 0x83, 0xcb, 0x10, 0x57, 0x9b, 0xdc, 0x98, 0x79, 0xe8, 0x01, 0x9c, 0xcd, 0x4f, 0x52, 0x6c,
-    0xa2, 0x63, 0xe3, 0x78, 0xc8, 0xad, 0x80, 0x04, 0x53, 0x94, 0x0e, 0x92, 0xec, 0xf2, 0x41, 0x32,
-    0xde, 0x1b, 0xa2, 0x05, 0xb7, 0x18, 0x06, 0xb9, 0xf0, 0x55, 0xd5, 0x9d, 0xa5, 0x2b, 0x7e, 0x67,
-    0xe9, 0xaa, 0xee, 0xce, 0x12, 0x2f, 0xbe, 0xcd, 0x08, 0x94, 0x4f, 0x76, 0x3c, 0xe2, 0x21, 0x1e,
-    0x9c, 0xb5, 0x74, 0x86, 0x04, 0xd2, 0x54, 0x21, 0x52, 0xfb, 0xce, 0xc7, 0x8e, 0x82, 0x1b, 0x9c,
-    0xe0, 0x3a, 0x80, 0x0f, 0xdb, 0x67, 0xf4, 0xf3, 0x44, 0xfa, 0xc9, 0xdd, 0x0e, 0x34, 0x3c, 0x26,
-    0xc5, 0xd1, 0x5e, 0xe2, 0xf5, 0xa6, 0xb5, 0x4a, 0x60, 0x8e, 0x07, 0x09, 0x3b, 0x8d, 0x1f, 0x59,
-    0xd7, 0x34, 0x7e, 0xc0, 0xf1, 0x01, 0xd5, 0x50, 0xba, 0xdf, 0x79, 0x83, 0x41, 0x6d, 0xf1, 0x67,
-    0x3b, 0x73, 0x3a, 0xed, 0x5e, 0xb7, 0xf7, 0xaa, 0x49, 0x3f, 0xc7, 0xe4, 0xf3, 0x75, 0xf7, 0xbc,
-    0xc7, 0x3e, 0x23, 0xf2, 0xd9, 0x79, 0xdd, 0xeb, 0xf9, 0x6c, 0x7a, 0xab, 0x47, 0x1a, 0xc5, 0x29,
-    0x59, 0xca, 0xa8, 0xd3, 0x08, 0x64, 0x0c, 0xca, 0x24, 0x01, 0x77, 0xea, 0x16, 0xff, 0x20, 0x28,
-    0xa2, 0x69, 0x06, 0x32, 0xb0, 0xf0, 0xc7, 0x64, 0x70, 0x74, 0x34, 0x9d, 0x91, 0xbe, 0xa3, 0xc7,
-    0x7d, 0xe1, 0x32, 0x0f, 0x6d, 0xbf, 0xd7, 0x7d, 0x75, 0xfa, 0xe6, 0x0c, 0x42, 0xc9, 0x0a, 0x89,
-    0x68, 0x17, 0xd5, 0xcb, 0x25, 0x41, 0xa6, 0x83, 0x24, 0x6e, 0xe9, 0xd2, 0xd1, 0x86, 0xf8, 0xa8,
-    0x34, 0xab, 0xe8, 0x84, 0x66, 0x19, 0x0a, 0x30, 0xba, 0x12, 0x46, 0x1a, 0x34, 0x82, 0x0d, 0xc3,
-    0xaa, 0xf1, 0x5d, 0x00, 0x37, 0x3f, 0x1a, 0xff, 0x96, 0x20, 0x9c, 0x80, 0xd7, 0x58, 0x12, 0xb8,
-    0x76, 0xd3, 0x32, 0xa4, 0x3a, 0xb4, 0x79, 0x56, 0xde, 0x44, 0x36, 0x70, 0xe6, 0xe9, 0xad, 0x45,
-    0xc7, 0xcb, 0xeb, 0x9e, 0x77, 0xd8, 0x39, 0x51, 0x17, 0x5a, 0x42, 0x06, 0x83, 0x7c, 0xbc, 0x7d,
-    0xe3, 0x9a, 0x5b, 0x04, 0xb4, 0x62, 0xf0, 0xde, 0x3e, 0x1b, 0xcc, 0x26, 0xeb, 0x39, 0x3e, 0xb6,
-    0x32, 0x95, 0xf2, 0x5a, 0xd3, 0xce, 0x18, 0x7a, 0xa8, 0xeb, 0x54, 0xc6, 0xce, 0xb2, 0x6d, 0x36,
-    0xb0, 0x0c, 0xf1, 0x58, 0x45, 0x3c, 0xae, 0x46, 0x3c, 0xae, 0x47, 0x3c, 0xd6, 0x10, 0x47, 0x2a,
-    0xe2, 0xa8, 0x1a, 0x71, 0x54, 0x8f, 0x38, 0x52, 0x11, 0x3b, 0x92, 0xee, 0xa8, 0x1e, 0xed, 0x28,
-    0x96, 0xaa, 0x9a, 0xfb, 0xb8, 0xd2, 0x62, 0xf6, 0x6c, 0x3d, 0x74, 0xda, 0x0a, 0xc6, 0x8e, 0xe1,
-    0x1a, 0xfd, 0x77, 0x0f, 0x54, 0x0c, 0xf6, 0xa8, 0xb2, 0x3c, 0x40, 0xe7, 0xd8, 0x7c, 0x2f, 0x07,
-    0x86, 0x9c, 0xd5, 0x3b, 0x7e, 0x04, 0x05, 0x45, 0x09, 0x8d, 0x07, 0xcb, 0x9e, 0x29, 0x3a, 0x88,
-    0x41, 0x6f, 0x29, 0x61, 0x7d, 0x5c, 0xb5, 0x45, 0x26, 0xeb, 0x4a, 0xbd, 0x5e, 0x2d, 0x15, 0x35,
-    0xeb, 0x33, 0x06, 0xdc, 0x47, 0xd7, 0xe8, 0x33, 0x74, 0x8d, 0x22, 0x97, 0x6e, 0xa5, 0xaa, 0x69,
-    0x3c, 0xb9, 0x9d, 0xa6, 0xb6, 0xbd, 0x76, 0x56, 0xe2, 0xb4, 0x60, 0x17, 0x7e, 0x3a, 0xfa, 0x5e,
-    0xbf, 0x9d, 0x23, 0x1b, 0x75, 0x2a, 0x2f, 0xbb, 0x8f, 0x32, 0x1c, 0xc7, 0xe2, 0x06, 0x98, 0x0c,
-    0xf2, 0xf2, 0x9d, 0xb6, 0x8f, 0xa1, 0xf3, 0xd3, 0x9c, 0xbb, 0xa0, 0x42, 0xb7, 0x5f, 0x6b, 0x13,
-    0xdc, 0x89, 0x33, 0x33, 0xe0, 0xf2, 0xe1, 0xb8, 0x03, 0xd8, 0xd0, 0x6c, 0xfc, 0xf5, 0xaf, 0x0d,
-    0xae, 0xd9, 0x06, 0xa0, 0xd8, 0x4a, 0x09, 0x77, 0x04, 0x82, 0x2a, 0xdd, 0x27, 0x3f, 0xd2, 0x75,
-    0xf9, 0xe4, 0x07, 0xfa, 0xb6, 0x84, 0x3c, 0x9e, 0xee, 0x9d, 0xa3, 0x69, 0x20, 0x07, 0x39, 0xbf,
-    0x72, 0x98, 0xd3, 0x2b, 0xac, 0x16, 0xae, 0x3a, 0x54, 0x18, 0x3f, 0x1b, 0x5a, 0x2f, 0xa7, 0x8f,
-    0x61, 0xbd, 0xc0, 0x05, 0xc8, 0x97, 0x62, 0xb2, 0xf0, 0x6e, 0x6d, 0x67, 0x63, 0x61, 0x05, 0x54,
-    0x69, 0xff, 0x88, 0x19, 0xc3, 0xd4, 0x41, 0x53, 0x5c, 0xf6, 0xeb, 0xd4, 0x2e, 0xd9, 0x01, 0x2c,
-    0x0f, 0x6b, 0x91, 0x86, 0x4e, 0x33, 0x07, 0x0e, 0xbd, 0x93, 0xb0, 0x8b, 0x2e, 0xba, 0x5f, 0xa5,
-    0xf2, 0x50, 0x9a, 0xe1, 0xcb, 0xde, 0xba, 0xc0, 0x81, 0x5a, 0xaf, 0x61, 0x55, 0x8e, 0xc2, 0x66,
-    0xda, 0xd2, 0x71, 0xc3, 0xe3, 0xb8, 0xe1, 0xb1, 0xf3, 0x86, 0x07, 0x7b, 0xac, 0x68, 0xc9, 0x9e,
-    0x0f, 0xaa, 0xde, 0xf3, 0x28, 0x6d, 0x8d, 0xb0, 0x12, 0x8e, 0x26, 0xaf, 0xf6, 0xeb, 0x0f, 0x19,
-    0x26, 0x53, 0x58, 0x29, 0xd2, 0x99, 0xbf, 0x59, 0x28, 0x07, 0xd6, 0xec, 0xc7, 0x88, 0x89, 0x23,
-    0xc7, 0x31, 0xa0, 0x11, 0x9e, 0xe6, 0x8b, 0x64, 0x42, 0x60, 0x59, 0x50, 0x55, 0x41, 0x19, 0xbb,
-    0x29, 0x8d, 0x7a, 0xb0, 0x25, 0x65, 0x10, 0xb5, 0x11, 0x14, 0x36, 0x4f, 0x49, 0xe2, 0x67, 0x5f,
-    0x15, 0x52, 0xbd, 0x37, 0xdd, 0xb7, 0x18, 0xae, 0x0a, 0x91, 0x34, 0x59, 0x45, 0x35, 0x4f, 0x0e,
-    0x69, 0xcf, 0xaa, 0x61, 0x97, 0x6e, 0xb3, 0x30, 0x55, 0x77, 0xb3, 0xbe, 0xe6, 0xdd, 0xa5, 0x44,
-    0x52, 0x94, 0xde, 0x1e, 0x09, 0x97, 0x98, 0x4e, 0xbf, 0x89, 0xbe, 0xf5, 0x61, 0x12, 0xdf, 0x80,
-    0x8a, 0x34, 0xb3, 0x58, 0x78, 0x63, 0xc2, 0x91, 0x2e, 0x93, 0x81, 0x49, 0xb8, 0xe0, 0x31, 0x24,
-    0x30, 0xba, 0x6c, 0x99, 0x33, 0xe9, 0x74, 0x72, 0x30, 0x22, 0x9a, 0x78, 0x9d, 0x09, 0x43, 0x1f,
-    0x66, 0x4d, 0xfc, 0x33, 0x66, 0x2f, 0x3b, 0xe1, 0x47, 0x44, 0x3f, 0xe8, 0xbf, 0xb6, 0x47, 0x14,
-    0x52, 0xa2, 0x3d, 0x94, 0x1e, 0x2b, 0xa9, 0x1f, 0x2c, 0x54, 0x46, 0x25, 0xa2, 0xa1, 0x4f, 0x9a,
-    0xa8, 0xcc, 0xb6, 0x58, 0x41, 0xa2, 0x6d, 0x8b, 0x9f, 0x2b, 0xd4, 0xce, 0xb8, 0x66, 0x17, 0x55,
-    0x96, 0xed, 0x54, 0x15, 0x19, 0x54, 0x16, 0x59, 0x5b, 0xdb, 0x70, 0x13, 0x4a, 0x3b, 0x4a, 0x91,
-    0xd8, 0x50, 0x44, 0xce, 0x1f, 0x6d, 0x40, 0x8d, 0x8a, 0x71, 0xbc, 0x09, 0x11, 0x66, 0xfa, 0xaf,
-    0x6a, 0x7a, 0xcb, 0x5c, 0x22, 0xd9, 0x80, 0x3c, 0x73, 0xc9, 0x78, 0x19, 0x8e, 0xc7, 0x31, 0x06,
-    0x9a, 0x80, 0x19, 0x0d, 0x2c, 0xda, 0xf8, 0x5b, 0xa3, 0x87, 0x36, 0x52, 0xa7, 0x7d, 0x46, 0x0c,
-    0x24, 0x91, 0x78, 0xd6, 0x3e, 0xc7, 0xc4, 0xd3, 0x73, 0x92, 0x4a, 0xfe, 0x30, 0x4b, 0x30, 0xce,
-    0x92, 0x1b, 0x66, 0x00, 0x0e, 0x9a, 0x23, 0xf2, 0x5f, 0x62, 0xb7, 0xac, 0xb0, 0x39, 0x24, 0xff,
-    0x8d, 0x6d, 0xd7, 0x1a, 0x37, 0xaf, 0xc8, 0x7f, 0x34, 0x2d, 0x22, 0xff, 0x0d, 0x6c, 0xdb, 0x6b,
-    0x80, 0xea, 0x4b, 0xea, 0x70, 0x2d, 0x8a, 0xbc, 0x25, 0xa6, 0x07, 0x04, 0x56, 0x28, 0x08, 0x6a,
-    0x76, 0xdf, 0xb6, 0x09, 0xcb, 0xf6, 0x5a, 0x14, 0x4c, 0x8f, 0x3d, 0x85, 0xea, 0x2e, 0x0a, 0x1f,
-    0x24, 0xa2, 0xbd, 0x84, 0xb3, 0xef, 0x10, 0xdc, 0xc4, 0xa5, 0xdf, 0x2b, 0xf1, 0xcd, 0x03, 0x8e,
-    0x15, 0x16, 0xc3, 0x1e, 0xc4, 0xf0, 0x13, 0x49, 0x5b, 0x2a, 0x1c, 0x4d, 0xb2, 0xb1, 0x3e, 0xe0,
-    0xd8, 0x7a, 0x09, 0x37, 0x21, 0x15, 0x86, 0x33, 0xe9, 0x4a, 0x00, 0x4f, 0x47, 0xed, 0x4a, 0xf7,
-    0x92, 0x5f, 0x85, 0xc3, 0xf4, 0x56, 0x4f, 0x05, 0xa1, 0x6b, 0x04, 0x0f, 0x07, 0x10, 0x02, 0xa5,
-    0x08, 0xe3, 0xf8, 0xf9, 0xa2, 0x71, 0xda, 0xee, 0x9e, 0x75, 0xcf, 0xdf, 0xf6, 0x5e, 0x9d, 0x9f,
-    0x9e, 0xbf, 0x79, 0xfb, 0xfa, 0xed, 0xe9, 0x89, 0x21, 0xa2, 0x0e, 0x58, 0xa0, 0x95, 0xc1, 0xcc,
-    0x64, 0x8e, 0xb4, 0xe8, 0x6b, 0x78, 0xc4, 0x32, 0x82, 0x80, 0x86, 0xb6, 0x1c, 0xd1, 0x10, 0x57,
-    0x8c, 0x9f, 0x69, 0x04, 0x9a, 0x01, 0x31, 0x76, 0xc1, 0x3e, 0x0b, 0x67, 0x0b, 0xcb, 0x2a, 0x9a,
-    0xfc, 0x67, 0xe7, 0x6b, 0x4b, 0xfa, 0xea, 0x7e, 0xb5, 0x1d, 0x34, 0xf6, 0x58, 0x58, 0x37, 0xbb,
-    0xa9, 0x66, 0x0a, 0xcc, 0x93, 0x74, 0x1e, 0x07, 0x44, 0xe2, 0xce, 0x08, 0x74, 0xef, 0xdc, 0x61,
-    0x47, 0xa3, 0x91, 0x22, 0xdb, 0x93, 0xea, 0x15, 0xe7, 0xa2, 0x31, 0xd6, 0x4b, 0xc0, 0xf8, 0x97,
-    0x9a, 0x99, 0x64, 0x92, 0x21, 0x06, 0xc6, 0xc4, 0x6e, 0x8b, 0xe5, 0xda, 0x64, 0xda, 0x7d, 0xbe,
-    0xc0, 0xfb, 0x1d, 0x3c, 0x4f, 0xb8, 0x33, 0xc0, 0x11, 0xf1, 0x83, 0xdc, 0x46, 0x61, 0x2e, 0x06,
-    0x6c, 0xbc, 0x84, 0xcb, 0x2a, 0xbc, 0x4b, 0xa6, 0xd7, 0x18, 0xec, 0x97, 0xa6, 0xaf, 0x9a, 0x9f,
-    0x2f, 0x7c, 0x49, 0xf7, 0xee, 0xb6, 0xdf, 0xbc, 0x3e, 0x6f, 0x15, 0x81, 0xfd, 0xba, 0xed, 0xd7,
-    0xe7, 0x2c, 0x9f, 0x4c, 0x52, 0xfa, 0x98, 0x27, 0x04, 0x10, 0x12, 0xa5, 0x68, 0x64, 0xc7, 0x4b,
-    0x6c, 0xba, 0x28, 0x86, 0x4d, 0x01, 0x79, 0x41, 0xc6, 0x81, 0x4c, 0x76, 0x74, 0xac, 0x62, 0xef,
-    0xd0, 0x91, 0xf0, 0x8a, 0x54, 0x8e, 0x94, 0x66, 0xd8, 0x0e, 0xff, 0x86, 0x28, 0xb9, 0x50, 0x80,
-    0x93, 0x8d, 0x0c, 0x83, 0xe3, 0x25, 0x55, 0xc8, 0xf7, 0x4d, 0x31, 0x93, 0xed, 0xaf, 0xe2, 0x40,
-    0xd1, 0x14, 0x08, 0x09, 0x46, 0x7f, 0x31, 0xe3, 0xbb, 0x68, 0x56, 0xaf, 0xec, 0x7f, 0x00, 0x16,
-    0xa6, 0x21, 0x54, 0x40, 0xe1, 0xb4, 0xe8, 0xd8, 0x34, 0x59, 0x7f, 0xd9, 0xde, 0xe7, 0x0b, 0x94,
-    0x25, 0x05, 0x37, 0xd1, 0xa0, 0xcc, 0x50, 0x88, 0xd5, 0x4c, 0x9f, 0xcd, 0xa2, 0x33, 0xc1, 0x95,
-    0x98, 0xdf, 0x45, 0x20, 0xa2, 0xaa, 0x10, 0x4e, 0x96, 0x89, 0xaf, 0x27, 0x4a, 0x91, 0x43, 0x72,
-    0x0b, 0x29, 0x2b, 0x4a, 0x15, 0xb7, 0x43, 0xbb, 0x29, 0x7d, 0x3e, 0x4c, 0xb8, 0x89, 0x29, 0x89,
-    0x94, 0x62, 0xd8, 0xe2, 0xf3, 0x37, 0xaf, 0x4f, 0x3b, 0xdd, 0x57, 0x27, 0xa5, 0x4d, 0x25, 0x50,
-    0xc9, 0xa9, 0x8f, 0xa4, 0xbc, 0xe1, 0x84, 0x71, 0xed, 0xeb, 0x15, 0xd6, 0x72, 0x24, 0x58, 0xf9,
-    0x41, 0x2c, 0x26, 0x6d, 0xf4, 0x17, 0xfc, 0x36, 0x7d, 0x57, 0x4b, 0x93, 0x6f, 0x8c, 0x4c, 0x2d,
-    0x15, 0x23, 0xde, 0xf4, 0x4a, 0xf1, 0x90, 0xc6, 0xe1, 0x74, 0x1a, 0xf2, 0x00, 0x47, 0x86, 0xf0,
-    0x9e, 0xa0, 0xcf, 0xcf, 0xe2, 0x45, 0x3a, 0x0a, 0xb3, 0x6f, 0x2e, 0x58, 0xcc, 0xf1, 0x01, 0xab,
-    0x1d, 0xce, 0x92, 0x8e, 0xc3, 0x79, 0xcd, 0x03, 0x50, 0x3c, 0xb7, 0x2e, 0x16, 0x32, 0x87, 0x59,
-    0x17, 0x0d, 0x59, 0x86, 0xab, 0xeb, 0x32, 0x7c, 0x6f, 0xb5, 0xa2, 0x49, 0x98, 0x57, 0xdd, 0x61,
-    0x98, 0x5d, 0xdf, 0x29, 0x02, 0xa4, 0x86, 0x84, 0x9a, 0x0e, 0x59, 0xdb, 0x1b, 0x1b, 0x75, 0x85,
-    0xda, 0x0f, 0xcf, 0x2f, 0xb0, 0xd0, 0x4b, 0x7f, 0x9a, 0x49, 0x30, 0xbd, 0x3a, 0x30, 0x3c, 0xd9,
-    0x40, 0x08, 0xcf, 0x72, 0xe5, 0x39, 0x51, 0x11, 0xa8, 0xba, 0x40, 0xb3, 0x25, 0xcf, 0xcb, 0x2d,
-    0xa2, 0x6f, 0x20, 0x1b, 0x7a, 0x04, 0x33, 0xdc, 0x62, 0x2e, 0x18, 0xfb, 0x83, 0x95, 0xde, 0x86,
-    0xdd, 0xd5, 0x36, 0x54, 0xf5, 0x03, 0xef, 0x84, 0xfa, 0x1e, 0xe0, 0xcd, 0x57, 0xdb, 0x4e, 0xf3,
-    0xde, 0x7d, 0xfc, 0xfd, 0xe2, 0xdd, 0xaf, 0x17, 0xef, 0x2e, 0x2f, 0x3e, 0xfe, 0x52, 0xfd, 0x24,
-    0x0d, 0x28, 0xf9, 0x6a, 0xd0, 0xcd, 0x20, 0xe4, 0x0f, 0x29, 0xb4, 0xba, 0xbd, 0x37, 0x24, 0x9b,
-    0x69, 0x4f, 0x7d, 0xb1, 0x2d, 0x10, 0xd0, 0x70, 0xdf, 0xf4, 0x99, 0x04, 0x0c, 0xe5, 0x08, 0xda,
-    0x8c, 0x2f, 0x2d, 0x69, 0x81, 0x88, 0xb0, 0x4d, 0x81, 0xc0, 0x5f, 0x60, 0x37, 0xd9, 0xd7, 0xad,
-    0xf3, 0xea, 0x8c, 0x45, 0x09, 0x2f, 0x7c, 0x82, 0xb2, 0x26, 0x00, 0xde, 0x46, 0x65, 0xb6, 0x8b,
-    0x8d, 0x4d, 0x09, 0x06, 0x3c, 0x8e, 0xec, 0x37, 0xdb, 0x4e, 0xf3, 0x05, 0x3f, 0xf0, 0x1f, 0xd8,
-    0x3a, 0x66, 0x11, 0x87, 0x93, 0x11, 0xcd, 0x2c, 0x72, 0xd8, 0xe8, 0x01, 0xf1, 0x0e, 0x1b, 0x40,
-    0xae, 0xfa, 0x42, 0x3a, 0xc7, 0xd2, 0xb4, 0xf8, 0x2f, 0xa1, 0x2c, 0xcb, 0x7d, 0x8b, 0xa6, 0xac,
-    0xd0, 0x00, 0xd3, 0xeb, 0x5c, 0x29, 0x2b, 0xea, 0x75, 0xca, 0x58, 0x7a, 0xf8, 0x90, 0x03, 0x68,
-    0x4f, 0x4d, 0xab, 0xa0, 0x8f, 0x29, 0xf0, 0xf4, 0x95, 0x07, 0xb9, 0x22, 0x5b, 0xed, 0x14, 0xbc,
-    0x39, 0x49, 0xab, 0x73, 0x8a, 0x88, 0x92, 0x54, 0xe3, 0xd0, 0xe4, 0x20, 0x6a, 0xdb, 0xd2, 0x00,
-    0x6a, 0xf9, 0x39, 0x8d, 0x31, 0x4d, 0xb4, 0xd6, 0x6b, 0xad, 0x0e, 0xda, 0x2b, 0xbd, 0x80, 0xfe,
-    0xd5, 0xab, 0x71, 0xf8, 0xe6, 0x16, 0xd1, 0xb8, 0x73, 0x08, 0xef, 0xdc, 0xba, 0x76, 0xaf, 0xe1,
-    0xdd, 0x73, 0xed, 0xb1, 0x2b, 0xce, 0x58, 0xaa, 0x01, 0x0a, 0xf4, 0x7b, 0x4c, 0x63, 0xe3, 0x7b,
-    0x79, 0x75, 0x67, 0x2b, 0x8b, 0x37, 0xc2, 0x7b, 0x4a, 0x31, 0xec, 0xbf, 0x52, 0x65, 0xc6, 0x28,
-    0x8c, 0xf8, 0xda, 0x14, 0xe9, 0x32, 0x39, 0x44, 0x26, 0xbf, 0x7c, 0x4a, 0xaf, 0x90, 0x56, 0x96,
-    0x32, 0x15, 0x29, 0x55, 0x5a, 0xba, 0x4f, 0xef, 0x94, 0x94, 0x4f, 0xb0, 0xb6, 0x25, 0xdd, 0x30,
-    0x58, 0x4f, 0xa0, 0xb7, 0x86, 0x1a, 0x9f, 0xeb, 0xa0, 0xd4, 0x85, 0x42, 0x39, 0xc2, 0x45, 0x16,
-    0x56, 0x2e, 0xec, 0x6c, 0xa9, 0xed, 0x6a, 0x7a, 0xad, 0x59, 0x07, 0x36, 0x69, 0xbb, 0x4f, 0xf3,
-    0x10, 0xd5, 0x37, 0xf4, 0x40, 0xd4, 0x9e, 0xc3, 0xdf, 0x1d, 0xe6, 0xd9, 0x21, 0xd3, 0xed, 0x6d,
-    0xca, 0x1c, 0xb6, 0xc3, 0x99, 0xa7, 0xbd, 0xf0, 0x0b, 0x12, 0x7a, 0x01, 0x3e, 0x9a, 0xd3, 0xac,
-    0x5a, 0x89, 0xa0, 0x98, 0xcc, 0x46, 0xf2, 0xad, 0x6f, 0x6a, 0xe4, 0x4e, 0x49, 0x8f, 0x41, 0x85,
-    0x2d, 0x4b, 0x54, 0x90, 0xb7, 0x10, 0xb5, 0xed, 0x16, 0x55, 0x62, 0xdc, 0x51, 0xdb, 0xc3, 0xf4,
-    0x0a, 0x4b, 0x78, 0x0f, 0x71, 0xa6, 0x84, 0xc9, 0xfb, 0xdb, 0xbb, 0x7f, 0xf4, 0x7f, 0xbd, 0xf8,
-    0xf8, 0xa1, 0xff, 0xfe, 0xe2, 0xf2, 0xf7, 0x77, 0x1f, 0x7f, 0xfa, 0xd0, 0x38, 0xed, 0xbd, 0x7e,
-    0xf5, 0xba, 0xdd, 0x79, 0x36, 0x46, 0xf1, 0xa6, 0xaf, 0x49, 0x57, 0x18, 0xcf, 0xfb, 0x37, 0x8a,
-    0x89, 0x58, 0x1d, 0x67, 0xf1, 0xa2, 0x32, 0xea, 0xc7, 0xd1, 0xfc, 0x3c, 0x9a, 0x9f, 0x2f, 0xd5,
-    0xfc, 0x3c, 0x1a, 0x84, 0x47, 0x83, 0xf0, 0x85, 0x19, 0x84, 0x5c, 0x9c, 0x6f, 0x6a, 0x13, 0x7a,
-    0xa5, 0x25, 0xf4, 0x68, 0x25, 0x1e, 0xad, 0xc4, 0xa3, 0x95, 0xf8, 0x3c, 0xac, 0xc4, 0x8d, 0x77,
-    0x83, 0x77, 0xb6, 0x1f, 0x1f, 0xa8, 0x18, 0xbe, 0x18, 0x1b, 0xf0, 0x68, 0xc7, 0x19, 0xec, 0xb8,
-    0x8a, 0x97, 0xc6, 0xd8, 0x16, 0x3e, 0x70, 0xb6, 0xca, 0x2a, 0xd5, 0x2f, 0x8e, 0xed, 0xc7, 0xfc,
-    0x2b, 0x1b, 0x77, 0x3c, 0x47, 0x59, 0xd1, 0xfa, 0x97, 0x3f, 0xbd, 0xfb, 0xf5, 0x03, 0x88, 0xf6,
-    0x47, 0x37, 0xfe, 0xd6, 0xec, 0x79, 0x3e, 0xcc, 0x36, 0x7c, 0x88, 0xf1, 0x57, 0xec, 0x77, 0xee,
-    0xe0, 0x3d, 0x3a, 0xda, 0x7c, 0x3b, 0xd8, 0x7c, 0xcf, 0xc0, 0xc4, 0x7a, 0x76, 0x66, 0xe7, 0x81,
-    0x6d, 0xbe, 0xe3, 0xb5, 0xcd, 0x67, 0x74, 0x6d, 0xf3, 0x85, 0xdb, 0xd6, 0x4f, 0x6b, 0xcb, 0x3e,
-    0x37, 0xcb, 0xfe, 0x50, 0xb6, 0xf5, 0x7f, 0xc2, 0x45, 0xda, 0x27, 0xf2, 0x1f, 0x70, 0xb8, 0xed,
-    0xb6, 0x95, 0x0d, 0x8a, 0xd6, 0xd1, 0x81, 0x70, 0x74, 0x20, 0x1c, 0x1d, 0x08, 0x0f, 0x76, 0x20,
-    0x14, 0xf3, 0x30, 0x94, 0xb5, 0xf9, 0xc7, 0x75, 0x2c, 0x6c, 0x73, 0x1b, 0x54, 0x11, 0x62, 0x7a,
-    0x98, 0x95, 0xb5, 0x1e, 0x8a, 0xc3, 0x59, 0x2f, 0x2f, 0xe5, 0x32, 0xe6, 0x7f, 0x82, 0xdb, 0xe5,
-    0x19, 0xdd, 0xea, 0x7c, 0x42, 0xb7, 0xd0, 0x31, 0x6c, 0xf1, 0xcb, 0x7a, 0xcc, 0x44, 0xee, 0x6a,
-    0xb9, 0x7d, 0x6a, 0x9b, 0xdb, 0x4b, 0x47, 0xf4, 0x9a, 0xa7, 0x06, 0x00, 0xd6, 0x00, 0x57, 0x26,
-    0x9c, 0x91, 0x01, 0x27, 0xa1, 0xda, 0x61, 0xfd, 0x5d, 0x87, 0x11, 0x28, 0xf6, 0xbf, 0x31, 0x5f,
-    0x24, 0xc5, 0xb6, 0x24, 0x5d, 0x49, 0x6f, 0x17, 0x8b, 0x25, 0xc2, 0x53, 0x7b, 0xba, 0xbd, 0x54,
-    0xe1, 0xa3, 0x7a, 0xf8, 0x48, 0x85, 0x5f, 0xf5, 0xf1, 0x21, 0xe4, 0xa6, 0xe8, 0x0b, 0xa2, 0x07,
-    0xb1, 0x7b, 0x6b, 0x82, 0x3e, 0xa4, 0xc9, 0xd2, 0x6a, 0x5d, 0x35, 0x7b, 0xec, 0x31, 0x17, 0x5b,
-    0x27, 0x68, 0x55, 0x20, 0x8f, 0x76, 0x41, 0x1e, 0x55, 0x23, 0x8f, 0x0a, 0xd6, 0xc0, 0xf0, 0x23,
-    0xdb, 0xdf, 0xf5, 0x46, 0x1e, 0x22, 0xbd, 0xea, 0x92, 0x96, 0xdb, 0x12, 0xae, 0x68, 0x87, 0x9b,
-    0xda, 0x0c, 0x57, 0x44, 0x70, 0x45, 0xb6, 0xe2, 0x3d, 0x06, 0x5c, 0xc6, 0xdb, 0xda, 0xa4, 0x52,
-    0xd7, 0x9c, 0x11, 0xd9, 0xe6, 0x5b, 0xda, 0xd4, 0x9f, 0xfc, 0x88, 0xaf, 0x4a, 0x3c, 0x23, 0x6f,
-    0xf2, 0xa3, 0x1e, 0x25, 0x62, 0x83, 0x44, 0x5f, 0xa1, 0x0e, 0x4b, 0xaa, 0x1d, 0xe9, 0xf5, 0xfe,
-    0x4a, 0x4a, 0x37, 0x95, 0x8a, 0x2a, 0x4a, 0x45, 0xfb, 0x38, 0xb6, 0xc4, 0x52, 0xa1, 0x86, 0xd0,
-    0x94, 0x18, 0xed, 0x7e, 0x0e, 0xf2, 0x78, 0xab, 0xe7, 0x78, 0xac, 0xea, 0x78, 0xac, 0xaa, 0xca,
-    0xc5, 0xce, 0x87, 0xcc, 0xe0, 0x7f, 0x7b, 0x0c, 0xf7, 0x3b, 0x3a, 0x91, 0x6a, 0xa8, 0x2c, 0xf2,
-    0x2b, 0xfb, 0xaa, 0x00, 0x31, 0xf1, 0x97, 0x94, 0x5b, 0xd7, 0x9b, 0x2a, 0xd8, 0xf1, 0x8a, 0xd2,
-    0xf1, 0x44, 0xda, 0x33, 0x39, 0x91, 0x76, 0x38, 0x3f, 0xb9, 0x34, 0x15, 0x8b, 0x9f, 0x86, 0x9a,
-    0x8b, 0x4c, 0x57, 0x9d, 0x9f, 0xa6, 0x26, 0xcb, 0x98, 0x4c, 0x93, 0xec, 0xe8, 0xce, 0x3e, 0xba,
-    0xb3, 0x8f, 0xee, 0xec, 0xff, 0x78, 0x77, 0x36, 0xea, 0xf5, 0x01, 0x13, 0x30, 0x62, 0x52, 0x3a,
-    0xba, 0x9d, 0xd2, 0x5e, 0x7a, 0x92, 0xf4, 0x11, 0x83, 0x57, 0x02, 0x5b, 0x35, 0x85, 0x09, 0x63,
-    0x33, 0xec, 0xd1, 0x5a, 0xec, 0xd1, 0x66, 0xd8, 0x23, 0x09, 0x3b, 0x84, 0x1c, 0xdb, 0xf7, 0x59,
-    0x3e, 0xdd, 0xc8, 0x5a, 0x0c, 0x47, 0xd8, 0xfd, 0xe5, 0x98, 0x54, 0xc4, 0x56, 0x7c, 0x66, 0xa6,
-    0xd5, 0xf1, 0x8a, 0x59, 0xfd, 0xe2, 0x7e, 0x38, 0xe5, 0x7a, 0xbf, 0x9a, 0xf1, 0xb7, 0x78, 0x6b,
-    0xce, 0x88, 0xa1, 0xe6, 0xa4, 0x42, 0xb9, 0xc7, 0x6b, 0x3b, 0x7c, 0x6b, 0x1d, 0xe8, 0x1b, 0xf3,
-    0xb5, 0x12, 0x31, 0x04, 0xb9, 0xfd, 0xd0, 0x18, 0xbf, 0x09, 0x85, 0x89, 0xdd, 0x0e, 0x35, 0xe0,
-    0xa8, 0x12, 0x38, 0x2a, 0x01, 0xa3, 0x5b, 0x50, 0xd4, 0xe2, 0x0a, 0x14, 0x2e, 0x4a, 0x3a, 0xdb,
-    0xa7, 0x4e, 0xbe, 0x40, 0x79, 0x81, 0xf6, 0xbc, 0x55, 0xc8, 0x47, 0x59, 0x96, 0xd3, 0x28, 0xc1,
-    0xa6, 0x1c, 0x86, 0x76, 0xff, 0xc7, 0x52, 0x37, 0x3a, 0x29, 0x9a, 0x4f, 0xc8, 0x5a, 0x93, 0xc9,
-    0xcf, 0x4f, 0x08, 0xa9, 0x8f, 0x6b, 0x4f, 0x45, 0x66, 0x74, 0x3d, 0x1a, 0xc5, 0x59, 0xdd, 0xd3,
-    0xb4, 0x5b, 0x06, 0x2e, 0xeb, 0x18, 0xd2, 0xba, 0xbb, 0x46, 0x33, 0xeb, 0x04, 0x96, 0x65, 0x8e,
-    0xf6, 0xd8, 0x82, 0x13, 0xc1, 0x9e, 0x4a, 0x7f, 0xc3, 0x86, 0xb8, 0x4c, 0xb4, 0x64, 0x37, 0xa0,
-    0xc1, 0xef, 0xe0, 0x09, 0x74, 0xb9, 0x03, 0x20, 0x60, 0x57, 0xd1, 0x55, 0x52, 0xe7, 0xca, 0x3b,
-    0xd3, 0xfd, 0x72, 0x3f, 0xe9, 0xcf, 0x77, 0x94, 0x16, 0xdb, 0x4e, 0x75, 0x56, 0x77, 0xe3, 0x6e,
-    0x2a, 0x8d, 0x4e, 0x06, 0x51, 0xa3, 0x88, 0xd2, 0xb1, 0x80, 0x30, 0xdb, 0x75, 0xd9, 0x20, 0x2e,
-    0xcb, 0x23, 0x1f, 0x92, 0x6e, 0xc3, 0x00, 0x7a, 0xfa, 0x8b, 0x26, 0x85, 0xaf, 0x72, 0x96, 0x67,
-    0xe1, 0xc2, 0xf4, 0xe2, 0x09, 0x3c, 0x3f, 0xb2, 0x98, 0x27, 0xb3, 0xfe, 0x2d, 0x06, 0xd1, 0xd5,
-    0x22, 0xd2, 0x15, 0x82, 0xb9, 0x53, 0x9e, 0x98, 0x1d, 0x1a, 0x86, 0xad, 0xb3, 0x26, 0xca, 0x6b,
-    0x97, 0x82, 0x75, 0x69, 0x88, 0x6d, 0x8a, 0xac, 0x1d, 0x52, 0x0b, 0x81, 0x54, 0xc1, 0x12, 0xb2,
-    0x71, 0x14, 0x14, 0x3f, 0x3d, 0x0e, 0xe6, 0xdf, 0x8b, 0x42, 0x5d, 0xbd, 0x50, 0xb7, 0x28, 0xd4,
-    0x2d, 0x0a, 0x75, 0xa1, 0x90, 0xb6, 0x77, 0x40, 0xb1, 0xb9, 0x2c, 0x88, 0x2b, 0x1f, 0x7d, 0xf6,
-    0xb2, 0x52, 0x3b, 0x94, 0x43, 0x5d, 0x63, 0x97, 0x08, 0xbc, 0x80, 0xd6, 0x87, 0x2f, 0x0c, 0x91,
-    0x0d, 0xe1, 0xc9, 0xc9, 0x87, 0xab, 0xf6, 0x18, 0x84, 0xed, 0xb7, 0xdd, 0x8a, 0xbc, 0xbb, 0xe5,
-    0xaa, 0x32, 0x6f, 0x75, 0xb7, 0x14, 0x91, 0xe4, 0xc2, 0x9b, 0x98, 0x48, 0x87, 0x38, 0xe0, 0xcf,
-    0x10, 0xf1, 0xb7, 0xa5, 0xf8, 0xa3, 0x52, 0xb6, 0x77, 0x0a, 0x81, 0x3f, 0x21, 0xec, 0xb7, 0xc5,
-    0x60, 0x5b, 0xe4, 0x0b, 0x02, 0x9e, 0x95, 0x87, 0x1f, 0x08, 0x86, 0x0a, 0x71, 0xf6, 0x38, 0xa5,
-    0xe1, 0xa7, 0xd3, 0x87, 0x0e, 0x3d, 0x30, 0x14, 0x98, 0xed, 0xb4, 0x81, 0x3a, 0x2b, 0xba, 0x6b,
-    0x13, 0x6c, 0x8e, 0x88, 0xfc, 0xae, 0xc0, 0x03, 0x55, 0xb8, 0x1b, 0xa4, 0x68, 0x12, 0x16, 0x25,
-    0x05, 0x8d, 0xb0, 0xc6, 0x89, 0x74, 0x45, 0x35, 0x2e, 0xb6, 0x9d, 0x0d, 0x9f, 0xcb, 0x83, 0xa2,
-    0x3d, 0x4c, 0xfe, 0x92, 0x5e, 0x5a, 0xe4, 0x6c, 0xca, 0x7c, 0xbe, 0x08, 0x4a, 0xe1, 0x09, 0x7d,
-    0xe3, 0x76, 0x0d, 0x33, 0xaa, 0xcd, 0xdb, 0x35, 0x4a, 0xea, 0x29, 0x94, 0x10, 0xe6, 0x94, 0x2a,
-    0x73, 0xb9, 0xb7, 0x01, 0x19, 0x53, 0x17, 0x42, 0x51, 0x9a, 0x4e, 0x40, 0xc8, 0x2c, 0xe8, 0xa6,
-    0x1d, 0x84, 0xc6, 0xec, 0x23, 0xb1, 0xa1, 0x24, 0xe9, 0x35, 0xa0, 0x51, 0x1c, 0xa2, 0x2c, 0x2d,
-    0xc1, 0xa9, 0xcf, 0xf0, 0x21, 0x6c, 0x5d, 0x66, 0x45, 0xd6, 0x20, 0x9c, 0x12, 0x1e, 0x04, 0x93,
-    0x0f, 0xc2, 0xd4, 0x11, 0xc9, 0xcc, 0x1f, 0x37, 0xa8, 0x80, 0x9f, 0x27, 0xf9, 0xe0, 0x4a, 0xa7,
-    0x35, 0x4b, 0xf3, 0x30, 0x8f, 0xfb, 0x8b, 0xd5, 0x34, 0x4a, 0x27, 0x15, 0x05, 0x69, 0x50, 0x3e,
-    0xcd, 0x04, 0x52, 0x84, 0xf8, 0xe0, 0x4a, 0x89, 0x59, 0x59, 0xb1, 0x33, 0x46, 0x53, 0x27, 0x61,
-    0x44, 0x34, 0xa0, 0xf9, 0x24, 0x9c, 0xc5, 0x15, 0x10, 0x34, 0x50, 0xb4, 0x96, 0x57, 0xf4, 0x2d,
-    0x08, 0x37, 0x3d, 0x19, 0xdb, 0x46, 0x4d, 0xd6, 0x69, 0x38, 0xaf, 0x3a, 0x1a, 0x55, 0x36, 0x9b,
-    0x4a, 0x46, 0x93, 0x32, 0xf8, 0xdf, 0xc0, 0x26, 0xcb, 0x33, 0x79, 0x98, 0xbc, 0x50, 0x62, 0x02,
-    0x79, 0x4a, 0x8a, 0x43, 0x2b, 0xdc, 0xf5, 0xaa, 0xe6, 0xf2, 0x23, 0x2f, 0xa8, 0x76, 0x14, 0x5e,
-    0x42, 0x9e, 0x08, 0x63, 0xc6, 0x53, 0x09, 0xa8, 0xcc, 0x94, 0x8b, 0x78, 0x3c, 0x85, 0xd8, 0x8c,
-    0x84, 0xed, 0x26, 0x71, 0xd0, 0xd2, 0x26, 0xf5, 0x9f, 0xbd, 0xaf, 0x5c, 0x4b, 0x85, 0x61, 0x87,
-    0xd5, 0xeb, 0xbb, 0x8a, 0xb9, 0x0b, 0x2f, 0x87, 0x7c, 0x57, 0x3d, 0x65, 0x49, 0xa7, 0x22, 0x15,
-    0x20, 0x03, 0x29, 0x41, 0x7f, 0x76, 0xbe, 0xba, 0xec, 0x57, 0xf7, 0xab, 0xcb, 0x67, 0xaf, 0xed,
-    0x61, 0x98, 0x67, 0xff, 0xbe, 0x01, 0x7d, 0xd6, 0x80, 0x1a, 0x1f, 0x56, 0xa1, 0xa8, 0xac, 0x8c,
-    0xb8, 0xae, 0x29, 0xeb, 0x11, 0x33, 0x91, 0xc2, 0xf0, 0xa9, 0x69, 0xaa, 0x3f, 0xed, 0x73, 0x9a,
-    0xcc, 0xf2, 0x75, 0x11, 0xc7, 0x59, 0xe0, 0x68, 0x21, 0x8a, 0x88, 0xfc, 0xb9, 0x4a, 0x0b, 0x51,
-    0x14, 0xa8, 0xd8, 0xda, 0xea, 0x28, 0x72, 0x28, 0x2a, 0x5a, 0x02, 0x7d, 0x1a, 0x37, 0x7e, 0x3c,
-    0xa9, 0x44, 0xec, 0xd5, 0xc8, 0xbf, 0xc6, 0x0f, 0x27, 0x35, 0xb9, 0x5e, 0x25, 0x4e, 0x85, 0x36,
-    0xc9, 0xf3, 0xc5, 0xc8, 0xa3, 0x36, 0x19, 0x18, 0x29, 0xe0, 0xe6, 0x54, 0x69, 0x47, 0xbb, 0x0b,
-    0xbc, 0xcf, 0x3e, 0xf4, 0xa4, 0x13, 0x94, 0x4a, 0xf3, 0x23, 0x56, 0x44, 0x0b, 0xe0, 0x47, 0xa9,
-    0x98, 0x28, 0x6b, 0xfc, 0x88, 0x5c, 0xea, 0xf5, 0xce, 0xd0, 0x13, 0x8b, 0x23, 0xa1, 0xb0, 0x3a,
-    0x8a, 0x66, 0x2a, 0xa8, 0x41, 0x8d, 0x27, 0x35, 0xf9, 0x94, 0xbf, 0x14, 0xd9, 0xcd, 0x15, 0x45,
-    0x3a, 0xb5, 0x3e, 0xaf, 0x1d, 0x44, 0x1a, 0xaa, 0xba, 0x8b, 0x11, 0xb4, 0xc5, 0x4b, 0x3b, 0xa1,
-    0x3e, 0x5e, 0xcb, 0x95, 0x57, 0x1a, 0x41, 0x84, 0x8c, 0x02, 0x53, 0x45, 0x00, 0x6f, 0x4c, 0xbf,
-    0xf5, 0xf5, 0x66, 0x60, 0xb8, 0x5d, 0x0b, 0x8e, 0x61, 0xe1, 0x59, 0x2f, 0x75, 0x95, 0x71, 0xe1,
-    0x24, 0x17, 0x1c, 0x17, 0xf3, 0xef, 0xe5, 0xae, 0xc0, 0xd9, 0x4e, 0x78, 0x75, 0x16, 0x60, 0x54,
-    0x57, 0x59, 0x06, 0x34, 0x35, 0xfc, 0x2a, 0x7f, 0xd2, 0x82, 0x03, 0x22, 0x9d, 0x30, 0x96, 0x6d,
-    0x7d, 0x41, 0x70, 0x32, 0x37, 0xf8, 0x27, 0xeb, 0xb8, 0x00, 0x3d, 0xcf, 0x02, 0x8d, 0x8b, 0xbe,
-    0x7c, 0x41, 0x8e, 0xab, 0xff, 0x1a, 0xb0, 0xc0, 0xc8, 0xb2, 0x77, 0x1a, 0x64, 0xa3, 0x69, 0xf5,
-    0x13, 0x63, 0x22, 0x43, 0x92, 0x8e, 0x54, 0x42, 0xf1, 0x48, 0x46, 0x9c, 0xbc, 0x3a, 0x32, 0x8f,
-    0xb5, 0x56, 0xd2, 0x53, 0x13, 0x6e, 0x9b, 0x5a, 0x63, 0x1c, 0xb1, 0x13, 0xe6, 0x9d, 0x42, 0x64,
-    0x63, 0xc1, 0x94, 0x52, 0xac, 0xee, 0x1b, 0x26, 0x92, 0xc9, 0xbf, 0x9e, 0xb4, 0x80, 0xc2, 0xd0,
-    0xcb, 0x4b, 0x24, 0x5f, 0x4b, 0xd8, 0xa7, 0xa5, 0x6a, 0x4f, 0x22, 0x92, 0x7b, 0xa1, 0x23, 0x04,
-    0x72, 0x3e, 0x91, 0xa0, 0x68, 0x4d, 0x40, 0xcc, 0x62, 0x45, 0x93, 0x68, 0xfc, 0xd0, 0x52, 0x35,
-    0x0b, 0x75, 0x61, 0x16, 0xaf, 0x50, 0x81, 0x83, 0x04, 0xe2, 0x8c, 0x2b, 0x48, 0x3b, 0x5f, 0x9b,
-    0x52, 0x51, 0xdb, 0xae, 0x0a, 0xc9, 0xcd, 0x8c, 0xa4, 0xc7, 0xd6, 0x0a, 0x0e, 0x77, 0xf0, 0x76,
-    0x2b, 0x47, 0x9a, 0x04, 0x44, 0x5d, 0x4c, 0x0c, 0xc0, 0xd1, 0x5a, 0xa7, 0xe8, 0xe8, 0xb2, 0x1d,
-    0xc9, 0x7e, 0x53, 0x4f, 0x90, 0x4d, 0x4f, 0x6f, 0x1d, 0x95, 0xfd, 0xfd, 0x29, 0xfb, 0xcf, 0x46,
-    0x89, 0xde, 0xa7, 0x15, 0xb1, 0xad, 0x45, 0x53, 0x67, 0x75, 0xd4, 0x2b, 0xfb, 0xc0, 0x1e, 0x8a,
-    0x27, 0xe8, 0x94, 0x25, 0x76, 0xab, 0x26, 0xf4, 0x28, 0x99, 0x4c, 0xea, 0x0e, 0x9f, 0x15, 0xf9,
-    0xd5, 0x27, 0xd0, 0x0a, 0x18, 0xd3, 0x31, 0x34, 0x29, 0xb7, 0x6e, 0xab, 0x45, 0x05, 0xab, 0x7b,
-    0x24, 0x2b, 0x9c, 0xa4, 0x75, 0x14, 0x17, 0xf9, 0xd5, 0x14, 0x17, 0x30, 0x26, 0x8a, 0xa5, 0xdc,
-    0x3a, 0x8a, 0x55, 0xb0, 0x6f, 0xfa, 0xbc, 0x1a, 0x36, 0xa5, 0xe6, 0xe8, 0x53, 0x91, 0x5f, 0xfd,
-    0xaa, 0xad, 0x00, 0x31, 0xbe, 0x6c, 0x5b, 0xe4, 0xd6, 0xbe, 0x61, 0xa6, 0x80, 0xad, 0x23, 0xb8,
-    0xfa, 0x68, 0xa2, 0xc8, 0xae, 0x27, 0xb7, 0xea, 0x90, 0x62, 0x91, 0xb9, 0x96, 0x58, 0x65, 0x27,
-    0x68, 0x13, 0x3b, 0x55, 0x9a, 0x70, 0xc5, 0x4f, 0xd3, 0x81, 0xad, 0x22, 0xd7, 0x55, 0xa7, 0xa1,
-    0xe9, 0xe8, 0x96, 0x8c, 0x6a, 0xa7, 0xa9, 0x54, 0xfc, 0x34, 0xd1, 0x52, 0xe4, 0xba, 0xea, 0x04,
-    0x33, 0xd1, 0x22, 0xa3, 0xda, 0x7e, 0x92, 0x1c, 0xfc, 0xa4, 0x97, 0xc4, 0xfb, 0xc5, 0x4f, 0xd3,
-    0xbb, 0xba, 0x22, 0xd3, 0x55, 0x27, 0x84, 0xf1, 0x7d, 0x5d, 0x09, 0xd3, 0x2e, 0x5c, 0x2d, 0x7e,
-    0x55, 0x11, 0xc2, 0xce, 0xd8, 0x49, 0x8c, 0x5e, 0x49, 0x06, 0xdb, 0xb3, 0x34, 0xb0, 0xeb, 0xd1,
-    0x9f, 0x71, 0xf4, 0x67, 0x1c, 0xfd, 0x19, 0x47, 0x7f, 0xc6, 0xd1, 0x9f, 0xf1, 0x32, 0xfc, 0x19,
-    0xfc, 0x70, 0x71, 0x71, 0x22, 0x4e, 0x39, 0x40, 0x47, 0x99, 0xe0, 0x59, 0xb9, 0x3c, 0x8a, 0x37,
-    0xa5, 0xb2, 0x79, 0x3a, 0x09, 0xa1, 0xf5, 0x0f, 0xf0, 0x81, 0x30, 0x03, 0x88, 0x9e, 0x7f, 0x23,
-    0x6d, 0x6b, 0x2f, 0xe1, 0xce, 0x16, 0x5e, 0x3d, 0xa3, 0x56, 0x10, 0xdd, 0x34, 0x94, 0x3a, 0xc8,
-    0xa5, 0x2f, 0x77, 0x56, 0xd5, 0x8f, 0x6e, 0x15, 0x7e, 0xb9, 0xea, 0xf2, 0xfd, 0xcf, 0xfd, 0xcf,
-    0xff, 0x68, 0xbc, 0x69, 0x77, 0x4e, 0xca, 0xa6, 0x26, 0xac, 0xae, 0x7e, 0x9d, 0x03, 0xc6, 0x6c,
-    0x0c, 0xca, 0x47, 0x63, 0xb6, 0x3d, 0x9f, 0xa7, 0xd9, 0xb9, 0x8f, 0x69, 0x0a, 0x1e, 0xd6, 0x8c,
-    0x3b, 0xa0, 0x09, 0x76, 0x28, 0x2b, 0xea, 0xa0, 0x26, 0xd0, 0x3e, 0x2d, 0x98, 0x5a, 0x36, 0xd9,
-    0xce, 0x00, 0xa9, 0xb7, 0x3f, 0xb6, 0xb2, 0x1f, 0xf6, 0x71, 0xde, 0x4e, 0x1a, 0xbd, 0xed, 0x14,
-    0xf9, 0xba, 0xa1, 0xd9, 0x58, 0x17, 0xa7, 0x30, 0x1f, 0xde, 0xff, 0xf2, 0xa1, 0xff, 0xcb, 0xbb,
-    0xdf, 0x7e, 0x7b, 0x47, 0x34, 0x86, 0x6e, 0xe7, 0xdc, 0x33, 0x87, 0xdb, 0xe3, 0x62, 0x9c, 0xcd,
-    0x72, 0xd0, 0xbe, 0xcb, 0xa2, 0x9f, 0xcd, 0x76, 0x71, 0x2d, 0x1e, 0x95, 0x46, 0x9e, 0xb8, 0x92,
-    0x25, 0x38, 0xef, 0x28, 0x96, 0x59, 0x28, 0xe2, 0x1b, 0x2a, 0x3e, 0x45, 0x78, 0x08, 0x3a, 0x6a,
-    0xd2, 0xf0, 0xcb, 0xd2, 0x0e, 0x89, 0x0b, 0x8a, 0x26, 0x7a, 0x96, 0xc0, 0xef, 0x28, 0x92, 0xd0,
-    0xf6, 0xe5, 0x13, 0x97, 0xd7, 0xa3, 0x51, 0x60, 0xa1, 0x3e, 0xdd, 0xc2, 0xab, 0x0f, 0x4c, 0xb7,
-    0x16, 0xda, 0x3a, 0xf4, 0x25, 0x3f, 0xa8, 0x13, 0x48, 0xec, 0x42, 0xab, 0xb3, 0x44, 0x57, 0x3b,
-    0xdd, 0x76, 0xf7, 0xad, 0x47, 0x85, 0x78, 0xb3, 0xa0, 0xc2, 0xae, 0x21, 0x83, 0xd6, 0x0d, 0x35,
-    0x17, 0x23, 0xef, 0x15, 0x0b, 0x2f, 0x43, 0xe6, 0xdf, 0x4b, 0xe4, 0xe2, 0x71, 0x41, 0x93, 0x47,
-    0x19, 0xfc, 0xc9, 0xed, 0xb0, 0xdc, 0x21, 0xb4, 0xae, 0x61, 0x80, 0x1f, 0x8e, 0xbc, 0x1e, 0x28,
-    0xba, 0x10, 0x7a, 0xb3, 0xa5, 0x03, 0x86, 0x40, 0x5a, 0x4b, 0x46, 0xe0, 0x42, 0x4a, 0x53, 0x49,
-    0xd9, 0xf0, 0x34, 0xa1, 0xa3, 0xae, 0x78, 0x0f, 0xf2, 0x76, 0xff, 0x3f, 0x5e, 0x36, 0x53, 0x8c
+    0x78, 0xda, 0xed, 0x3d, 0x6b, 0x6f, 0xe3, 0xb6, 0xb2, 0xe7, 0x73, 0x7e, 0x85, 0x8b, 0x02, 0x07,
+    0x92, 0x2c, 0x5b, 0xb6, 0x93, 0xec, 0xa3, 0x3a, 0xba, 0xc5, 0xa2, 0xbb, 0xed, 0x0d, 0xd0, 0xc7,
+    0xa2, 0x69, 0xcf, 0x3d, 0x38, 0xc5, 0xc2, 0x90, 0x6c, 0xc5, 0xd1, 0xad, 0x63, 0xf9, 0xda, 0x4a,
+    0x62, 0xef, 0x41, 0xfe, 0xfb, 0xe5, 0x0c, 0x1f, 0x22, 0x29, 0x52, 0x7e, 0xc5, 0x4e, 0x36, 0x35,
+    0x8a, 0x6e, 0x2c, 0x72, 0x38, 0x1c, 0x92, 0xc3, 0xe1, 0xcc, 0x90, 0x1c, 0x7e, 0x9d, 0x5d, 0x0d,
+    0xd3, 0xab, 0xc6, 0x0f, 0x3f, 0xf6, 0x3f, 0x5c, 0x9e, 0x4c, 0x67, 0xe9, 0x20, 0x9b, 0x67, 0xf9,
+    0xa4, 0x71, 0x9d, 0x8d, 0xae, 0xa7, 0x8d, 0xab, 0x71, 0x1e, 0x17, 0xe1, 0xc9, 0xd7, 0xe9, 0x78,
+    0x9e, 0x9e, 0x7c, 0x9d, 0x5d, 0x35, 0xbe, 0x22, 0xb0, 0xd9, 0x24, 0x1d, 0x3a, 0xe3, 0xfc, 0x7e,
+    0xea, 0x9e, 0x7c, 0x4d, 0x3f, 0x1b, 0xf0, 0x45, 0xa0, 0x26, 0xc3, 0xec, 0x4a, 0x05, 0xbb, 0x49,
+    0x87, 0xd9, 0xed, 0x8d, 0x04, 0xc9, 0x12, 0x8c, 0xc0, 0x58, 0x67, 0x09, 0x8a, 0x9f, 0x02, 0x90,
+    0xfe, 0xb9, 0x4b, 0x07, 0xbd, 0xc6, 0xed, 0x64, 0x1a, 0x0f, 0xfe, 0xec, 0x23, 0x71, 0xce, 0x20,
+    0x9f, 0xcc, 0x0b, 0x4a, 0x68, 0x03, 0x92, 0xd3, 0xe1, 0x3f, 0xe3, 0xf1, 0x6d, 0xea, 0x36, 0xfe,
+    0x93, 0x4d, 0x78, 0xca, 0xc5, 0xa4, 0xc0, 0xc4, 0x88, 0x24, 0x39, 0x32, 0x50, 0x08, 0x30, 0x77,
+    0x9d, 0x48, 0x05, 0x0b, 0x7a, 0xe7, 0xaf, 0xc2, 0x59, 0x5a, 0xdc, 0xce, 0x26, 0x0d, 0xa8, 0xd0,
+    0xb9, 0xeb, 0xf8, 0x2a, 0x44, 0xeb, 0xae, 0xe3, 0x11, 0x20, 0x37, 0x7c, 0x90, 0x09, 0xca, 0xc9,
+    0xbf, 0x59, 0xb1, 0x34, 0x90, 0xf4, 0x0b, 0xcd, 0x61, 0x44, 0x91, 0xff, 0x59, 0x82, 0x44, 0x10,
+    0x07, 0x09, 0x7a, 0x4a, 0xd5, 0xb4, 0x91, 0x65, 0x09, 0x37, 0xe8, 0xf6, 0x5e, 0xb7, 0x3b, 0xfe,
+    0x4d, 0x3e, 0x54, 0x0b, 0xfa, 0xbd, 0x76, 0xc7, 0xa5, 0x04, 0x9d, 0x35, 0x86, 0xe9, 0x20, 0x1f,
+    0xa6, 0xfd, 0x41, 0x3e, 0xce, 0x67, 0x8c, 0x1c, 0x24, 0x34, 0x9d, 0x40, 0xfa, 0xf0, 0x3b, 0x48,
+    0x27, 0xc4, 0x94, 0x15, 0x9d, 0x39, 0x4a, 0xa7, 0xca, 0x70, 0x7f, 0x74, 0x3e, 0x11, 0xa2, 0xce,
+    0xcf, 0x49, 0xa5, 0x76, 0x98, 0x2e, 0x87, 0x39, 0x21, 0x24, 0xd0, 0x96, 0x33, 0xe0, 0x9b, 0x6c,
+    0xd1, 0xc7, 0x96, 0x48, 0x64, 0x48, 0x43, 0xe0, 0xcb, 0x9d, 0x55, 0x94, 0x34, 0x91, 0x62, 0xf2,
+    0x48, 0x11, 0x22, 0x7c, 0xf9, 0xb3, 0xfb, 0xc9, 0x2f, 0x78, 0x63, 0xa5, 0x8a, 0xb4, 0x06, 0x9f,
+    0xb1, 0x9a, 0x90, 0xc6, 0x79, 0xa5, 0x2a, 0x84, 0xb8, 0xc9, 0x26, 0x98, 0x1d, 0x29, 0x7d, 0x86,
+    0x14, 0xcb, 0x85, 0x4b, 0x02, 0xd8, 0x37, 0x69, 0xb1, 0x1b, 0x52, 0x0c, 0xf1, 0x62, 0x2d, 0x0c,
+    0x3d, 0x0d, 0xc3, 0x29, 0x60, 0x90, 0x9a, 0xcb, 0x29, 0xf1, 0x39, 0x42, 0xde, 0xc4, 0x5e, 0x63,
+    0x94, 0x16, 0xfd, 0x69, 0x5c, 0x14, 0xe9, 0x6c, 0xd2, 0x9f, 0xe6, 0x73, 0xa5, 0x2f, 0xb3, 0x45,
+    0x3a, 0x26, 0x75, 0xe6, 0xb3, 0x61, 0xff, 0x76, 0x3a, 0x4d, 0x67, 0xbe, 0x25, 0x93, 0xcc, 0x51,
+    0x2d, 0x93, 0x21, 0x9c, 0x67, 0x9f, 0xb5, 0x61, 0xc8, 0xc6, 0x69, 0xff, 0x76, 0x92, 0x15, 0xf3,
+    0x7e, 0x91, 0xf7, 0x11, 0xc7, 0x5c, 0x29, 0x98, 0xcf, 0x69, 0xef, 0xf5, 0x1a, 0xf9, 0xd5, 0xd5,
+    0x3c, 0x2d, 0x22, 0xe0, 0x46, 0xfe, 0x7f, 0x95, 0x20, 0xb9, 0x22, 0x17, 0xe6, 0x4d, 0xbb, 0x63,
+    0x4a, 0x6b, 0x56, 0xa9, 0x55, 0xa0, 0x78, 0x5f, 0x39, 0x26, 0xfa, 0x3c, 0x42, 0x54, 0x93, 0x52,
+    0xe3, 0x06, 0x72, 0xb1, 0xf0, 0xe1, 0xe4, 0x6f, 0x5f, 0x9b, 0x65, 0x1c, 0x93, 0x45, 0xcf, 0x4f,
+    0xca, 0xfd, 0x8d, 0xd0, 0x3f, 0xcb, 0x92, 0xdb, 0x22, 0xa5, 0x1d, 0x1e, 0xc3, 0xa0, 0x87, 0xa4,
+    0xc5, 0x57, 0xf9, 0xec, 0x86, 0xf0, 0x5b, 0x41, 0x98, 0xbe, 0x4f, 0xfe, 0xcc, 0xb2, 0x45, 0x78,
+    0x97, 0x67, 0x43, 0x92, 0x94, 0x4d, 0x1c, 0x32, 0x26, 0xa3, 0x71, 0xff, 0x63, 0x3e, 0xcf, 0x0a,
+    0xd2, 0xba, 0x88, 0x43, 0x78, 0x38, 0xbd, 0x11, 0x85, 0xdf, 0xf1, 0xbb, 0x2e, 0x74, 0x08, 0x47,
+    0x45, 0xe7, 0x0f, 0xe5, 0x58, 0x81, 0x9f, 0x4d, 0x5f, 0x2e, 0xce, 0x2a, 0x35, 0x7c, 0x3f, 0x8b,
+    0x47, 0x94, 0xe1, 0x59, 0x49, 0xaf, 0x84, 0x3d, 0x61, 0x5d, 0xfd, 0xcb, 0x3f, 0x3f, 0xfc, 0xfa,
+    0xfe, 0xd7, 0x77, 0xff, 0xd3, 0xbf, 0xf8, 0xf9, 0xf2, 0xe3, 0x87, 0xef, 0x7e, 0xfb, 0xe5, 0xd7,
+    0x13, 0xa5, 0x24, 0xd2, 0xd4, 0x25, 0x12, 0x2b, 0xe4, 0x6d, 0x96, 0xa8, 0x52, 0x1b, 0x28, 0xd1,
+    0x4a, 0x24, 0x6d, 0x5f, 0x1e, 0xdb, 0x7e, 0x5c, 0x9b, 0x9b, 0x54, 0x72, 0x75, 0xd6, 0xac, 0x03,
+    0x40, 0x0e, 0xac, 0x74, 0xca, 0x7c, 0x10, 0x8f, 0xe5, 0x7a, 0xd5, 0xf4, 0xa4, 0x92, 0x6e, 0xe2,
+    0xd5, 0xd0, 0x38, 0xbc, 0x77, 0xf1, 0x6c, 0x99, 0x4d, 0x46, 0x34, 0xe9, 0x0e, 0x92, 0x48, 0x35,
+    0x86, 0xc4, 0x64, 0x8b, 0x21, 0x67, 0xe8, 0x22, 0x5d, 0x8e, 0x18, 0xba, 0xc4, 0x37, 0xf4, 0x82,
+    0x2f, 0xda, 0xed, 0xe9, 0x03, 0xe0, 0x9b, 0x9b, 0xe8, 0x63, 0xe5, 0xbc, 0xe2, 0x64, 0xe7, 0x8a,
+    0x13, 0xbd, 0xe2, 0x64, 0x45, 0xc5, 0x2a, 0x93, 0xcb, 0xac, 0x51, 0x8c, 0xed, 0x6c, 0x93, 0xcc,
+    0xec, 0x79, 0xa4, 0x5c, 0x52, 0x53, 0xae, 0x92, 0x57, 0xa4, 0x0b, 0x94, 0x3f, 0x3a, 0x47, 0xdc,
+    0x48, 0x3c, 0xad, 0x4f, 0x35, 0x9e, 0x3e, 0x8f, 0x6f, 0xa6, 0xe3, 0x74, 0xd6, 0x7b, 0x4f, 0xf2,
+    0xb2, 0x9b, 0x78, 0x94, 0x6e, 0xcb, 0x1d, 0x98, 0x83, 0x18, 0xb0, 0x57, 0x51, 0x50, 0xb3, 0xd2,
+    0x3e, 0x4e, 0x3f, 0x2e, 0xd0, 0x23, 0x58, 0x81, 0xd4, 0x4e, 0x0a, 0x44, 0x1b, 0x7c, 0xb5, 0x87,
+    0xa4, 0x8c, 0x12, 0x35, 0x5b, 0x0c, 0x51, 0x20, 0x74, 0x23, 0x92, 0x4f, 0x64, 0x75, 0xda, 0x7b,
+    0xef, 0xb0, 0x06, 0xf8, 0x94, 0x1d, 0x54, 0x72, 0x08, 0x63, 0x94, 0x04, 0x25, 0x2a, 0x41, 0xbd,
+    0x2a, 0x45, 0x89, 0x8d, 0xa2, 0xc4, 0x48, 0x51, 0x3f, 0x91, 0x69, 0xea, 0x99, 0x69, 0xea, 0xb9,
+    0xa1, 0x22, 0x98, 0xa0, 0x52, 0xda, 0x06, 0x9f, 0x16, 0xf3, 0x71, 0xc4, 0xdc, 0xc3, 0xc8, 0xb8,
+    0x24, 0xcf, 0xc7, 0x42, 0x98, 0xdc, 0x67, 0xc5, 0x35, 0x01, 0x98, 0xea, 0xb9, 0xd3, 0xac, 0x18,
+    0x5c, 0x57, 0x73, 0x19, 0xdb, 0x91, 0x46, 0xce, 0x6e, 0x89, 0x16, 0x82, 0x38, 0x44, 0x26, 0x2c,
+    0x5d, 0x82, 0xdb, 0x86, 0xe9, 0x5d, 0x36, 0x48, 0xd9, 0x6c, 0x9b, 0xc5, 0x44, 0x74, 0x08, 0x38,
+    0x49, 0xed, 0x87, 0x75, 0x21, 0xbe, 0x49, 0x67, 0x31, 0x4c, 0xae, 0x41, 0x3a, 0x21, 0x9d, 0xdd,
+    0x1f, 0x66, 0xf3, 0x22, 0x9e, 0x0c, 0xd2, 0x95, 0x12, 0xec, 0x94, 0xb0, 0xe3, 0x30, 0x2e, 0x62,
+    0xec, 0xac, 0x09, 0xf4, 0xd6, 0x7f, 0xbf, 0xbb, 0xec, 0xff, 0xfe, 0xf3, 0xc5, 0xf7, 0xbf, 0xfc,
+    0xfa, 0x53, 0x9f, 0xad, 0x1b, 0x27, 0x46, 0xea, 0x30, 0xab, 0x5f, 0x48, 0x55, 0x50, 0xa2, 0x70,
+    0x28, 0x63, 0xb6, 0x56, 0xf1, 0xaa, 0xa4, 0x2c, 0x9a, 0xc1, 0x56, 0x71, 0xb5, 0x3d, 0xca, 0x32,
+    0x27, 0x2d, 0xca, 0x06, 0xc2, 0x66, 0x31, 0x59, 0xb9, 0xe7, 0x66, 0xca, 0x68, 0x9e, 0x42, 0x1a,
+    0x57, 0x21, 0x58, 0x2f, 0x50, 0x08, 0x41, 0x9d, 0xa2, 0x60, 0x34, 0x58, 0xa6, 0x46, 0xa1, 0x0a,
+    0xc3, 0x2b, 0x59, 0x41, 0x65, 0x32, 0xbe, 0xb5, 0xf4, 0x1e, 0xe4, 0x28, 0x14, 0x62, 0x2e, 0x23,
+    0x0f, 0x32, 0x05, 0x71, 0x52, 0x31, 0x4c, 0xd7, 0xe8, 0xaa, 0x60, 0x5d, 0x41, 0x12, 0x9b, 0x1d,
+    0xe6, 0xf2, 0x2c, 0xd3, 0x4a, 0x98, 0x50, 0x35, 0xaa, 0xb4, 0x95, 0xb3, 0xce, 0x4e, 0x9e, 0x04,
+    0x53, 0x43, 0xe1, 0xbc, 0x98, 0xe5, 0x7f, 0xa6, 0x75, 0xac, 0x27, 0x43, 0xd8, 0x39, 0x50, 0x86,
+    0x32, 0x31, 0xa2, 0x92, 0x5f, 0xc7, 0x8f, 0x3a, 0xe0, 0x6a, 0xda, 0xef, 0xb3, 0x61, 0x71, 0x5d,
+    0x4b, 0x3b, 0x42, 0xd4, 0xb1, 0xa8, 0x0c, 0x67, 0x61, 0x54, 0x05, 0x64, 0x05, 0xbb, 0xea, 0xb0,
+    0xab, 0xdb, 0x50, 0xcb, 0x28, 0x2a, 0x8c, 0x95, 0x5f, 0x54, 0x30, 0x13, 0xdb, 0x68, 0x10, 0x75,
+    0xdc, 0x53, 0x05, 0xa5, 0xae, 0x06, 0xb1, 0x8e, 0xc2, 0x2f, 0xb2, 0x96, 0xd6, 0x8a, 0xb2, 0x01,
+    0x55, 0x88, 0x75, 0x53, 0x94, 0xc9, 0x2b, 0x5f, 0x88, 0x35, 0x97, 0x93, 0xa2, 0x4b, 0xae, 0x68,
+    0x23, 0xf9, 0x44, 0xff, 0x44, 0xba, 0x8d, 0xcd, 0x25, 0x90, 0x5f, 0x0a, 0x2b, 0x51, 0xa1, 0x49,
+    0x18, 0x45, 0x9b, 0xc8, 0x1b, 0xf8, 0xc7, 0x50, 0x23, 0x24, 0xfb, 0x5c, 0xf0, 0x88, 0xda, 0x34,
+    0xe9, 0x12, 0x6d, 0x24, 0x43, 0xd8, 0x5f, 0x43, 0x65, 0x2c, 0xc7, 0x97, 0x44, 0x8a, 0xa9, 0x4a,
+    0x81, 0x60, 0x1b, 0xd1, 0x20, 0x7f, 0x98, 0x46, 0x54, 0xce, 0xf7, 0x75, 0xa1, 0x61, 0x1a, 0x5f,
+    0x15, 0xe1, 0xd6, 0xd3, 0x5e, 0xfe, 0x30, 0x74, 0x8d, 0x9c, 0xed, 0xeb, 0xf2, 0xc0, 0xc2, 0x05,
+    0x2a, 0xca, 0x1d, 0x26, 0xb3, 0xfa, 0x69, 0xa7, 0xae, 0x1c, 0x3f, 0x7d, 0xa6, 0x9b, 0x86, 0x51,
+    0xc7, 0x6a, 0x9d, 0xaa, 0xe8, 0xdb, 0xa2, 0x8a, 0x4f, 0x84, 0x15, 0x82, 0x5a, 0x49, 0xed, 0x1f,
+    0x70, 0x8b, 0x79, 0xe4, 0x9f, 0x56, 0xa9, 0x5d, 0x0e, 0xb2, 0xd9, 0x80, 0xe8, 0x57, 0x54, 0xa7,
+    0x89, 0x48, 0x55, 0x38, 0xac, 0x04, 0xd8, 0xeb, 0xb4, 0xcf, 0xdd, 0x90, 0x18, 0xeb, 0x8e, 0xae,
+    0x65, 0x71, 0x55, 0x7a, 0x90, 0xcf, 0x26, 0x44, 0x0f, 0x9a, 0x72, 0x8b, 0x4b, 0x41, 0xc5, 0x4a,
+    0xaa, 0xda, 0x1b, 0x29, 0xa9, 0x15, 0x6a, 0x46, 0x8c, 0x54, 0xcf, 0xa1, 0x93, 0xaf, 0x29, 0xf7,
+    0x3b, 0x68, 0x9a, 0xaa, 0x0e, 0xf7, 0xd0, 0x80, 0x7e, 0x61, 0xee, 0xaa, 0xe9, 0x2c, 0xff, 0xdf,
+    0x74, 0x50, 0xa4, 0x43, 0x4e, 0xbe, 0x6a, 0xf3, 0x29, 0xf4, 0x50, 0xdb, 0x6f, 0xb7, 0xda, 0x3d,
+    0x47, 0xaf, 0xb1, 0x7d, 0x1f, 0xd4, 0x68, 0x86, 0xc4, 0xf2, 0xb2, 0x5b, 0xa4, 0x1a, 0x29, 0xcc,
+    0x1d, 0xc1, 0x9a, 0x57, 0x53, 0xac, 0xda, 0x28, 0x4b, 0x4f, 0x4b, 0x38, 0xda, 0x8b, 0xe5, 0xa6,
+    0x4d, 0xad, 0x53, 0x78, 0x0d, 0x54, 0x6e, 0x51, 0x83, 0x5c, 0xfa, 0x3e, 0x7c, 0x78, 0x90, 0x78,
+    0x3d, 0x9e, 0x14, 0x59, 0x3c, 0xce, 0xe2, 0x39, 0x8a, 0x4b, 0xc2, 0xac, 0x81, 0x49, 0x51, 0x0f,
+    0x8c, 0xf5, 0x84, 0x54, 0xd9, 0x06, 0xd6, 0x3f, 0x75, 0x58, 0x8d, 0xed, 0x85, 0xcf, 0x7f, 0x2d,
+    0x7d, 0x05, 0x39, 0x1a, 0xc7, 0x1b, 0xeb, 0xea, 0xfb, 0xd6, 0xb8, 0x0f, 0xa3, 0x33, 0xef, 0x59,
+    0xf9, 0x3d, 0x9c, 0xfe, 0xfa, 0x14, 0x7a, 0xe7, 0x53, 0x6a, 0x8b, 0x7b, 0x56, 0xf1, 0x98, 0x7a,
+    0x67, 0x63, 0xfe, 0x75, 0x94, 0x35, 0x2b, 0x67, 0xaf, 0xad, 0x78, 0x59, 0x78, 0x76, 0xb5, 0x2a,
+    0x65, 0x67, 0xc8, 0x75, 0x75, 0xa2, 0x15, 0xdc, 0xb6, 0xb9, 0x32, 0xb3, 0x82, 0x95, 0xb6, 0x52,
+    0x43, 0x56, 0x32, 0xc9, 0xce, 0xaa, 0x03, 0xca, 0x41, 0x22, 0xd7, 0x43, 0x8a, 0x84, 0x0b, 0xef,
+    0x71, 0x3a, 0x19, 0x11, 0xca, 0xe8, 0x1f, 0x2e, 0x60, 0xdd, 0xd0, 0x2a, 0xbd, 0x19, 0x9e, 0xcf,
+    0xa1, 0x96, 0x49, 0xd6, 0x50, 0xcc, 0x6f, 0xdd, 0xc4, 0x0b, 0x07, 0xf5, 0x66, 0x4d, 0x30, 0x2b,
+    0x23, 0xd5, 0x2f, 0xa2, 0xf9, 0x4d, 0x9e, 0x17, 0xd7, 0xf3, 0x22, 0x9d, 0x3a, 0x9d, 0x76, 0xc7,
+    0xd7, 0x11, 0xf9, 0x2a, 0x81, 0x54, 0xc5, 0xa1, 0x38, 0x98, 0x3a, 0x1a, 0xc9, 0x7d, 0xd9, 0xf8,
+    0x47, 0x83, 0x60, 0xe9, 0x36, 0xbe, 0x85, 0x3f, 0x8d, 0x6f, 0x1a, 0x12, 0xf6, 0x0a, 0x66, 0xa8,
+    0x4e, 0xc3, 0x4e, 0x19, 0xd6, 0xbc, 0x02, 0x69, 0x5e, 0x34, 0xd1, 0x02, 0x4f, 0xf8, 0xd3, 0x3c,
+    0xae, 0xfa, 0xc9, 0x1c, 0xe3, 0x69, 0x6a, 0xa1, 0xa4, 0x44, 0xef, 0xe0, 0x63, 0xdb, 0xf7, 0xee,
+    0x89, 0x7d, 0x43, 0xa4, 0x24, 0x67, 0xa5, 0xab, 0x8f, 0x8b, 0x26, 0xb3, 0xbf, 0xce, 0xe6, 0x18,
+    0xe6, 0xe9, 0x19, 0xd1, 0x4e, 0x26, 0x73, 0xc8, 0x59, 0x67, 0x2f, 0x81, 0xd5, 0x61, 0x5b, 0xe0,
+    0xef, 0x53, 0x32, 0xbd, 0x0b, 0xb3, 0xe4, 0xa4, 0x79, 0x66, 0x67, 0x08, 0xd4, 0x46, 0xf3, 0x35,
+    0x37, 0x08, 0x2d, 0xcc, 0xb2, 0x8c, 0x2b, 0x91, 0x8a, 0xfe, 0x10, 0x3e, 0xb9, 0xcd, 0x54, 0x08,
+    0xba, 0xdb, 0x29, 0xd3, 0xfa, 0xef, 0x0f, 0xbf, 0xfe, 0x82, 0x6a, 0x19, 0x6e, 0x73, 0x07, 0xdd,
+    0x57, 0xed, 0x4e, 0x28, 0x36, 0xf1, 0x7e, 0x78, 0xf7, 0xfb, 0xe5, 0x65, 0xff, 0xbb, 0x5f, 0x3e,
+    0x7c, 0x4f, 0xa6, 0xd6, 0xe9, 0xdb, 0x37, 0x6f, 0xcf, 0x7a, 0xbd, 0x37, 0x9d, 0xb3, 0x4e, 0xf7,
+    0xec, 0xb4, 0xf7, 0x7a, 0x6d, 0x4f, 0x02, 0x1b, 0x07, 0xfa, 0xc7, 0x60, 0x43, 0xd1, 0x0c, 0xbf,
+    0x1c, 0x14, 0xcd, 0xd8, 0x94, 0xbb, 0x3d, 0xda, 0xac, 0x6f, 0xcd, 0x6b, 0xd4, 0xa3, 0x7b, 0x17,
+    0xd8, 0x69, 0x09, 0xe4, 0xf5, 0x61, 0x7f, 0x2d, 0x8b, 0x8d, 0x22, 0xbc, 0x8c, 0xe6, 0xff, 0x37,
+    0x2b, 0x9c, 0x16, 0x49, 0xf6, 0xc6, 0xf9, 0xc8, 0x81, 0xd1, 0x08, 0x68, 0x03, 0x03, 0x69, 0x36,
+    0x04, 0xe5, 0x40, 0xb8, 0x6e, 0x70, 0x4a, 0x86, 0x48, 0x30, 0x7f, 0x74, 0xe9, 0xe9, 0x15, 0x87,
+    0x9a, 0xf0, 0xe7, 0xba, 0x3c, 0x25, 0xba, 0x62, 0x87, 0x51, 0xfb, 0x2b, 0x9f, 0xd3, 0x59, 0xae,
+    0x9b, 0x8d, 0x4d, 0x06, 0x4c, 0xa5, 0x84, 0x51, 0x94, 0xc0, 0xcc, 0x94, 0xe4, 0x82, 0x3a, 0x13,
+    0xca, 0x19, 0xbd, 0xd5, 0xe4, 0x7d, 0xac, 0x09, 0xb8, 0x21, 0x43, 0x5b, 0xf5, 0x26, 0x46, 0xd6,
+    0x3a, 0x8c, 0x49, 0x73, 0x87, 0x51, 0x8b, 0x74, 0xa3, 0x47, 0xc6, 0x0c, 0xff, 0x1f, 0xe6, 0x85,
+    0x23, 0xda, 0xee, 0x8b, 0x5f, 0x9c, 0x1f, 0xee, 0xe2, 0x71, 0x44, 0xd1, 0x78, 0x52, 0xd7, 0x79,
+    0x25, 0xd9, 0x5e, 0xba, 0x98, 0x3a, 0x43, 0x6d, 0x59, 0xc2, 0x81, 0x23, 0x45, 0x61, 0xa7, 0x89,
+    0xff, 0xef, 0x1e, 0x60, 0xcf, 0xfa, 0x3e, 0x9f, 0x8d, 0x87, 0xeb, 0xee, 0xfa, 0x6e, 0xb4, 0x26,
+    0x79, 0x0c, 0xb9, 0xb4, 0xcd, 0xdb, 0x5e, 0x44, 0x31, 0xfd, 0xcb, 0xbe, 0x97, 0x20, 0xb6, 0x5a,
+    0x34, 0x6d, 0x29, 0x33, 0x60, 0x75, 0x97, 0xd1, 0x94, 0x43, 0xd7, 0xe4, 0x19, 0x49, 0xb1, 0x9f,
+    0x10, 0x58, 0xd1, 0x08, 0x76, 0xac, 0xc4, 0xb0, 0x03, 0x87, 0xc0, 0x6e, 0x7b, 0x26, 0x6d, 0xd4,
+    0x29, 0x50, 0x65, 0xe5, 0x3e, 0x4a, 0x89, 0xc2, 0x87, 0xb9, 0xa6, 0x0d, 0xeb, 0x4e, 0x87, 0x10,
+    0x3a, 0xeb, 0x28, 0x0f, 0x95, 0xc4, 0x78, 0x32, 0xb8, 0xce, 0x67, 0xe6, 0x3c, 0x3e, 0x61, 0xab,
+    0x98, 0xc6, 0xf1, 0x20, 0x35, 0xf0, 0xc1, 0xfc, 0x3a, 0xbb, 0x2a, 0xc2, 0xb5, 0x38, 0xa9, 0x5e,
+    0x5b, 0xb0, 0xbb, 0x2f, 0xf8, 0x08, 0xb1, 0xd9, 0xc3, 0x49, 0xd1, 0x93, 0x27, 0x79, 0xf1, 0xfb,
+    0x1c, 0xd2, 0xb5, 0x3d, 0x64, 0xc9, 0xef, 0xf4, 0x31, 0x27, 0xd3, 0xad, 0xc2, 0x8a, 0x65, 0x7f,
+    0x50, 0x4e, 0x94, 0xe7, 0x7d, 0x49, 0x15, 0x83, 0xe2, 0x54, 0x45, 0x2a, 0xd2, 0xf6, 0xbd, 0x5a,
+    0x2c, 0x1f, 0x8f, 0xf1, 0x9c, 0x4e, 0x7f, 0x9a, 0xce, 0xe6, 0x53, 0x02, 0x97, 0xdd, 0xa5, 0xd4,
+    0x0b, 0x12, 0x0d, 0xc6, 0x84, 0x23, 0xc8, 0xd0, 0x9d, 0x37, 0x41, 0x66, 0x38, 0x35, 0x2d, 0x0f,
+    0xac, 0xb5, 0xbb, 0xa8, 0xe3, 0x9e, 0xc1, 0xf0, 0xaf, 0x54, 0xfc, 0xb8, 0xa8, 0xd0, 0xbd, 0x3f,
+    0x8e, 0x18, 0xed, 0x26, 0x1b, 0xc6, 0x15, 0x3e, 0x1f, 0xaf, 0xa6, 0x55, 0x21, 0x1f, 0x96, 0x88,
+    0xb3, 0x0a, 0x4e, 0x61, 0x36, 0x26, 0x65, 0xe2, 0x52, 0xf6, 0xdf, 0x6c, 0x33, 0xa0, 0xcc, 0x2a,
+    0x19, 0x4f, 0xaf, 0xe3, 0x88, 0xf4, 0x5f, 0x68, 0x94, 0x72, 0xd8, 0x68, 0xde, 0x70, 0x0f, 0x81,
+    0xd1, 0xeb, 0xc6, 0xab, 0x6a, 0xfc, 0x57, 0x03, 0xa6, 0xa2, 0x49, 0x01, 0x96, 0x4a, 0xe2, 0x74,
+    0x65, 0xa5, 0x1f, 0x68, 0x71, 0x46, 0x92, 0xb1, 0xbc, 0x17, 0xb5, 0xbb, 0xe1, 0xc3, 0x41, 0x66,
+    0xe1, 0xb3, 0x9a, 0x6e, 0x5a, 0xba, 0xb6, 0x8d, 0xac, 0x29, 0x02, 0xe6, 0x64, 0xae, 0xa4, 0x1c,
+    0x67, 0xae, 0x71, 0xe6, 0xca, 0xf4, 0x4d, 0xe3, 0xe1, 0x90, 0x74, 0x60, 0xff, 0x2a, 0x1e, 0x14,
+    0x39, 0xf8, 0x5a, 0x7b, 0x95, 0x89, 0x2d, 0xf8, 0xa7, 0x32, 0x9d, 0xd5, 0xc2, 0xfb, 0x98, 0xdd,
+    0x7c, 0xfc, 0xa3, 0x38, 0x99, 0x97, 0x02, 0xa6, 0xbd, 0x74, 0x25, 0x65, 0xb6, 0xa4, 0x4f, 0xa5,
+    0x27, 0xd4, 0xf8, 0x21, 0xda, 0xc0, 0xc7, 0x5d, 0x4b, 0xbd, 0xa4, 0x36, 0x88, 0xd5, 0xff, 0x8e,
+    0x40, 0xa1, 0x07, 0x9e, 0xd7, 0xfd, 0x3c, 0xb8, 0x5e, 0x17, 0x6f, 0x92, 0x6a, 0xb1, 0xb1, 0x70,
+    0x1b, 0x6c, 0x2b, 0xd5, 0x06, 0x4c, 0x9c, 0xf5, 0xf8, 0x71, 0x68, 0x85, 0x60, 0xcd, 0xa3, 0xa4,
+    0x35, 0xc7, 0xad, 0x75, 0x3f, 0x95, 0xba, 0xb0, 0x67, 0xc2, 0x19, 0x1a, 0x5c, 0x6a, 0x5d, 0x62,
+    0xb1, 0x1a, 0x81, 0x03, 0xc3, 0x28, 0x2a, 0x16, 0x1c, 0x1f, 0x95, 0xba, 0xaa, 0x38, 0xff, 0x00,
+    0x4b, 0xa5, 0xc3, 0x51, 0x8a, 0x7c, 0x6b, 0xf4, 0x1d, 0xd5, 0x3a, 0xb8, 0x5a, 0xca, 0x06, 0x26,
+    0xf4, 0x74, 0x4b, 0xc7, 0x6c, 0xf5, 0x32, 0x51, 0xf7, 0xe3, 0xc3, 0xe1, 0x0e, 0xce, 0x1a, 0x76,
+    0x39, 0x56, 0x1e, 0x93, 0xdd, 0x90, 0xbe, 0x2f, 0xed, 0xe4, 0xd4, 0x73, 0x3a, 0x00, 0x54, 0x31,
+    0x50, 0x9f, 0xfc, 0xdc, 0xc6, 0x01, 0x8e, 0x36, 0xac, 0xcb, 0xc3, 0x4f, 0xb2, 0xcb, 0xf7, 0xc8,
+    0x3b, 0x64, 0x7b, 0xde, 0xb9, 0xd9, 0x68, 0xfb, 0xc4, 0x60, 0x8b, 0x3e, 0xca, 0x51, 0xd1, 0x0d,
+    0x64, 0x85, 0xd1, 0xdf, 0x60, 0xb0, 0xca, 0x6d, 0x83, 0x73, 0x5b, 0x8c, 0xb3, 0x49, 0xed, 0xd1,
+    0x38, 0x05, 0xc4, 0x2e, 0x63, 0x14, 0x30, 0x93, 0xac, 0x51, 0x01, 0xea, 0xb8, 0xaa, 0x02, 0xf9,
+    0x82, 0x64, 0x8f, 0xda, 0xe1, 0xca, 0x97, 0x49, 0x16, 0x29, 0x00, 0x7e, 0x65, 0x30, 0x4c, 0xb2,
+    0x49, 0xc3, 0xb9, 0x55, 0x6f, 0x3e, 0xb5, 0xac, 0x42, 0x9e, 0x8d, 0x1c, 0x55, 0x37, 0x0f, 0x14,
+    0x8d, 0xbb, 0x09, 0x93, 0x26, 0x00, 0xaf, 0x30, 0xe7, 0x7a, 0xf5, 0x6c, 0xc3, 0x46, 0x8c, 0x7f,
+    0x70, 0x76, 0x3d, 0x9c, 0x30, 0x54, 0x1b, 0xba, 0x0d, 0x9f, 0xec, 0x28, 0x24, 0x4b, 0x55, 0xb1,
+    0xd4, 0x63, 0xc9, 0xc0, 0xb4, 0x84, 0x18, 0xcc, 0x67, 0xc4, 0x20, 0x5a, 0x72, 0x0d, 0x91, 0x6a,
+    0xef, 0xe0, 0xb7, 0xd4, 0xb6, 0x40, 0x41, 0xfb, 0x06, 0x2c, 0xba, 0x2a, 0x28, 0x93, 0xed, 0x39,
+    0x58, 0x9c, 0x4b, 0xe1, 0xc3, 0x79, 0x78, 0x1f, 0xef, 0xba, 0x11, 0x3f, 0xa9, 0x81, 0xd6, 0xcd,
+    0xae, 0xd7, 0x85, 0xd6, 0x9f, 0x0e, 0xcf, 0xfe, 0x0c, 0x37, 0xbf, 0xf4, 0x71, 0x35, 0xcb, 0x6f,
+    0xcc, 0x78, 0x64, 0x08, 0x23, 0xad, 0xb0, 0x4c, 0xc9, 0x40, 0x2a, 0xc1, 0xec, 0xd6, 0xa8, 0x94,
+    0x6d, 0x22, 0x9a, 0x0d, 0x8f, 0x0e, 0xb7, 0x06, 0xe1, 0x45, 0x5e, 0x4f, 0x36, 0xb1, 0x74, 0x56,
+    0x11, 0x5d, 0xe4, 0x35, 0x24, 0x93, 0xcc, 0x35, 0x08, 0xa6, 0x50, 0xeb, 0x2f, 0x57, 0x4f, 0x75,
+    0x2e, 0x57, 0x19, 0x6e, 0xf9, 0x23, 0x8a, 0xfb, 0xa6, 0x41, 0x92, 0xb6, 0x7e, 0xd5, 0x51, 0x8c,
+    0xb6, 0x1d, 0xac, 0xf2, 0x67, 0x14, 0xf7, 0xab, 0x9d, 0x6c, 0xac, 0x90, 0xc0, 0x9a, 0xbb, 0x5a,
+    0xbe, 0x75, 0x0b, 0x37, 0xac, 0x22, 0x99, 0x26, 0x38, 0x76, 0xa2, 0x40, 0xc0, 0x55, 0x2b, 0x15,
+    0xe2, 0xf3, 0x7d, 0xa8, 0xe3, 0x48, 0xa2, 0xb2, 0x22, 0x13, 0x06, 0x25, 0x9f, 0x94, 0x67, 0x1e,
+    0x30, 0x10, 0x3c, 0xbf, 0xa2, 0x43, 0x8e, 0x09, 0x99, 0xf6, 0x22, 0x2c, 0x2f, 0xff, 0xaa, 0x39,
+    0xfc, 0x34, 0x0c, 0x90, 0x70, 0xc9, 0x9c, 0x4a, 0x34, 0x87, 0x1f, 0x70, 0x29, 0x72, 0x35, 0xfd,
+    0x3e, 0x5c, 0x6f, 0x7d, 0x07, 0x5a, 0x89, 0x30, 0x9f, 0x8e, 0xe3, 0x25, 0xbb, 0x4e, 0x48, 0xf7,
+    0x82, 0x1d, 0xb9, 0x0b, 0xda, 0x8b, 0x96, 0xdc, 0x67, 0xed, 0x85, 0x1b, 0x94, 0xe4, 0xfb, 0x2a,
+    0xe8, 0x52, 0x05, 0x5d, 0xca, 0xa0, 0xa6, 0xfa, 0x92, 0x6a, 0x7d, 0x89, 0x5a, 0x5f, 0x52, 0x53,
+    0x5f, 0xa2, 0xd6, 0x97, 0x54, 0xea, 0xdb, 0xf1, 0xd6, 0xa5, 0xe8, 0x70, 0x4f, 0xed, 0x24, 0x5f,
+    0x8c, 0xd1, 0x63, 0x5d, 0xb3, 0x64, 0x03, 0xa8, 0xd6, 0x93, 0x58, 0xea, 0xd9, 0x42, 0x23, 0x5b,
+    0x71, 0x35, 0xd2, 0xbe, 0x11, 0xc9, 0xc5, 0xe3, 0x55, 0x3c, 0x4c, 0xf7, 0xba, 0xe4, 0x1d, 0x6e,
+    0xd5, 0x3a, 0xf4, 0x72, 0xb3, 0xcf, 0xb5, 0x62, 0x1f, 0x07, 0x0f, 0x95, 0xce, 0xda, 0x46, 0xa0,
+    0xd7, 0xf6, 0xc6, 0x17, 0x27, 0xb0, 0x37, 0xbb, 0xc1, 0x6b, 0xb9, 0xbf, 0xfb, 0x44, 0xb7, 0x77,
+    0x2d, 0x77, 0x77, 0x1f, 0xed, 0xe6, 0xee, 0x9e, 0x8d, 0x0a, 0xd3, 0x5d, 0x60, 0x10, 0x44, 0xcc,
+    0xf5, 0xef, 0x1d, 0x30, 0xe8, 0xc1, 0xf3, 0xb0, 0x24, 0x8e, 0x66, 0xc3, 0xd1, 0x6c, 0x38, 0x9a,
+    0x0d, 0x47, 0xb3, 0xc1, 0x62, 0x36, 0xfc, 0x3b, 0xcf, 0x6f, 0x76, 0x37, 0x1d, 0x5e, 0xba, 0x55,
+    0x70, 0x90, 0x80, 0x2d, 0xb5, 0xa6, 0x83, 0x18, 0xa7, 0x03, 0x98, 0x0f, 0x95, 0xba, 0x56, 0x5b,
+    0x03, 0x8a, 0xce, 0xff, 0x18, 0x11, 0x51, 0x8e, 0xaa, 0xff, 0x51, 0xf5, 0x3f, 0xaa, 0xfe, 0x2f,
+    0x4b, 0xf5, 0x5f, 0x53, 0x51, 0x3f, 0x8c, 0x8a, 0x7e, 0x4a, 0x52, 0xc7, 0x70, 0x18, 0x5d, 0x0d,
+    0xa4, 0xc6, 0xa7, 0x94, 0xc8, 0x96, 0x37, 0x70, 0x15, 0x59, 0x82, 0xb9, 0xe5, 0x0d, 0x00, 0x5d,
+    0x12, 0xde, 0xa5, 0xb3, 0x22, 0x23, 0x12, 0xb6, 0x3f, 0x82, 0x73, 0x34, 0xe9, 0xa4, 0x08, 0x6b,
+    0x25, 0xd2, 0xea, 0xc3, 0x93, 0xa0, 0x17, 0x4e, 0x48, 0x79, 0x82, 0x32, 0x55, 0x36, 0x8a, 0xcf,
+    0x88, 0xd0, 0xe4, 0x5b, 0x3f, 0xe6, 0x5b, 0xb4, 0xb1, 0xf5, 0x9a, 0x2c, 0xc9, 0xb1, 0xdf, 0x13,
+    0x82, 0xdc, 0xfa, 0x9b, 0x08, 0x1c, 0xa2, 0x46, 0xb4, 0x5d, 0xd7, 0x5c, 0x54, 0xba, 0x5e, 0x71,
+    0x51, 0xe9, 0x7a, 0x8d, 0xcb, 0x10, 0xd7, 0xeb, 0xdc, 0x98, 0xd9, 0xf5, 0x00, 0xce, 0xfa, 0x27,
+    0x29, 0xd6, 0xd1, 0xb1, 0x71, 0x3c, 0xe4, 0x56, 0x40, 0x82, 0x29, 0x4a, 0x07, 0x49, 0xf6, 0xf9,
+    0x20, 0x19, 0xef, 0x0d, 0xd1, 0x82, 0x1b, 0x0c, 0x83, 0x5c, 0xf8, 0xda, 0x76, 0x67, 0xe9, 0x9a,
+    0xdf, 0x59, 0xba, 0xae, 0xbb, 0xb3, 0xc4, 0x8b, 0x6f, 0x32, 0x02, 0xd5, 0x93, 0x1d, 0x8f, 0x78,
+    0x88, 0x07, 0x67, 0x2d, 0x9d, 0x21, 0x91, 0x34, 0x55, 0x88, 0xd4, 0xfe, 0x1c, 0x62, 0x47, 0xc1,
+    0x0d, 0x4e, 0x70, 0x1d, 0xc0, 0x87, 0x1b, 0x32, 0xfa, 0x79, 0x22, 0xfd, 0xe4, 0x6e, 0x07, 0x1a,
+    0x1e, 0x93, 0xe2, 0x68, 0x2f, 0xf0, 0x7a, 0xd3, 0x4a, 0x25, 0xb0, 0xc0, 0x83, 0x84, 0x9d, 0xc6,
+    0xb7, 0xac, 0x6b, 0x1a, 0xdf, 0xe0, 0xf8, 0x80, 0x6a, 0x28, 0xdd, 0xef, 0xbc, 0xc3, 0xa0, 0xb6,
+    0xf8, 0xb3, 0x3d, 0xf3, 0x3a, 0xed, 0x5e, 0xb7, 0xf7, 0xaa, 0x49, 0x3f, 0x47, 0xe4, 0xf3, 0x75,
+    0xf7, 0xbc, 0xc7, 0x3e, 0x13, 0xf2, 0xd9, 0x79, 0xdd, 0xeb, 0x85, 0x6c, 0x7a, 0xab, 0x47, 0x1a,
+    0xc5, 0x29, 0x59, 0xca, 0xa8, 0x37, 0x09, 0xc8, 0x18, 0x94, 0x49, 0x02, 0xee, 0xd4, 0x2f, 0xff,
+    0x41, 0x50, 0x44, 0xd3, 0x8c, 0x64, 0x60, 0xe1, 0x8f, 0x99, 0xc1, 0xd1, 0xd1, 0x7c, 0x42, 0xfa,
+    0x8e, 0x1e, 0xf7, 0x85, 0xcb, 0x3c, 0xb4, 0xfd, 0x41, 0xf7, 0xd5, 0xe9, 0x9b, 0x33, 0x08, 0x25,
+    0x2b, 0x24, 0xa2, 0x5b, 0x56, 0x2f, 0x97, 0x04, 0x99, 0x0e, 0x92, 0xb8, 0xa5, 0x4b, 0x47, 0x17,
+    0xe2, 0xa3, 0xd2, 0xac, 0xb2, 0x13, 0x9a, 0x55, 0x28, 0xc0, 0xe8, 0x4b, 0x18, 0x69, 0xd0, 0x08,
+    0x36, 0x0c, 0xcb, 0xc6, 0x57, 0x11, 0xdc, 0xfc, 0x68, 0xfc, 0x47, 0x82, 0xf0, 0x22, 0x5e, 0x63,
+    0x45, 0xe0, 0xba, 0x4d, 0xc7, 0x90, 0xea, 0xd1, 0xe6, 0x39, 0x45, 0x13, 0xd9, 0xc0, 0x9b, 0xe6,
+    0xf7, 0x0e, 0x1d, 0xaf, 0xa0, 0x7b, 0xde, 0x61, 0xe7, 0x44, 0x7d, 0x68, 0x09, 0x19, 0x0c, 0xf2,
+    0xf1, 0xf6, 0x8d, 0x6f, 0x6e, 0x11, 0xd0, 0x8a, 0xc1, 0x7b, 0xfb, 0x6c, 0x30, 0x9b, 0xac, 0xe7,
+    0xf8, 0xd8, 0xca, 0x54, 0xca, 0x6b, 0x4d, 0x7b, 0xc6, 0xd0, 0x43, 0x5d, 0xa7, 0x32, 0x76, 0x96,
+    0xed, 0xb2, 0x81, 0x65, 0x88, 0x47, 0x2a, 0xe2, 0x91, 0x1d, 0xf1, 0xa8, 0x1e, 0xf1, 0x48, 0x43,
+    0x9c, 0xa8, 0x88, 0x13, 0x3b, 0xe2, 0xa4, 0x1e, 0x71, 0xa2, 0x22, 0xf6, 0x24, 0xdd, 0x51, 0x3d,
+    0xda, 0x51, 0x2e, 0x55, 0x35, 0xf7, 0x71, 0xa5, 0xc5, 0xec, 0xd9, 0x7a, 0xe8, 0xb4, 0x15, 0x8c,
+    0x1d, 0xc3, 0x35, 0xfa, 0xef, 0x76, 0x54, 0x0c, 0xf6, 0xa8, 0xb2, 0xec, 0xa0, 0x73, 0xac, 0xbf,
+    0x97, 0x03, 0x43, 0xce, 0xea, 0x1d, 0x3d, 0x82, 0x82, 0xa2, 0x84, 0xc6, 0x83, 0x65, 0xcf, 0x14,
+    0x1d, 0xc4, 0xa0, 0xb7, 0x54, 0xb0, 0x3e, 0xae, 0xda, 0x22, 0x93, 0x75, 0xad, 0x5e, 0xaf, 0x96,
+    0x8a, 0x9a, 0xf5, 0x19, 0x03, 0xee, 0xa3, 0x6b, 0xf4, 0x19, 0xba, 0x46, 0x91, 0x4b, 0x37, 0x52,
+    0xd5, 0x34, 0x9e, 0xdc, 0x4c, 0x53, 0xdb, 0x5c, 0x3b, 0xab, 0x70, 0x5a, 0xb4, 0x0d, 0x3f, 0x1d,
+    0x7d, 0xaf, 0x5f, 0xce, 0x91, 0x8d, 0x3a, 0x95, 0x97, 0xdd, 0x47, 0x19, 0x8e, 0x52, 0x71, 0x03,
+    0x4c, 0x06, 0x79, 0xf9, 0x4e, 0xdb, 0xc7, 0xd0, 0xf9, 0x69, 0xce, 0xe7, 0xc8, 0xa2, 0xdb, 0xaf,
+    0xb4, 0x09, 0x3e, 0x8b, 0x33, 0x33, 0xe0, 0xf2, 0xe1, 0xb8, 0x23, 0xd8, 0xd0, 0x6c, 0xfc, 0xfd,
+    0xef, 0x0d, 0xae, 0xd9, 0x46, 0xa0, 0xd8, 0x4a, 0x09, 0x9f, 0x09, 0x04, 0x55, 0xba, 0x4f, 0xbe,
+    0xa5, 0xeb, 0xf2, 0xc9, 0x37, 0xf4, 0x6d, 0x09, 0x79, 0x3c, 0xfd, 0xcf, 0x9e, 0xa6, 0x81, 0x1c,
+    0xe4, 0xfc, 0xca, 0x61, 0x4e, 0xaf, 0xb0, 0x5a, 0xb8, 0xea, 0x60, 0x31, 0x7e, 0xd6, 0xb4, 0x5e,
+    0x4e, 0x1f, 0xc3, 0x7a, 0x81, 0x0b, 0x90, 0x2f, 0xc5, 0x64, 0xe1, 0xdd, 0xda, 0x9e, 0x8d, 0x84,
+    0x15, 0x60, 0xd3, 0xfe, 0x11, 0x33, 0x86, 0xa9, 0x83, 0xa6, 0xf8, 0xec, 0xd7, 0xa9, 0x5b, 0xb1,
+    0x03, 0x58, 0x1e, 0xd6, 0x22, 0x0d, 0x9d, 0x66, 0x0e, 0x1c, 0x7a, 0x27, 0x61, 0x1b, 0x5d, 0x74,
+    0xbf, 0x4a, 0xe5, 0xa1, 0x34, 0xc3, 0x97, 0xbd, 0x75, 0x81, 0x03, 0xb5, 0x5a, 0xc3, 0xb2, 0x8e,
+    0xc2, 0x7a, 0xda, 0xd2, 0x71, 0xc3, 0xe3, 0xb8, 0xe1, 0xb1, 0xf5, 0x86, 0x07, 0x7b, 0xac, 0x68,
+    0xc1, 0x9e, 0x0f, 0xb2, 0xef, 0x79, 0x54, 0xb6, 0x46, 0x58, 0x09, 0x4f, 0x93, 0x57, 0xfb, 0xf5,
+    0x87, 0x0c, 0xb3, 0x1b, 0x58, 0x29, 0xf2, 0x49, 0xb8, 0x5e, 0x28, 0x07, 0xd6, 0xec, 0xc7, 0x88,
+    0x89, 0x23, 0xc7, 0x31, 0xa0, 0x11, 0x9e, 0xa6, 0xf3, 0x6c, 0x4c, 0x60, 0x59, 0x50, 0x55, 0x41,
+    0x19, 0xbb, 0x29, 0x8d, 0x7a, 0xb0, 0x23, 0x65, 0x10, 0xb5, 0x11, 0x14, 0xb6, 0x40, 0x49, 0xe2,
+    0x67, 0x5f, 0x15, 0x52, 0x83, 0x37, 0xdd, 0xb7, 0x18, 0xae, 0x0a, 0x91, 0x34, 0x59, 0x45, 0x35,
+    0x4f, 0x0e, 0x69, 0xcf, 0xaa, 0x61, 0x97, 0x6e, 0xb2, 0x30, 0xd9, 0xbb, 0x59, 0x5f, 0xf3, 0x3e,
+    0xe7, 0x44, 0x52, 0x54, 0xde, 0x1e, 0x89, 0x17, 0x98, 0x4e, 0xbf, 0x89, 0xbe, 0xf5, 0x61, 0x9c,
+    0xde, 0x81, 0x8a, 0x34, 0x71, 0x58, 0x78, 0x63, 0xc2, 0x91, 0x3e, 0x93, 0x81, 0x59, 0x3c, 0xe7,
+    0x31, 0x24, 0x30, 0xba, 0x6c, 0x95, 0x33, 0xe9, 0x74, 0xf2, 0x30, 0x22, 0x9a, 0x78, 0x9d, 0x09,
+    0x43, 0x1f, 0xce, 0x9a, 0xf8, 0x67, 0xc4, 0x5e, 0x76, 0xc2, 0x8f, 0x84, 0x7e, 0xd0, 0x7f, 0xdd,
+    0x80, 0x28, 0xa4, 0x44, 0x7b, 0xa8, 0x3c, 0x56, 0x52, 0x3f, 0x58, 0xa8, 0x8c, 0x4a, 0x44, 0x43,
+    0x9f, 0x34, 0x51, 0x99, 0x6d, 0xb1, 0x82, 0x44, 0xdb, 0x16, 0x3f, 0x97, 0xa8, 0x9d, 0x71, 0xcd,
+    0x2e, 0xb1, 0x96, 0xed, 0xd8, 0x8a, 0x0c, 0xac, 0x45, 0x56, 0xd6, 0x36, 0x5c, 0x87, 0xd2, 0x8e,
+    0x52, 0x24, 0x35, 0x14, 0x91, 0xf3, 0xaf, 0xd6, 0xa0, 0x46, 0xc5, 0x38, 0x5a, 0x87, 0x08, 0x33,
+    0xfd, 0xd7, 0x35, 0xbd, 0x65, 0x2e, 0x91, 0xad, 0x41, 0x9e, 0xb9, 0x64, 0xba, 0x88, 0x47, 0xa3,
+    0x14, 0x03, 0x4d, 0xc0, 0x8c, 0x06, 0x16, 0x6d, 0xfc, 0xa3, 0xd1, 0x43, 0x1b, 0xa9, 0xd3, 0x3e,
+    0x23, 0x06, 0x92, 0x48, 0x3c, 0x6b, 0x9f, 0x63, 0xe2, 0xe9, 0x39, 0x49, 0x25, 0x7f, 0x98, 0x25,
+    0x98, 0xce, 0xb2, 0x3b, 0x66, 0x00, 0x0e, 0x9a, 0x57, 0xe4, 0xbf, 0xcc, 0x6d, 0x39, 0x71, 0x73,
+    0x48, 0xfe, 0x1b, 0xb9, 0xbe, 0x33, 0x6a, 0x5e, 0x93, 0xff, 0x68, 0x5a, 0x42, 0xfe, 0x1b, 0xb8,
+    0x6e, 0xd0, 0x00, 0xd5, 0x97, 0xd4, 0xe1, 0x3b, 0x14, 0x79, 0x4b, 0x4c, 0x0f, 0x08, 0xac, 0x50,
+    0x12, 0xd4, 0xec, 0xbe, 0x6d, 0x13, 0x96, 0xed, 0xb5, 0x28, 0x98, 0x1e, 0x7b, 0x0a, 0xd5, 0x5d,
+    0x14, 0x3e, 0x48, 0x44, 0x7b, 0x01, 0x67, 0xdf, 0x21, 0xb8, 0x89, 0x4f, 0xbf, 0x97, 0xe2, 0x9b,
+    0x07, 0x1c, 0x2b, 0x2d, 0x86, 0x3d, 0x88, 0xe1, 0x27, 0x92, 0xb6, 0x54, 0x38, 0x9a, 0x64, 0x63,
+    0x7d, 0xc0, 0xb1, 0xd5, 0x12, 0x6e, 0x4c, 0x2a, 0x8c, 0x27, 0xd2, 0x95, 0x00, 0x9e, 0x8e, 0xda,
+    0x95, 0xee, 0x25, 0xbf, 0x8e, 0x87, 0xf9, 0xbd, 0x9e, 0x0a, 0x42, 0xd7, 0x08, 0x1e, 0x0f, 0x20,
+    0x04, 0x4a, 0x19, 0xc6, 0xf1, 0xe3, 0x45, 0xe3, 0xb4, 0xdd, 0x3d, 0xeb, 0x9e, 0xbf, 0xed, 0xbd,
+    0x3a, 0x3f, 0x3d, 0x7f, 0xf3, 0xf6, 0xf5, 0xdb, 0xd3, 0x13, 0x43, 0x44, 0x1d, 0xb0, 0x40, 0xad,
+    0xc1, 0xcc, 0x64, 0x8e, 0x74, 0xe8, 0x6b, 0x78, 0xc4, 0x32, 0x82, 0x80, 0x86, 0xae, 0x1c, 0xd1,
+    0x10, 0x57, 0x8c, 0xef, 0x69, 0x04, 0x9a, 0x01, 0x31, 0x76, 0xc1, 0x3e, 0x8b, 0x27, 0x73, 0xc7,
+    0x29, 0x9b, 0xfc, 0x47, 0xe7, 0x53, 0x4b, 0xfa, 0xea, 0x7e, 0x72, 0x3d, 0x34, 0xf6, 0x58, 0x58,
+    0x37, 0xb7, 0xa9, 0x66, 0x0a, 0xcc, 0xe3, 0x7c, 0x9a, 0x46, 0x44, 0xe2, 0x4e, 0x08, 0x74, 0xef,
+    0xdc, 0x63, 0x47, 0xa3, 0x91, 0x22, 0x37, 0x90, 0xea, 0x15, 0xe7, 0xa2, 0x31, 0xd6, 0x4b, 0xc4,
+    0xf8, 0x97, 0x9a, 0x99, 0x64, 0x92, 0x21, 0x06, 0xc6, 0xc4, 0x7e, 0x8b, 0xe5, 0xba, 0x64, 0xda,
+    0x7d, 0xbc, 0xc0, 0xfb, 0x1d, 0x3c, 0x4f, 0xb8, 0x33, 0xc0, 0x11, 0xf1, 0x8d, 0xdc, 0x46, 0x61,
+    0x2e, 0x46, 0x6c, 0xbc, 0x84, 0xcb, 0x2a, 0xfe, 0x9c, 0xdd, 0xdc, 0x62, 0xb0, 0x5f, 0x9a, 0xbe,
+    0x6c, 0x7e, 0xbc, 0x08, 0x25, 0xdd, 0xbb, 0xdb, 0x7e, 0xf3, 0xfa, 0xbc, 0x55, 0x06, 0xf6, 0xeb,
+    0xb6, 0x5f, 0x9f, 0xb3, 0x7c, 0x32, 0x49, 0xe9, 0x63, 0x9e, 0x10, 0x40, 0x48, 0x94, 0xa2, 0x91,
+    0x1d, 0x2f, 0xb1, 0xe9, 0xa2, 0x18, 0x36, 0x05, 0xe4, 0x05, 0x19, 0x07, 0x32, 0xd9, 0xd1, 0xb1,
+    0x8a, 0xbd, 0x43, 0x47, 0x22, 0x28, 0x53, 0x39, 0x52, 0x9a, 0xe1, 0x7a, 0xfc, 0x1b, 0xa2, 0xe4,
+    0x42, 0x01, 0x4e, 0x36, 0x32, 0x0c, 0x8e, 0x97, 0x54, 0x21, 0xdf, 0x37, 0xc5, 0x4c, 0xb6, 0xbf,
+    0x8a, 0x03, 0x45, 0x53, 0x20, 0x24, 0x18, 0xfd, 0xc5, 0x8c, 0xef, 0xb2, 0x59, 0xbd, 0xaa, 0xff,
+    0x01, 0x58, 0x98, 0x86, 0x50, 0x01, 0x85, 0xd3, 0xa1, 0x63, 0xd3, 0x64, 0xfd, 0xe5, 0x06, 0x1f,
+    0x2f, 0x50, 0x96, 0x94, 0xdc, 0x44, 0x83, 0x32, 0x43, 0x21, 0x56, 0x33, 0x7d, 0x36, 0x8b, 0xce,
+    0x04, 0x5f, 0x62, 0x7e, 0x1f, 0x81, 0x88, 0xaa, 0x42, 0x38, 0x59, 0x26, 0xbe, 0x9e, 0x28, 0x45,
+    0x0e, 0xc9, 0x2d, 0xa4, 0xac, 0x28, 0x55, 0xdc, 0x8e, 0xdd, 0xa6, 0xf4, 0xb9, 0x9b, 0x70, 0x13,
+    0x53, 0x12, 0x29, 0xc5, 0xb0, 0xc5, 0xe7, 0x6f, 0x5e, 0x9f, 0x76, 0xba, 0xaf, 0x4e, 0x2a, 0x9b,
+    0x4a, 0xa0, 0x92, 0x53, 0x1f, 0x49, 0x75, 0xc3, 0x09, 0xe3, 0xda, 0xd7, 0x2b, 0xac, 0xd5, 0x48,
+    0xb0, 0xf2, 0x83, 0x58, 0x4c, 0xda, 0xe8, 0x2f, 0xf8, 0xad, 0xfb, 0xae, 0x96, 0x26, 0xdf, 0x18,
+    0x99, 0x5a, 0x2a, 0x46, 0xbc, 0xe9, 0x55, 0xe2, 0x21, 0x8d, 0xe2, 0x9b, 0x9b, 0x98, 0x07, 0x38,
+    0x32, 0x84, 0xf7, 0x04, 0x7d, 0x7e, 0x92, 0xce, 0xf3, 0xab, 0x78, 0xf6, 0xc5, 0x05, 0x8b, 0x39,
+    0x3e, 0x60, 0xb5, 0xc5, 0x59, 0xd2, 0x51, 0x3c, 0xad, 0x79, 0x00, 0x8a, 0xe7, 0xd6, 0xc5, 0x42,
+    0xe6, 0x30, 0xab, 0xa2, 0x21, 0xcb, 0x70, 0x75, 0x5d, 0x86, 0xef, 0xad, 0x5a, 0x9a, 0x84, 0x79,
+    0xf6, 0x0e, 0xc3, 0xec, 0xfa, 0x4e, 0x11, 0x20, 0x35, 0x24, 0xd4, 0x74, 0xc8, 0xca, 0xde, 0x58,
+    0xab, 0x2b, 0xd4, 0x7e, 0x78, 0x7e, 0x81, 0x85, 0x5e, 0xfa, 0xd3, 0x4c, 0x82, 0xe9, 0xd5, 0x81,
+    0xe1, 0xc9, 0x06, 0x42, 0x78, 0x96, 0x2f, 0xcf, 0x09, 0x4b, 0xa0, 0xea, 0x12, 0xcd, 0x86, 0x3c,
+    0x2f, 0xb7, 0x88, 0xbe, 0x81, 0x6c, 0xe8, 0x11, 0xcc, 0xf0, 0xcb, 0xb9, 0x60, 0xec, 0x0f, 0x56,
+    0x7a, 0x13, 0x76, 0x57, 0xdb, 0x60, 0xeb, 0x07, 0xde, 0x09, 0xf5, 0x3d, 0xc0, 0x9b, 0xaf, 0xb6,
+    0x9d, 0xe6, 0xbd, 0xfb, 0xf9, 0xb7, 0x8b, 0x77, 0x3f, 0x5e, 0xbc, 0xbb, 0xbc, 0xf8, 0xf9, 0x07,
+    0xfb, 0x93, 0x34, 0xa0, 0xe4, 0xab, 0x41, 0x37, 0xa3, 0x98, 0x3f, 0xa4, 0xd0, 0xea, 0xf6, 0xde,
+    0x90, 0x6c, 0xa6, 0x3d, 0xf5, 0xc5, 0xb6, 0x40, 0x44, 0xc3, 0x7d, 0xd3, 0x67, 0x12, 0x30, 0x94,
+    0x23, 0x68, 0x33, 0xa1, 0xb4, 0xa4, 0x45, 0x22, 0xc2, 0x36, 0x05, 0x02, 0x7f, 0x81, 0xdb, 0x64,
+    0x5f, 0xf7, 0xde, 0xab, 0x33, 0x16, 0x25, 0xbc, 0xf4, 0x09, 0xca, 0x9a, 0x00, 0x78, 0x1b, 0x95,
+    0xd9, 0x2e, 0x36, 0x36, 0x25, 0x18, 0xf0, 0x38, 0xb2, 0xdf, 0x6c, 0x3b, 0x2d, 0x14, 0xfc, 0xc0,
+    0x7f, 0x60, 0xeb, 0x98, 0x45, 0x1c, 0x8f, 0xaf, 0x68, 0x66, 0x99, 0xc3, 0x46, 0x0f, 0x88, 0xf7,
+    0xd8, 0x00, 0x72, 0xd5, 0x17, 0xd2, 0x39, 0x96, 0xa6, 0xc3, 0x7f, 0x09, 0x65, 0x59, 0xee, 0x5b,
+    0x34, 0x65, 0x85, 0x06, 0x98, 0xdf, 0x16, 0x4a, 0x59, 0x51, 0xaf, 0x57, 0xc5, 0xd2, 0xc3, 0x87,
+    0x1c, 0x40, 0x7b, 0x6a, 0x3a, 0x25, 0x7d, 0x4c, 0x81, 0xa7, 0xaf, 0x3c, 0xc8, 0x15, 0xb9, 0x6a,
+    0xa7, 0xe0, 0xcd, 0x49, 0x5a, 0x9d, 0x57, 0x46, 0x94, 0xa4, 0x1a, 0x87, 0x26, 0x07, 0x51, 0xdb,
+    0x96, 0x06, 0x50, 0xcb, 0x2f, 0x68, 0x8c, 0x69, 0xa2, 0xb5, 0xde, 0x6a, 0x75, 0xd0, 0x5e, 0xe9,
+    0x45, 0xf4, 0xaf, 0x5e, 0x8d, 0xc7, 0x37, 0xb7, 0x88, 0xc6, 0x5d, 0x40, 0x78, 0xe7, 0xd6, 0xad,
+    0x7f, 0x0b, 0xef, 0x9e, 0x6b, 0x8f, 0x5d, 0x71, 0xc6, 0x52, 0x0d, 0x50, 0xa0, 0x3f, 0x60, 0x1a,
+    0x1b, 0xdf, 0xcb, 0xab, 0x3b, 0x5b, 0x59, 0xbe, 0x11, 0xde, 0x53, 0x8a, 0x61, 0xff, 0x55, 0x2a,
+    0x33, 0x46, 0x61, 0xc4, 0xd7, 0xa6, 0x48, 0x97, 0xc9, 0x21, 0x32, 0xf9, 0xe5, 0x53, 0x7a, 0x85,
+    0xd4, 0x5a, 0xca, 0x54, 0xa4, 0x52, 0x69, 0xe5, 0x3e, 0xbd, 0x57, 0x51, 0x3e, 0xc1, 0xda, 0x96,
+    0x74, 0xc3, 0x68, 0x35, 0x81, 0xc1, 0x0a, 0x6a, 0x42, 0xae, 0x83, 0x52, 0x17, 0x0a, 0xe5, 0x08,
+    0x1f, 0x59, 0x58, 0xb9, 0xb0, 0xb3, 0xa1, 0xb6, 0xab, 0xe9, 0xb5, 0x66, 0x1d, 0xd8, 0xa4, 0xed,
+    0x3e, 0xcd, 0x43, 0x54, 0x5f, 0xd0, 0x03, 0x51, 0x7b, 0x0e, 0x7f, 0x77, 0x98, 0x67, 0x87, 0x4c,
+    0xb7, 0xb7, 0x29, 0x73, 0xb8, 0x1e, 0x67, 0x9e, 0xf6, 0x3c, 0x2c, 0x49, 0xe8, 0x45, 0xf8, 0x68,
+    0x4e, 0xd3, 0xb6, 0x12, 0x41, 0x31, 0x99, 0x8d, 0xe4, 0x5b, 0xdf, 0xd4, 0xc8, 0xbd, 0x21, 0x3d,
+    0x06, 0x15, 0xb6, 0x1c, 0x51, 0x41, 0xd1, 0x42, 0xd4, 0xae, 0x5f, 0x56, 0x89, 0x71, 0x47, 0xdd,
+    0x00, 0xd3, 0x2d, 0x96, 0xf0, 0x1e, 0xe2, 0x4c, 0x09, 0x93, 0xf7, 0xa7, 0x77, 0xff, 0xea, 0xff,
+    0x78, 0xf1, 0xf3, 0x87, 0xfe, 0xfb, 0x8b, 0xcb, 0xdf, 0xde, 0xfd, 0xfc, 0xdd, 0x87, 0xc6, 0x69,
+    0xef, 0xf5, 0xab, 0xd7, 0xed, 0xce, 0xb3, 0x31, 0x8a, 0xd7, 0x7d, 0x4d, 0xda, 0x62, 0x3c, 0xef,
+    0xdf, 0x28, 0x26, 0x62, 0x75, 0x34, 0x4b, 0xe7, 0xd6, 0xa8, 0x1f, 0x47, 0xf3, 0xf3, 0x68, 0x7e,
+    0xbe, 0x54, 0xf3, 0xf3, 0x68, 0x10, 0x1e, 0x0d, 0xc2, 0x17, 0x66, 0x10, 0x72, 0x71, 0xbe, 0xae,
+    0x4d, 0x18, 0x54, 0x96, 0xd0, 0xa3, 0x95, 0x78, 0xb4, 0x12, 0x8f, 0x56, 0xe2, 0xf3, 0xb0, 0x12,
+    0xd7, 0xde, 0x0d, 0xde, 0xda, 0x7e, 0xdc, 0x51, 0x31, 0x7c, 0x31, 0x36, 0xe0, 0xd1, 0x8e, 0x33,
+    0xd8, 0x71, 0x96, 0x97, 0xc6, 0xd8, 0x16, 0x3e, 0x70, 0xb6, 0xca, 0x2a, 0xf6, 0x17, 0xc7, 0xf6,
+    0x63, 0xfe, 0x55, 0x8d, 0x3b, 0x9e, 0xa3, 0xac, 0x68, 0xfd, 0xcb, 0xef, 0xde, 0xfd, 0xf8, 0x01,
+    0x44, 0xfb, 0xa3, 0x1b, 0x7f, 0x2b, 0xf6, 0x3c, 0x77, 0xb3, 0x0d, 0x77, 0x31, 0xfe, 0xca, 0xfd,
+    0xce, 0x2d, 0xbc, 0x47, 0x47, 0x9b, 0x6f, 0x0b, 0x9b, 0xef, 0x19, 0x98, 0x58, 0xcf, 0xce, 0xec,
+    0x3c, 0xb0, 0xcd, 0x77, 0xbc, 0xb6, 0xf9, 0x8c, 0xae, 0x6d, 0xbe, 0x70, 0xdb, 0xfa, 0x69, 0x6d,
+    0xd9, 0xe7, 0x66, 0xd9, 0x1f, 0xca, 0xb6, 0xfe, 0x2b, 0x5c, 0xa4, 0x7d, 0x22, 0xff, 0x01, 0x87,
+    0xdb, 0x6c, 0x5b, 0xd9, 0xa0, 0x68, 0x1d, 0x1d, 0x08, 0x47, 0x07, 0xc2, 0xd1, 0x81, 0xb0, 0xb3,
+    0x03, 0xa1, 0x9c, 0x87, 0xb1, 0xac, 0xcd, 0x3f, 0xae, 0x63, 0x61, 0x93, 0xdb, 0xa0, 0x8a, 0x10,
+    0xd3, 0xc3, 0xac, 0xac, 0xf4, 0x50, 0x1c, 0xce, 0x7a, 0x79, 0x29, 0x97, 0x31, 0xff, 0x0a, 0x6e,
+    0x97, 0x67, 0x74, 0xab, 0xf3, 0x09, 0xdd, 0x42, 0xc7, 0xb0, 0xc5, 0x2f, 0xeb, 0x31, 0x13, 0xb9,
+    0xab, 0xe5, 0xf6, 0xa9, 0x6d, 0x6e, 0x2f, 0x3c, 0xd1, 0x6b, 0x81, 0x1a, 0x00, 0x58, 0x03, 0x5c,
+    0x9a, 0x70, 0x26, 0x06, 0x9c, 0x84, 0x6a, 0x8f, 0xf5, 0x77, 0x1d, 0x46, 0xa0, 0x38, 0xfc, 0xc2,
+    0x7c, 0x91, 0x14, 0xdb, 0x82, 0x74, 0x25, 0xbd, 0x5d, 0x2c, 0x96, 0x88, 0x40, 0xed, 0xe9, 0xf6,
+    0x42, 0x85, 0x4f, 0xea, 0xe1, 0x13, 0x15, 0x7e, 0xd9, 0xc7, 0x87, 0x90, 0x9b, 0xa2, 0x2f, 0x88,
+    0x1e, 0xc4, 0xee, 0xad, 0x09, 0xfa, 0x90, 0x26, 0x47, 0xab, 0x75, 0xd9, 0xec, 0xb1, 0xc7, 0x5c,
+    0x5c, 0x9d, 0xa0, 0x65, 0x89, 0x3c, 0xd9, 0x06, 0x79, 0x62, 0x47, 0x9e, 0x94, 0xac, 0x81, 0xe1,
+    0x47, 0x36, 0xbf, 0xeb, 0x8d, 0x3c, 0x44, 0x7a, 0xd5, 0x27, 0x2d, 0x77, 0x25, 0x5c, 0xc9, 0x16,
+    0x37, 0xb5, 0x19, 0xae, 0x84, 0xe0, 0x4a, 0x5c, 0xc5, 0x7b, 0x0c, 0xb8, 0x8c, 0xb7, 0xb5, 0x49,
+    0xa5, 0xbe, 0x39, 0x23, 0x71, 0xcd, 0xb7, 0xb4, 0xa9, 0x3f, 0xf9, 0x11, 0x5f, 0x95, 0x78, 0x46,
+    0xde, 0xe4, 0x47, 0x3d, 0x4a, 0xc4, 0x06, 0x89, 0xbe, 0x42, 0x1d, 0x57, 0x54, 0x3b, 0xd2, 0xeb,
+    0xfd, 0xa5, 0x94, 0x6e, 0x2a, 0x95, 0x58, 0x4a, 0x25, 0xfb, 0x38, 0xb6, 0xc4, 0x52, 0xa1, 0x86,
+    0xd8, 0x94, 0x98, 0x6c, 0x7f, 0x0e, 0xf2, 0x78, 0xab, 0xe7, 0x78, 0xac, 0xea, 0x78, 0xac, 0xca,
+    0xe6, 0x62, 0xe7, 0x43, 0x66, 0xf0, 0xbf, 0x3d, 0x86, 0xfb, 0x1d, 0x9d, 0x48, 0x35, 0x54, 0x96,
+    0xf9, 0xd6, 0xbe, 0x2a, 0x41, 0x4c, 0xfc, 0x25, 0xe5, 0xd6, 0xf5, 0xa6, 0x0a, 0x76, 0xbc, 0xa2,
+    0x74, 0x3c, 0x91, 0xf6, 0x4c, 0x4e, 0xa4, 0x1d, 0xce, 0x4f, 0x2e, 0x4d, 0xc5, 0xf2, 0xa7, 0xa1,
+    0xe6, 0x32, 0xd3, 0x57, 0xe7, 0xa7, 0xa9, 0xc9, 0x32, 0x26, 0xd3, 0x24, 0x3b, 0xba, 0xb3, 0x8f,
+    0xee, 0xec, 0xa3, 0x3b, 0xfb, 0x2f, 0xef, 0xce, 0x46, 0xbd, 0x3e, 0x62, 0x02, 0x46, 0x4c, 0x4a,
+    0x4f, 0xb7, 0x53, 0xda, 0x8b, 0x40, 0x92, 0x3e, 0x62, 0xf0, 0x2a, 0x60, 0xcb, 0xa6, 0x30, 0x61,
+    0x5c, 0x86, 0x3d, 0x59, 0x89, 0x3d, 0x59, 0x0f, 0x7b, 0x22, 0x61, 0x87, 0x90, 0x63, 0xfb, 0x3e,
+    0xcb, 0xa7, 0x1b, 0x59, 0xf3, 0xe1, 0x15, 0x76, 0x7f, 0x35, 0x26, 0x15, 0xb1, 0x15, 0x9f, 0x99,
+    0x69, 0x75, 0xbc, 0x62, 0x56, 0xbf, 0xb8, 0x1f, 0x4e, 0xb9, 0xde, 0xaf, 0x66, 0xfc, 0x25, 0xde,
+    0x9a, 0x33, 0x62, 0xa8, 0x39, 0xa9, 0x50, 0xed, 0xf1, 0xda, 0x0e, 0xdf, 0x58, 0x07, 0xfa, 0xc2,
+    0x7c, 0xad, 0x44, 0x0c, 0x41, 0x6e, 0x3f, 0x36, 0xc6, 0x6f, 0x42, 0x61, 0xe2, 0xb6, 0x63, 0x0d,
+    0x38, 0xb1, 0x02, 0x27, 0x15, 0x60, 0x74, 0x0b, 0x8a, 0x5a, 0x7c, 0x81, 0xc2, 0x47, 0x49, 0xe7,
+    0x86, 0xd4, 0xc9, 0x17, 0x29, 0x2f, 0xd0, 0x9e, 0xb7, 0x4a, 0xf9, 0x28, 0xcb, 0x72, 0x1a, 0x25,
+    0xd8, 0x94, 0xc3, 0xd0, 0xee, 0xff, 0x58, 0xea, 0x5a, 0x27, 0x45, 0x8b, 0x31, 0x59, 0x6b, 0x66,
+    0xf2, 0xf3, 0x13, 0x42, 0xea, 0xe3, 0xda, 0x63, 0xc9, 0x4c, 0x6e, 0xaf, 0xae, 0xd2, 0x59, 0xdd,
+    0xd3, 0xb4, 0x1b, 0x06, 0x2e, 0xeb, 0x18, 0xd2, 0xba, 0xdb, 0x46, 0x33, 0xeb, 0x44, 0x8e, 0x63,
+    0x8e, 0xf6, 0xd8, 0x82, 0x13, 0xc1, 0x81, 0x4a, 0x7f, 0xc3, 0x85, 0xb8, 0x4c, 0xb4, 0x64, 0x37,
+    0xa2, 0xc1, 0xef, 0xe0, 0x09, 0x74, 0xb9, 0x03, 0x20, 0x60, 0x57, 0xd9, 0x55, 0x52, 0xe7, 0xca,
+    0x3b, 0xd3, 0xfd, 0x6a, 0x3f, 0xe9, 0xcf, 0x77, 0x54, 0x16, 0xdb, 0x8e, 0x3d, 0xab, 0xbb, 0x76,
+    0x37, 0x55, 0x46, 0x67, 0x06, 0x51, 0xa3, 0x88, 0xd2, 0x31, 0x87, 0x30, 0xdb, 0x75, 0xd9, 0x20,
+    0x2e, 0xab, 0x23, 0x1f, 0x93, 0x6e, 0xc3, 0x00, 0x7a, 0xfa, 0x8b, 0x26, 0xa5, 0xaf, 0x72, 0x52,
+    0xcc, 0xe2, 0xb9, 0xe9, 0xc5, 0x13, 0x78, 0x7e, 0x64, 0x3e, 0xcd, 0x26, 0xfd, 0x7b, 0x0c, 0xa2,
+    0xab, 0x45, 0xa4, 0x2b, 0x05, 0x73, 0xa7, 0x3a, 0x31, 0x3b, 0x34, 0x0c, 0x5b, 0x67, 0x45, 0x94,
+    0xd7, 0x2e, 0x05, 0xeb, 0xd2, 0x10, 0xdb, 0x14, 0x59, 0x3b, 0xa6, 0x16, 0x02, 0xa9, 0x82, 0x25,
+    0xcc, 0x46, 0x49, 0x54, 0xfe, 0x0c, 0x38, 0x58, 0xf8, 0x20, 0x0a, 0x75, 0xf5, 0x42, 0xdd, 0xb2,
+    0x50, 0xb7, 0x2c, 0xd4, 0x85, 0x42, 0xda, 0xde, 0x01, 0xc5, 0xe6, 0xb3, 0x20, 0xae, 0x7c, 0xf4,
+    0xd9, 0xcb, 0x4a, 0xed, 0x58, 0x0e, 0x75, 0x8d, 0x5d, 0x22, 0xf0, 0x02, 0xda, 0x10, 0xbe, 0x30,
+    0x44, 0x36, 0x84, 0x27, 0x27, 0x1f, 0xbe, 0xda, 0x63, 0x10, 0xb6, 0xdf, 0xf5, 0x2d, 0x79, 0x9f,
+    0x17, 0x4b, 0x6b, 0xde, 0xf2, 0xf3, 0x42, 0x44, 0x92, 0x8b, 0xef, 0x52, 0x22, 0x1d, 0xd2, 0x88,
+    0x3f, 0x43, 0xc4, 0xdf, 0x96, 0xe2, 0x8f, 0x4a, 0xb9, 0xc1, 0x29, 0x04, 0xfe, 0x84, 0xb0, 0xdf,
+    0x0e, 0x83, 0x6d, 0x91, 0x2f, 0x08, 0x78, 0x56, 0x1d, 0x7e, 0x20, 0x18, 0x2a, 0xc4, 0xd9, 0xe3,
+    0x55, 0x86, 0x9f, 0x4e, 0x1f, 0x3a, 0xf4, 0xc0, 0x50, 0x60, 0xb6, 0xd3, 0x06, 0xea, 0xac, 0xe8,
+    0xaf, 0x4c, 0x70, 0x39, 0x22, 0xf2, 0xdb, 0x82, 0x07, 0xaa, 0xf0, 0xd7, 0x48, 0xd1, 0x24, 0x2c,
+    0x4a, 0x0a, 0x1a, 0x61, 0x8d, 0x13, 0xe9, 0x8b, 0x6a, 0x7c, 0x6c, 0x3b, 0x1b, 0x3e, 0x9f, 0x07,
+    0x45, 0xdb, 0x4d, 0xfe, 0x92, 0x5e, 0x9a, 0x17, 0x6c, 0xca, 0x7c, 0xbc, 0x88, 0x2a, 0xe1, 0x09,
+    0x43, 0xe3, 0x76, 0x0d, 0x33, 0xaa, 0xcd, 0xdb, 0x35, 0x4a, 0xea, 0x29, 0x94, 0x10, 0xe6, 0x94,
+    0x2a, 0x73, 0xb9, 0xb7, 0x01, 0x19, 0x53, 0x17, 0x42, 0x49, 0x9e, 0x8f, 0x41, 0xc8, 0xcc, 0xe9,
+    0xa6, 0x1d, 0x84, 0xc6, 0xec, 0x23, 0xb1, 0xb1, 0x24, 0xe9, 0x35, 0xa0, 0xab, 0x34, 0x46, 0x59,
+    0x5a, 0x81, 0x53, 0x9f, 0xe1, 0x43, 0xd8, 0xba, 0x4c, 0x4b, 0xd6, 0x20, 0xbe, 0x21, 0x3c, 0x08,
+    0x26, 0x1f, 0x84, 0xa9, 0x23, 0x92, 0x99, 0x3f, 0x6e, 0x60, 0x81, 0x9f, 0x66, 0xc5, 0xe0, 0x5a,
+    0xa7, 0x75, 0x96, 0x17, 0x71, 0x91, 0xf6, 0xe7, 0xcb, 0x9b, 0x24, 0x1f, 0x5b, 0x0a, 0xd2, 0xa0,
+    0x7c, 0x9a, 0x09, 0xa4, 0x08, 0xf1, 0xc1, 0xb5, 0x12, 0xb3, 0xd2, 0xb2, 0x33, 0x46, 0x53, 0xc7,
+    0x71, 0x42, 0x34, 0xa0, 0xe9, 0x38, 0x9e, 0xa4, 0x16, 0x08, 0x1a, 0x28, 0x5a, 0xcb, 0x2b, 0xfb,
+    0x16, 0x84, 0x9b, 0x9e, 0x8c, 0x6d, 0xa3, 0x26, 0xeb, 0x4d, 0x3c, 0xb5, 0x1d, 0x8d, 0xaa, 0x9a,
+    0x4d, 0x15, 0xa3, 0x49, 0x19, 0xfc, 0x2f, 0x60, 0x93, 0xe5, 0x99, 0x3c, 0x4c, 0x5e, 0x2a, 0x31,
+    0x91, 0x3c, 0x25, 0xc5, 0xa1, 0x15, 0xee, 0x7a, 0x55, 0x73, 0xf9, 0x91, 0x17, 0x54, 0x3b, 0x4a,
+    0x2f, 0x21, 0x4f, 0x84, 0x31, 0xe3, 0xa9, 0x04, 0x54, 0x66, 0xca, 0x79, 0x3a, 0xba, 0x81, 0xd8,
+    0x8c, 0x84, 0xed, 0xc6, 0x69, 0xd4, 0xd2, 0x26, 0xf5, 0x1f, 0xbd, 0x4f, 0x5c, 0x4b, 0x85, 0x61,
+    0x87, 0xd5, 0xeb, 0x2b, 0xcb, 0xdc, 0x85, 0x97, 0x43, 0xbe, 0xb2, 0x4f, 0x59, 0xd2, 0xa9, 0x48,
+    0x05, 0xc8, 0x40, 0x4a, 0xd0, 0x1f, 0x9d, 0x4f, 0x3e, 0xfb, 0xd5, 0xfd, 0xe4, 0xf3, 0xd9, 0xeb,
+    0x06, 0x18, 0xe6, 0x39, 0x7c, 0x68, 0x40, 0x9f, 0x35, 0xa0, 0xc6, 0xdd, 0x2a, 0x14, 0x95, 0x55,
+    0x11, 0xd7, 0x35, 0x65, 0x35, 0x62, 0x26, 0x52, 0x18, 0x3e, 0x35, 0x4d, 0xf5, 0xa7, 0x7d, 0xcc,
+    0xb3, 0x49, 0xb1, 0x2a, 0xe2, 0x38, 0x0b, 0x1c, 0x2d, 0x44, 0x11, 0x91, 0x3f, 0xd7, 0x79, 0x29,
+    0x8a, 0x22, 0x15, 0x5b, 0x5b, 0x1d, 0x45, 0x0e, 0x45, 0x45, 0x4b, 0xa4, 0x4f, 0xe3, 0xc6, 0xb7,
+    0x27, 0x56, 0xc4, 0x41, 0x8d, 0xfc, 0x6b, 0x7c, 0x73, 0x52, 0x93, 0x1b, 0x58, 0x71, 0x2a, 0xb4,
+    0x49, 0x9e, 0x2f, 0x46, 0x1e, 0xb5, 0xc9, 0xc0, 0x48, 0x01, 0x37, 0xa7, 0x4a, 0x3b, 0xda, 0x5d,
+    0xe0, 0x7d, 0x0e, 0xa1, 0x27, 0xbd, 0xa8, 0x52, 0x9a, 0x1f, 0xb1, 0x22, 0x5a, 0x00, 0x3f, 0x4a,
+    0xc5, 0x44, 0x59, 0xe3, 0x5b, 0xe4, 0xd2, 0xa0, 0x77, 0x86, 0x9e, 0x58, 0x1c, 0x09, 0x85, 0xd5,
+    0x51, 0x34, 0x53, 0x41, 0x0d, 0x6a, 0x3c, 0xa9, 0x29, 0xa4, 0xfc, 0xa5, 0xc8, 0x6e, 0xae, 0x28,
+    0xd2, 0xa9, 0xf5, 0x71, 0xe5, 0x20, 0xd2, 0x50, 0xd5, 0x5d, 0x8c, 0xa0, 0x2d, 0x5e, 0xda, 0x89,
+    0xf5, 0xf1, 0x5a, 0x2c, 0x83, 0xca, 0x08, 0x22, 0x64, 0x12, 0x99, 0x2a, 0x02, 0x78, 0x63, 0xfa,
+    0x7d, 0xa8, 0x37, 0x03, 0xc3, 0xed, 0x3a, 0x70, 0x0c, 0x0b, 0xcf, 0x7a, 0xa9, 0xab, 0x8c, 0x0f,
+    0x27, 0xb9, 0xe0, 0xb8, 0x58, 0xf8, 0x20, 0x77, 0x05, 0xce, 0x76, 0xc2, 0xab, 0x93, 0x08, 0xa3,
+    0xba, 0xca, 0x32, 0xa0, 0xa9, 0xe1, 0x57, 0xf9, 0x93, 0x16, 0x1c, 0x10, 0xe9, 0x84, 0xb1, 0x6c,
+    0xeb, 0x0b, 0x82, 0x93, 0xb9, 0xc1, 0x3f, 0x59, 0xc7, 0x45, 0xe8, 0x79, 0x16, 0x68, 0x7c, 0xf4,
+    0xe5, 0x0b, 0x72, 0x7c, 0xfd, 0xd7, 0x80, 0x05, 0x46, 0x96, 0xbd, 0xd3, 0x20, 0x1b, 0x4d, 0xab,
+    0x9f, 0x18, 0x13, 0x19, 0x92, 0x74, 0xa4, 0x12, 0x8a, 0x47, 0x32, 0xe2, 0xe4, 0xd5, 0x91, 0x79,
+    0xac, 0xb5, 0x92, 0x81, 0x9a, 0x70, 0xdf, 0xd4, 0x1a, 0xe3, 0x89, 0x9d, 0xb0, 0xe0, 0x14, 0x22,
+    0x1b, 0x0b, 0xa6, 0x94, 0x62, 0x75, 0xdf, 0x31, 0x91, 0x4c, 0xfe, 0x0d, 0xa4, 0x05, 0x14, 0x86,
+    0x5e, 0x5e, 0x22, 0xf9, 0x5a, 0xc2, 0x3e, 0x1d, 0x55, 0x7b, 0x12, 0x91, 0xdc, 0x4b, 0x1d, 0x21,
+    0x92, 0xf3, 0x89, 0x04, 0x45, 0x6b, 0x02, 0x62, 0x16, 0x2b, 0x9a, 0x44, 0xe3, 0x9b, 0x96, 0xaa,
+    0x59, 0xa8, 0x0b, 0xb3, 0x78, 0x85, 0x0a, 0x1c, 0x24, 0x10, 0x67, 0x5c, 0x41, 0xda, 0xf9, 0xd4,
+    0x94, 0x8a, 0xba, 0xae, 0x2d, 0x24, 0x37, 0x33, 0x92, 0x1e, 0x5b, 0x2b, 0x38, 0xdc, 0xc1, 0xdb,
+    0x8d, 0x1c, 0x69, 0x12, 0x10, 0x75, 0x31, 0x31, 0x00, 0x4f, 0x6b, 0x9d, 0xa2, 0xa3, 0xcb, 0x76,
+    0x24, 0xfb, 0x4d, 0x3d, 0x41, 0x2e, 0x3d, 0xbd, 0x75, 0x54, 0xf6, 0xf7, 0xa7, 0xec, 0x3f, 0x1b,
+    0x25, 0x7a, 0x9f, 0x56, 0xc4, 0xa6, 0x16, 0x4d, 0x9d, 0xd5, 0x51, 0xaf, 0xec, 0x03, 0x7b, 0x28,
+    0x9e, 0xa0, 0x53, 0x96, 0xd8, 0xb5, 0x4d, 0xe8, 0xab, 0x6c, 0x3c, 0xae, 0x3b, 0x7c, 0x56, 0xe6,
+    0xdb, 0x4f, 0xa0, 0x95, 0x30, 0xa6, 0x63, 0x68, 0x52, 0x6e, 0xdd, 0x56, 0x8b, 0x0a, 0x56, 0xf7,
+    0x48, 0x56, 0x3c, 0xce, 0xeb, 0x28, 0x2e, 0xf3, 0xed, 0x14, 0x97, 0x30, 0x26, 0x8a, 0xa5, 0xdc,
+    0x3a, 0x8a, 0x55, 0xb0, 0x2f, 0xfa, 0xbc, 0x1a, 0x36, 0xa5, 0xe6, 0xe8, 0x53, 0x99, 0x6f, 0x7f,
+    0xd5, 0x56, 0x80, 0x18, 0x5f, 0xb6, 0x2d, 0x73, 0x6b, 0xdf, 0x30, 0x53, 0xc0, 0x56, 0x11, 0x6c,
+    0x3f, 0x9a, 0x28, 0xb2, 0xeb, 0xc9, 0xb5, 0x1d, 0x52, 0x2c, 0x33, 0x57, 0x12, 0xab, 0xec, 0x04,
+    0xad, 0x63, 0xa7, 0x4a, 0x13, 0xae, 0xfc, 0x69, 0x3a, 0xb0, 0x55, 0xe6, 0xfa, 0xea, 0x34, 0x34,
+    0x1d, 0xdd, 0x92, 0x51, 0x6d, 0x35, 0x95, 0xca, 0x9f, 0x26, 0x5a, 0xca, 0x5c, 0x5f, 0x9d, 0x60,
+    0x26, 0x5a, 0x64, 0x54, 0x9b, 0x4f, 0x92, 0x83, 0x9f, 0xf4, 0x92, 0x78, 0xbf, 0xfc, 0x69, 0x7a,
+    0x57, 0x57, 0x64, 0xfa, 0xea, 0x84, 0x30, 0xbe, 0xaf, 0x2b, 0x61, 0xda, 0x86, 0xab, 0xc5, 0x2f,
+    0x1b, 0x21, 0xec, 0x8c, 0x9d, 0xc4, 0xe8, 0x56, 0x32, 0xd8, 0x9e, 0xa5, 0x81, 0x5d, 0x8f, 0xfe,
+    0x8c, 0xa3, 0x3f, 0xe3, 0xe8, 0xcf, 0x38, 0xfa, 0x33, 0x8e, 0xfe, 0x8c, 0x97, 0xe1, 0xcf, 0xe0,
+    0x87, 0x8b, 0xcb, 0x13, 0x71, 0xca, 0x01, 0x3a, 0xca, 0x04, 0xcf, 0xca, 0xe5, 0x51, 0xbe, 0x29,
+    0x35, 0x9b, 0xe6, 0xe3, 0x18, 0x5a, 0xbf, 0x83, 0x0f, 0x84, 0x19, 0x40, 0xf4, 0xfc, 0x1b, 0x69,
+    0x5b, 0x7b, 0x01, 0x77, 0xb6, 0xf0, 0xea, 0x19, 0xb5, 0x82, 0xe8, 0xa6, 0xa1, 0xd4, 0x41, 0x3e,
+    0x7d, 0xb9, 0xd3, 0x56, 0x3f, 0xba, 0x55, 0xf8, 0xe5, 0xaa, 0xcb, 0xf7, 0xdf, 0xf7, 0x3f, 0xfe,
+    0xab, 0xf1, 0xa6, 0xdd, 0x39, 0xa9, 0x9a, 0x9a, 0xb0, 0xba, 0x86, 0x75, 0x0e, 0x18, 0xb3, 0x31,
+    0x28, 0x1f, 0x8d, 0xd9, 0xf4, 0x7c, 0x9e, 0x66, 0xe7, 0x3e, 0xa6, 0x29, 0x78, 0x58, 0x33, 0xee,
+    0x80, 0x26, 0xd8, 0xa1, 0xac, 0xa8, 0x83, 0x9a, 0x40, 0xfb, 0xb4, 0x60, 0x6a, 0xd9, 0x64, 0x33,
+    0x03, 0xa4, 0xde, 0xfe, 0xd8, 0xc8, 0x7e, 0xd8, 0xc7, 0x79, 0x3b, 0x69, 0xf4, 0x36, 0x53, 0xe4,
+    0xeb, 0x86, 0x66, 0x6d, 0x5d, 0x9c, 0xc2, 0x7c, 0x78, 0xff, 0xc3, 0x87, 0xfe, 0x0f, 0xef, 0x7e,
+    0xfa, 0xe9, 0x1d, 0xd1, 0x18, 0xba, 0x9d, 0xf3, 0xc0, 0x1c, 0x6e, 0x8f, 0x8b, 0x71, 0x36, 0xcb,
+    0x41, 0xfb, 0xae, 0x8a, 0x7e, 0x36, 0xdb, 0xc5, 0xb5, 0x78, 0x54, 0x1a, 0x79, 0xe2, 0x52, 0x96,
+    0xe0, 0xbc, 0xa3, 0x58, 0x66, 0xa9, 0x88, 0xaf, 0xa9, 0xf8, 0x94, 0xe1, 0x21, 0xe8, 0xa8, 0x49,
+    0xc3, 0x2f, 0x4b, 0x3b, 0x24, 0x2e, 0x2a, 0x9b, 0x18, 0x38, 0x02, 0xbf, 0xa7, 0x48, 0x42, 0x37,
+    0x94, 0x4f, 0x5c, 0xde, 0x5e, 0x5d, 0x45, 0x0e, 0xea, 0xd3, 0x2d, 0xbc, 0xfa, 0xc0, 0x74, 0x6b,
+    0xa1, 0xad, 0x43, 0x5f, 0xf2, 0x83, 0x3a, 0x91, 0xc4, 0x2e, 0xb4, 0x3a, 0x47, 0x74, 0xb5, 0xd7,
+    0x6d, 0x77, 0xdf, 0x06, 0x54, 0x88, 0x37, 0x4b, 0x2a, 0xdc, 0x1a, 0x32, 0x68, 0xdd, 0x50, 0x73,
+    0x39, 0xf2, 0x41, 0xb9, 0xf0, 0x32, 0x64, 0xe1, 0x83, 0x44, 0x2e, 0x1e, 0x17, 0x34, 0x79, 0x94,
+    0xc1, 0x9f, 0xdc, 0x8e, 0xab, 0x1d, 0x42, 0xeb, 0x1a, 0x46, 0xf8, 0xe1, 0xc9, 0xeb, 0x81, 0xa2,
+    0x0b, 0xa1, 0x37, 0x5b, 0x3a, 0x60, 0x08, 0xa4, 0xb5, 0x64, 0x04, 0x3e, 0xa4, 0x34, 0x95, 0x94,
+    0x35, 0x4f, 0x13, 0x7a, 0xea, 0x8a, 0xb7, 0xc7, 0xa3, 0x85, 0x6c, 0xc5, 0xa2, 0xe7, 0xe7, 0x2a,
+    0x2e, 0xd8, 0xb5, 0x4e, 0x39, 0xf0, 0xf3, 0xfb, 0xdb, 0x2d, 0x99, 0xeb, 0x7a, 0x62, 0xd7, 0x3b,
+    0xb8, 0x48, 0x4b, 0x99, 0xd6, 0xd8, 0x2f, 0xee, 0x96, 0x2f, 0xbc, 0x54, 0x7a, 0x3b, 0x37, 0x53,
+    0x46, 0xf3, 0xea, 0xae, 0x67, 0x52, 0x08, 0xcb, 0xfd, 0x4c, 0x96, 0xb9, 0xe2, 0x0c, 0x79, 0x09,
+    0x75, 0xbc, 0x8b, 0xfc, 0xb8, 0x5a, 0xc9, 0xbc, 0x98, 0xe5, 0x7f, 0xa6, 0x75, 0xac, 0x27, 0x43,
+    0xd8, 0x39, 0x50, 0x86, 0x32, 0x31, 0xa2, 0x92, 0x5f, 0xc7, 0x8f, 0x3a, 0xe0, 0x6a, 0xda, 0x6b,
+    0x3c, 0xd3, 0x32, 0x44, 0x1d, 0x8b, 0xca, 0x70, 0x16, 0x46, 0x55, 0x40, 0x56, 0xb0, 0xab, 0x0e,
+    0xbb, 0xba, 0x0d, 0xb5, 0x8c, 0xa2, 0xc2, 0x58, 0xf9, 0x45, 0x05, 0x33, 0xb1, 0x8d, 0x06, 0x51,
+    0xc7, 0x3d, 0x55, 0x50, 0x4d, 0x03, 0x84, 0x5f, 0xcf, 0xe5, 0xba, 0x31, 0x93, 0x4f, 0xf4, 0x8f,
+    0xc1, 0x27, 0x4a, 0x33, 0xfc, 0x52, 0x58, 0x59, 0x2e, 0xa1, 0x72, 0x04, 0x1b, 0xc8, 0x9b, 0x17,
+    0x7c, 0xc9, 0x59, 0x11, 0x0d, 0xf2, 0x87, 0x69, 0x44, 0xe5, 0x7c, 0x5f, 0x17, 0x1a, 0xa6, 0xf1,
+    0x55, 0x11, 0x6e, 0x3d, 0xed, 0xe5, 0x0f, 0x43, 0xd7, 0xc8, 0xd9, 0xbe, 0x2e, 0x0f, 0x2c, 0x5c,
+    0xa0, 0xa2, 0xdc, 0x61, 0x32, 0xab, 0x9f, 0x76, 0xea, 0xca, 0xf1, 0xd3, 0x67, 0xba, 0x69, 0x18,
+    0x75, 0xac, 0xd6, 0xa9, 0x0a, 0x52, 0xa1, 0xbc, 0x7e, 0x8c, 0xf7, 0x27, 0x20, 0x69, 0x90, 0xcd,
+    0x06, 0xe0, 0xcf, 0x42, 0xf5, 0x24, 0x12, 0x7a, 0x0a, 0xd5, 0x98, 0x55, 0xf5, 0x8a, 0x3a, 0x20,
+    0x49, 0x91, 0x7c, 0x36, 0x21, 0x0a, 0xd0, 0x94, 0x7b, 0xac, 0x14, 0x14, 0xac, 0xa4, 0xaa, 0xb6,
+    0xa1, 0xca, 0xad, 0x14, 0x6a, 0xf2, 0xfb, 0x97, 0x9e, 0x43, 0x67, 0x57, 0x53, 0xee, 0x58, 0x38,
+    0x1e, 0xae, 0x2a, 0x6f, 0xdc, 0x9b, 0xad, 0xb9, 0xdc, 0x18, 0xd9, 0xaa, 0xf7, 0x53, 0xa1, 0x87,
+    0xfa, 0x3e, 0x77, 0xab, 0xdd, 0x73, 0xf4, 0x1a, 0xdb, 0xf7, 0x75, 0xee, 0x69, 0x37, 0x7c, 0xb0,
+    0x5f, 0x33, 0xd1, 0x48, 0xa1, 0xf4, 0xf1, 0xe6, 0xd5, 0x14, 0xab, 0x36, 0xca, 0xd2, 0xd3, 0xb2,
+    0x1b, 0x6f, 0xb1, 0xdc, 0xb4, 0xa9, 0x75, 0x9a, 0xae, 0x81, 0xca, 0x2d, 0x6a, 0x50, 0xdd, 0x8c,
+    0x0f, 0xb2, 0x41, 0x14, 0x4f, 0x8a, 0x2c, 0x1e, 0x67, 0xf1, 0x1c, 0xe5, 0xa1, 0xf5, 0x42, 0xbd,
+    0xb1, 0x1e, 0xe6, 0xb6, 0xa3, 0x5e, 0x3b, 0x71, 0x2d, 0xd8, 0xe7, 0xbf, 0x96, 0xbe, 0x82, 0x1c,
+    0x9d, 0x75, 0x1b, 0x2b, 0xe3, 0xfb, 0x56, 0xa9, 0x0f, 0xa3, 0x14, 0x7f, 0xc9, 0xf7, 0x4f, 0x95,
+    0x55, 0xe8, 0x29, 0x14, 0xcb, 0xa7, 0x54, 0x07, 0xf7, 0xac, 0xc3, 0xed, 0xe5, 0x52, 0x2c, 0xe3,
+    0xec, 0xb5, 0x35, 0xab, 0x67, 0x75, 0xad, 0x56, 0xe1, 0xb6, 0xcd, 0xb5, 0x95, 0x15, 0xac, 0xb4,
+    0x95, 0x9e, 0xb1, 0x92, 0x49, 0x76, 0xd5, 0x0d, 0xee, 0xc4, 0x26, 0xbd, 0x29, 0x24, 0x03, 0xbf,
+    0xe9, 0xcb, 0x52, 0x15, 0xef, 0x9b, 0x2a, 0xbd, 0x19, 0x1e, 0x1e, 0x30, 0x53, 0x64, 0x92, 0x35,
+    0x14, 0xf3, 0x5b, 0xb0, 0x5d, 0x83, 0x8a, 0xb1, 0x26, 0x98, 0x95, 0x91, 0xea, 0x17, 0xea, 0x4d,
+    0xd9, 0x8e, 0xaf, 0x23, 0xf2, 0x55, 0x02, 0x5b, 0xd2, 0xe6, 0x16, 0xd3, 0x37, 0x23, 0xb9, 0x2f,
+    0x1b, 0xff, 0xc0, 0x60, 0x78, 0x22, 0xce, 0x87, 0x84, 0xbd, 0x82, 0x19, 0xaa, 0xd3, 0xb0, 0x53,
+    0x86, 0x35, 0xaf, 0x40, 0x9a, 0xfb, 0x4c, 0xb4, 0xc0, 0x13, 0x97, 0xfd, 0xb8, 0x17, 0xcd, 0x97,
+    0x39, 0xc6, 0xd3, 0xf4, 0x3e, 0x49, 0x4b, 0xde, 0xc1, 0xb9, 0xf6, 0xff, 0xd3, 0x35, 0x72, 0xa5
 };
 
 const char* shaderSource() {
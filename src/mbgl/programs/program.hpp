@@ -10,6 +10,7 @@
 #include <mbgl/renderer/paint_property_binder.hpp>
 #include <mbgl/util/io.hpp>
 
+#include <cassert>
 #include <unordered_map>
 
 namespace mbgl {
@@ -114,6 +115,56 @@ public:
                 segment.indexLength);
         }
     }
+
+    // Draws every segment once per instance. The segments index geometry that all instances
+    // share, so the attribute bindings aren't offset by the segment's vertex offset.
+    template <class DrawMode>
+    void drawInstanced(gfx::Context& context,
+                       gfx::RenderPass& renderPass,
+                       const DrawMode& drawMode,
+                       const gfx::DepthMode& depthMode,
+                       const gfx::StencilMode& stencilMode,
+                       const gfx::ColorMode& colorMode,
+                       const gfx::CullFaceMode& cullFaceMode,
+                       const gfx::IndexBuffer& indexBuffer,
+                       const SegmentVector<AttributeList>& segments,
+                       const UniformValues& uniformValues,
+                       const AttributeBindings& allAttributeBindings,
+                       const TextureBindings& textureBindings,
+                       const std::string& layerID,
+                       std::size_t instanceCount) {
+        static_assert(Primitive == gfx::PrimitiveTypeOf<DrawMode>::value, "incompatible draw mode");
+
+        if (!program) {
+            return;
+        }
+
+        for (auto& segment : segments) {
+            assert(segment.vertexOffset == 0);
+            auto drawScopeIt = segment.drawScopes.find(layerID);
+
+            if (drawScopeIt == segment.drawScopes.end()) {
+                drawScopeIt = segment.drawScopes.emplace(layerID, context.createDrawScope()).first;
+            }
+
+            program->drawInstanced(
+                context,
+                renderPass,
+                drawMode,
+                depthMode,
+                stencilMode,
+                colorMode,
+                cullFaceMode,
+                uniformValues,
+                drawScopeIt->second,
+                allAttributeBindings,
+                textureBindings,
+                indexBuffer,
+                segment.indexOffset,
+                segment.indexLength,
+                instanceCount);
+        }
+    }
 };
 
 class LayerTypePrograms {
@@ -30,11 +30,19 @@ public:
 
     // Feature geometries are also used to populate the feature index.
     // Obtaining these is a costly operation, so we do it only once, and
-    // pass-by-const-ref the geometries as a second parameter.
+    // pass-by-const-ref the geometries as a second parameter. The last parameter is the index
+    // of the feature in its source layer.
     virtual void addFeature(const GeometryTileFeature&,
                             const GeometryCollection&,
                             const ImagePositions&,
-                            const PatternLayerMap&) {};
+                            const PatternLayerMap&,
+                            std::size_t) {};
+
+    // Re-evaluates the paint properties of the given layer that depend on feature state, for
+    // the features whose state changed. The source layer is used to look these features up.
+    // If any vertex changed, the bucket needs to be uploaded again, which only uploads the
+    // changed paint attributes.
+    virtual void update(const FeatureStates&, const GeometryTileLayer&, const std::string& /*layerID*/) {}
 
     // As long as this bucket has a Prepare render pass, this function is getting called. Typically,
     // this only happens once when the bucket is being rendered for the first time.
@@ -11,7 +11,8 @@ namespace mbgl {
 using namespace style;
 
 CircleBucket::CircleBucket(const BucketParameters& parameters, const std::vector<Immutable<style::LayerProperties>>& layers)
-    : mode(parameters.mode) {
+    : mode(parameters.mode),
+      instanced(parameters.supportsInstancing) {
     for (const auto& layer : layers) {
         paintPropertyBinders.emplace(
             std::piecewise_construct,
@@ -25,8 +26,16 @@ CircleBucket::CircleBucket(const BucketParameters& parameters, const std::vector
 CircleBucket::~CircleBucket() = default;
 
 void CircleBucket::upload(gfx::UploadPass& uploadPass) {
-    vertexBuffer = uploadPass.createVertexBuffer(std::move(vertices));
-    indexBuffer = uploadPass.createIndexBuffer(std::move(triangles));
+    if (instanced) {
+        if (!instanceVertexBuffer) {
+            quadVertexBuffer = uploadPass.createVertexBuffer(std::move(quadVertices));
+            instanceVertexBuffer = uploadPass.createVertexBuffer(std::move(instanceVertices));
+            indexBuffer = uploadPass.createIndexBuffer(std::move(triangles));
+        }
+    } else if (!vertexBuffer) {
+        vertexBuffer = uploadPass.createVertexBuffer(std::move(vertices));
+        indexBuffer = uploadPass.createIndexBuffer(std::move(triangles));
+    }
 
     for (auto& pair : paintPropertyBinders) {
         pair.second.upload(uploadPass);
@@ -35,14 +44,22 @@ void CircleBucket::upload(gfx::UploadPass& uploadPass) {
     uploaded = true;
 }
 
+void CircleBucket::update(const FeatureStates& states, const GeometryTileLayer& layer, const std::string& layerID) {
+    auto it = paintPropertyBinders.find(layerID);
+    if (it != paintPropertyBinders.end() && it->second.updateVertexVectors(states, layer)) {
+        uploaded = false;
+    }
+}
+
 bool CircleBucket::hasData() const {
-    return !segments.empty();
+    return !segments.empty() || !instancedSegments.empty();
 }
 
 void CircleBucket::addFeature(const GeometryTileFeature& feature,
                                  const GeometryCollection& geometry,
                                  const ImagePositions&,
-                                 const PatternLayerMap&) {
+                                 const PatternLayerMap&,
+                                 std::size_t featureIndex) {
     constexpr const uint16_t vertexLength = 4;
 
     for (auto& circle : geometry) {
@@ -56,6 +73,22 @@ void CircleBucket::addFeature(const GeometryTileFeature& feature,
             if ((mode == MapMode::Continuous) &&
                 (x < 0 || x >= util::EXTENT || y < 0 || y >= util::EXTENT)) continue;
 
+            if (instanced) {
+                if (instancedSegments.empty()) {
+                    // The quad that all circles share, see below for the vertex order.
+                    quadVertices.emplace_back(CircleInstancedProgram::quadVertex(-1, -1)); // 1
+                    quadVertices.emplace_back(CircleInstancedProgram::quadVertex( 1, -1)); // 2
+                    quadVertices.emplace_back(CircleInstancedProgram::quadVertex( 1,  1)); // 3
+                    quadVertices.emplace_back(CircleInstancedProgram::quadVertex(-1,  1)); // 4
+                    triangles.emplace_back(0, 1, 2);
+                    triangles.emplace_back(0, 3, 2);
+                    instancedSegments.emplace_back(0, 0, vertexLength, 6);
+                }
+
+                instanceVertices.emplace_back(CircleInstancedProgram::instanceVertex(point));
+                continue;
+            }
+
             if (segments.empty() || segments.back().vertexLength + vertexLength > std::numeric_limits<uint16_t>::max()) {
                 // Move to a new segments because the old one can't hold the geometry.
                 segments.emplace_back(vertices.elements(), triangles.elements());
@@ -90,7 +123,7 @@ void CircleBucket::addFeature(const GeometryTileFeature& feature,
     }
 
     for (auto& pair : paintPropertyBinders) {
-        pair.second.populateVertexVectors(feature, vertices.elements(), {}, {});
+        pair.second.populateVertexVectors(feature, instanced ? instanceVertices.elements() : vertices.elements(), featureIndex, {}, {});
     }
 }
 
@@ -21,10 +21,13 @@ public:
     void addFeature(const GeometryTileFeature&,
                     const GeometryCollection&,
                     const ImagePositions&,
-                    const PatternLayerMap&) override;
+                    const PatternLayerMap&,
+                    std::size_t) override;
 
     bool hasData() const override;
 
+    void update(const FeatureStates&, const GeometryTileLayer&, const std::string&) override;
+
     void upload(gfx::UploadPass&) override;
 
     float getQueryRadius(const RenderLayer&) const override;
@@ -36,9 +39,19 @@ public:
     optional<gfx::VertexBuffer<CircleLayoutVertex>> vertexBuffer;
     optional<gfx::IndexBuffer> indexBuffer;
 
+    // Instanced layout, used if the context supports instancing: every circle is drawn as an
+    // instance of the same quad, so the bucket only stores its center.
+    gfx::VertexVector<CircleQuadVertex> quadVertices;
+    gfx::VertexVector<CircleInstanceVertex> instanceVertices;
+    SegmentVector<CircleInstancedAttributes> instancedSegments;
+
+    optional<gfx::VertexBuffer<CircleQuadVertex>> quadVertexBuffer;
+    optional<gfx::VertexBuffer<CircleInstanceVertex>> instanceVertexBuffer;
+
     std::map<std::string, CircleProgram::Binders> paintPropertyBinders;
 
     const MapMode mode;
+    const bool instanced;
 };
 
 } // namespace mbgl
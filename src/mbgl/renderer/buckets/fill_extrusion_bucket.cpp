@@ -53,7 +53,8 @@ FillExtrusionBucket::~FillExtrusionBucket() = default;
 void FillExtrusionBucket::addFeature(const GeometryTileFeature& feature,
                                      const GeometryCollection& geometry,
                                      const ImagePositions& patternPositions,
-                                     const PatternLayerMap& patternDependencies) {
+                                     const PatternLayerMap& patternDependencies,
+                                     std::size_t featureIndex) {
     for (auto& polygon : classifyRings(geometry)) {
         // Optimize polygons with many interior rings for earcut tesselation.
         limitHoles(polygon, 500);
@@ -158,16 +159,18 @@ void FillExtrusionBucket::addFeature(const GeometryTileFeature& feature,
     for (auto& pair : paintPropertyBinders) {
         const auto it = patternDependencies.find(pair.first);
         if (it != patternDependencies.end()){
-            pair.second.populateVertexVectors(feature, vertices.elements(), patternPositions, it->second);
+            pair.second.populateVertexVectors(feature, vertices.elements(), featureIndex, patternPositions, it->second);
         } else {
-            pair.second.populateVertexVectors(feature, vertices.elements(), patternPositions, {});
+            pair.second.populateVertexVectors(feature, vertices.elements(), featureIndex, patternPositions, {});
         }
     }
 }
 
 void FillExtrusionBucket::upload(gfx::UploadPass& uploadPass) {
-    vertexBuffer = uploadPass.createVertexBuffer(std::move(vertices));
-    indexBuffer = uploadPass.createIndexBuffer(std::move(triangles));
+    if (!vertexBuffer) {
+        vertexBuffer = uploadPass.createVertexBuffer(std::move(vertices));
+        indexBuffer = uploadPass.createIndexBuffer(std::move(triangles));
+    }
 
     for (auto& pair : paintPropertyBinders) {
         pair.second.upload(uploadPass);
@@ -176,6 +179,13 @@ void FillExtrusionBucket::upload(gfx::UploadPass& uploadPass) {
     uploaded = true;
 }
 
+void FillExtrusionBucket::update(const FeatureStates& states, const GeometryTileLayer& layer, const std::string& layerID) {
+    auto it = paintPropertyBinders.find(layerID);
+    if (it != paintPropertyBinders.end() && it->second.updateVertexVectors(states, layer)) {
+        uploaded = false;
+    }
+}
+
 bool FillExtrusionBucket::hasData() const {
     return !triangleSegments.empty();
 }
@@ -27,10 +27,13 @@ public:
     void addFeature(const GeometryTileFeature&,
                     const GeometryCollection&,
                     const mbgl::ImagePositions&,
-                    const PatternLayerMap&) override;
+                    const PatternLayerMap&,
+                    std::size_t) override;
 
     bool hasData() const override;
 
+    void update(const FeatureStates&, const GeometryTileLayer&, const std::string&) override;
+
     void upload(gfx::UploadPass&) override;
 
     float getQueryRadius(const RenderLayer&) const override;
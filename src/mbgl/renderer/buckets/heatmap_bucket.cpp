@@ -25,8 +25,10 @@ HeatmapBucket::HeatmapBucket(const BucketParameters& parameters, const std::vect
 HeatmapBucket::~HeatmapBucket() = default;
 
 void HeatmapBucket::upload(gfx::UploadPass& uploadPass) {
-    vertexBuffer = uploadPass.createVertexBuffer(std::move(vertices));
-    indexBuffer = uploadPass.createIndexBuffer(std::move(triangles));
+    if (!vertexBuffer) {
+        vertexBuffer = uploadPass.createVertexBuffer(std::move(vertices));
+        indexBuffer = uploadPass.createIndexBuffer(std::move(triangles));
+    }
 
     for (auto& pair : paintPropertyBinders) {
         pair.second.upload(uploadPass);
@@ -35,6 +37,13 @@ void HeatmapBucket::upload(gfx::UploadPass& uploadPass) {
     uploaded = true;
 }
 
+void HeatmapBucket::update(const FeatureStates& states, const GeometryTileLayer& layer, const std::string& layerID) {
+    auto it = paintPropertyBinders.find(layerID);
+    if (it != paintPropertyBinders.end() && it->second.updateVertexVectors(states, layer)) {
+        uploaded = false;
+    }
+}
+
 bool HeatmapBucket::hasData() const {
     return !segments.empty();
 }
@@ -42,7 +51,8 @@ bool HeatmapBucket::hasData() const {
 void HeatmapBucket::addFeature(const GeometryTileFeature& feature,
                                const GeometryCollection& geometry,
                                const ImagePositions&,
-                               const PatternLayerMap&) {
+                               const PatternLayerMap&,
+                               std::size_t featureIndex) {
     constexpr const uint16_t vertexLength = 4;
 
     for (auto& points : geometry) {
@@ -89,7 +99,7 @@ void HeatmapBucket::addFeature(const GeometryTileFeature& feature,
     }
 
     for (auto& pair : paintPropertyBinders) {
-        pair.second.populateVertexVectors(feature, vertices.elements(), {}, {});
+        pair.second.populateVertexVectors(feature, vertices.elements(), featureIndex, {}, {});
     }
 }
 
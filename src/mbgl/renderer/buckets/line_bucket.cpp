@@ -33,7 +33,8 @@ LineBucket::~LineBucket() = default;
 void LineBucket::addFeature(const GeometryTileFeature& feature,
                             const GeometryCollection& geometryCollection,
                             const ImagePositions& patternPositions,
-                            const PatternLayerMap& patternDependencies) {
+                            const PatternLayerMap& patternDependencies,
+                            std::size_t featureIndex) {
     for (auto& line : geometryCollection) {
         addGeometry(line, feature);
     }
@@ -41,9 +42,9 @@ void LineBucket::addFeature(const GeometryTileFeature& feature,
     for (auto& pair : paintPropertyBinders) {
         const auto it = patternDependencies.find(pair.first);
         if (it != patternDependencies.end()){
-            pair.second.populateVertexVectors(feature, vertices.elements(), patternPositions, it->second);
+            pair.second.populateVertexVectors(feature, vertices.elements(), featureIndex, patternPositions, it->second);
         } else {
-            pair.second.populateVertexVectors(feature, vertices.elements(), patternPositions, {});
+            pair.second.populateVertexVectors(feature, vertices.elements(), featureIndex, patternPositions, {});
         }
     }
 }
@@ -509,8 +510,10 @@ void LineBucket::addPieSliceVertex(const GeometryCoordinate& currentVertex,
 }
 
 void LineBucket::upload(gfx::UploadPass& uploadPass) {
-    vertexBuffer = uploadPass.createVertexBuffer(std::move(vertices));
-    indexBuffer = uploadPass.createIndexBuffer(std::move(triangles));
+    if (!vertexBuffer) {
+        vertexBuffer = uploadPass.createVertexBuffer(std::move(vertices));
+        indexBuffer = uploadPass.createIndexBuffer(std::move(triangles));
+    }
 
     for (auto& pair : paintPropertyBinders) {
         pair.second.upload(uploadPass);
@@ -519,6 +522,13 @@ void LineBucket::upload(gfx::UploadPass& uploadPass) {
     uploaded = true;
 }
 
+void LineBucket::update(const FeatureStates& states, const GeometryTileLayer& layer, const std::string& layerID) {
+    auto it = paintPropertyBinders.find(layerID);
+    if (it != paintPropertyBinders.end() && it->second.updateVertexVectors(states, layer)) {
+        uploaded = false;
+    }
+}
+
 bool LineBucket::hasData() const {
     return !segments.empty();
 }
@@ -49,18 +49,34 @@ SymbolBucket::SymbolBucket(style::SymbolLayoutProperties::PossiblyEvaluated layo
 
 SymbolBucket::~SymbolBucket() = default;
 
+void SymbolBucket::update(const FeatureStates& states, const GeometryTileLayer& layer, const std::string& layerID) {
+    auto it = paintProperties.find(layerID);
+    if (it == paintProperties.end()) {
+        return;
+    }
+    // Not short-circuited: both the icon and the text vertices may need an update.
+    const bool iconUpdated = it->second.iconBinders.updateVertexVectors(states, layer);
+    const bool textUpdated = it->second.textBinders.updateVertexVectors(states, layer);
+    if (iconUpdated || textUpdated) {
+        uploaded = false;
+    }
+}
+
 void SymbolBucket::upload(gfx::UploadPass& uploadPass) {
     if (hasTextData()) {
         if (!staticUploaded) {
             text.indexBuffer = uploadPass.createIndexBuffer(std::move(text.triangles), sortFeaturesByY ? gfx::BufferUsageType::StreamDraw : gfx::BufferUsageType::StaticDraw);
             text.vertexBuffer = uploadPass.createVertexBuffer(std::move(text.vertices));
-            for (auto& pair : paintProperties) {
-                pair.second.textBinders.upload(uploadPass);
-            }
         } else if (!sortUploaded) {
             uploadPass.updateIndexBuffer(*text.indexBuffer, std::move(text.triangles));
         }
 
+        // Creates the paint attribute buffers on the first upload, and uploads the vertices
+        // changed by feature state updates afterwards.
+        for (auto& pair : paintProperties) {
+            pair.second.textBinders.upload(uploadPass);
+        }
+
         if (!dynamicUploaded) {
             if (!text.dynamicVertexBuffer) {
                 text.dynamicVertexBuffer = uploadPass.createVertexBuffer(std::move(text.dynamicVertices), gfx::BufferUsageType::StreamDraw);
@@ -81,12 +97,14 @@ void SymbolBucket::upload(gfx::UploadPass& uploadPass) {
         if (!staticUploaded) {
             icon.indexBuffer = uploadPass.createIndexBuffer(std::move(icon.triangles), sortFeaturesByY ? gfx::BufferUsageType::StreamDraw : gfx::BufferUsageType::StaticDraw);
             icon.vertexBuffer = uploadPass.createVertexBuffer(std::move(icon.vertices));
-            for (auto& pair : paintProperties) {
-                pair.second.iconBinders.upload(uploadPass);
-            }
         } else if (!sortUploaded) {
             uploadPass.updateIndexBuffer(*icon.indexBuffer, std::move(icon.triangles));
         }
+
+        for (auto& pair : paintProperties) {
+            pair.second.iconBinders.upload(uploadPass);
+        }
+
         if (!dynamicUploaded) {
             if (!icon.dynamicVertexBuffer) {
                 icon.dynamicVertexBuffer = uploadPass.createVertexBuffer(std::move(icon.dynamicVertices), gfx::BufferUsageType::StreamDraw);
@@ -57,6 +57,7 @@ public:
     ~SymbolBucket() override;
 
     void upload(gfx::UploadPass&) override;
+    void update(const FeatureStates&, const GeometryTileLayer&, const std::string&) override;
     bool hasData() const override;
     std::pair<uint32_t, bool> registerAtCrossTileIndex(CrossTileSymbolLayerIndex&, const OverscaledTileID&, uint32_t& maxCrossTileID) override;
     uint32_t place(Placement&, const BucketPlacementParameters&, std::set<uint32_t>&) override;
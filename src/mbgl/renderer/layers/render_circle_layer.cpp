@@ -8,6 +8,7 @@
 #include <mbgl/style/layers/circle_layer_impl.hpp>
 #include <mbgl/geometry/feature_index.hpp>
 #include <mbgl/gfx/cull_face_mode.hpp>
+#include <mbgl/gfx/context.hpp>
 #include <mbgl/util/math.hpp>
 #include <mbgl/util/intersection_tests.hpp>
 
@@ -68,9 +69,10 @@ void RenderCircleLayer::render(PaintParameters& parameters) {
         const bool pitchWithMap = evaluated.get<CirclePitchAlignment>() == AlignmentType::Map;
         const auto& paintPropertyBinders = bucket.paintPropertyBinders.at(getID());
 
-        auto& programInstance = parameters.programs.getCircleLayerPrograms().circle;
-   
-        const auto allUniformValues = programInstance.computeAllUniformValues(
+        auto& programs = parameters.programs.getCircleLayerPrograms();
+
+        // Both programs share their uniforms.
+        const auto allUniformValues = CircleProgram::computeAllUniformValues(
             CircleProgram::LayoutUniformValues {
                 uniforms::matrix::Value(
                     tile.translatedMatrix(evaluated.get<CircleTranslate>(),
@@ -91,6 +93,42 @@ void RenderCircleLayer::render(PaintParameters& parameters) {
             evaluated,
             parameters.state.getZoom()
         );
+
+        // Buckets only use the instanced layout if the context supports instancing.
+        if (bucket.instanced) {
+            assert(parameters.context.supportsInstancing);
+            auto& programInstance = programs.circleInstanced;
+
+            const auto allAttributeBindings = programInstance.computeAllAttributeBindings(
+                *bucket.quadVertexBuffer,
+                *bucket.instanceVertexBuffer,
+                paintPropertyBinders,
+                evaluated
+            );
+
+            checkRenderability(parameters, programInstance.activeBindingCount(allAttributeBindings));
+
+            programInstance.drawInstanced(
+                parameters.context,
+                *parameters.renderPass,
+                gfx::Triangles(),
+                parameters.depthModeForSublayer(0, gfx::DepthMaskType::ReadOnly),
+                gfx::StencilMode::disabled(),
+                parameters.colorModeForRenderPass(),
+                gfx::CullFaceMode::disabled(),
+                *bucket.indexBuffer,
+                bucket.instancedSegments,
+                allUniformValues,
+                allAttributeBindings,
+                CircleInstancedProgram::TextureBindings{},
+                getID(),
+                bucket.instanceVertexBuffer->elements
+            );
+            continue;
+        }
+
+        auto& programInstance = programs.circle;
+
         const auto allAttributeBindings = programInstance.computeAllAttributeBindings(
             *bucket.vertexBuffer,
             paintPropertyBinders,
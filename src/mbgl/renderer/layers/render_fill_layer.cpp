@@ -75,6 +75,60 @@ bool RenderFillLayer::hasCrossfade() const {
 void RenderFillLayer::render(PaintParameters& parameters) {
     if (unevaluated.get<FillPattern>().isUndefined()) {
         parameters.renderTileClippingMasks(renderTiles);
+
+        auto draw = [&] (const RenderTile& tile,
+                         const LayerRenderData& renderData,
+                         auto& programInstance,
+                         const auto& drawMode,
+                         const auto& depthMode,
+                         const auto& indexBuffer,
+                         const auto& segments,
+                         auto&& textureBindings) {
+            auto& bucket = static_cast<FillBucket&>(*renderData.bucket);
+            const auto& evaluated = getEvaluated<FillLayerProperties>(renderData.layerProperties);
+            const auto& paintPropertyBinders = bucket.paintPropertyBinders.at(getID());
+
+            const auto allUniformValues = programInstance.computeAllUniformValues(
+                FillProgram::LayoutUniformValues {
+                    uniforms::matrix::Value(
+                        tile.translatedMatrix(evaluated.get<FillTranslate>(),
+                                              evaluated.get<FillTranslateAnchor>(),
+                                              parameters.state)
+                    ),
+                    uniforms::world::Value( parameters.backend.getDefaultRenderable().getSize() ),
+                },
+                paintPropertyBinders,
+                evaluated,
+                parameters.state.getZoom()
+            );
+            const auto allAttributeBindings = programInstance.computeAllAttributeBindings(
+                *bucket.vertexBuffer,
+                paintPropertyBinders,
+                evaluated
+            );
+
+            checkRenderability(parameters, programInstance.activeBindingCount(allAttributeBindings));
+
+            programInstance.draw(
+                parameters.context,
+                *parameters.renderPass,
+                drawMode,
+                depthMode,
+                parameters.stencilModeForClipping(tile.id),
+                parameters.colorModeForRenderPass(),
+                gfx::CullFaceMode::disabled(),
+                indexBuffer,
+                segments,
+                allUniformValues,
+                allAttributeBindings,
+                std::move(textureBindings),
+                getID()
+            );
+        };
+
+        // Draw the fills of all tiles before any of their outlines, so that each program is
+        // bound once per layer instead of once per tile. Tiles don't overlap, so this doesn't
+        // change the rendered result.
         for (const RenderTile& tile : renderTiles) {
             const LayerRenderData* renderData = tile.tile.getLayerRenderData(*baseImpl);
             if (!renderData) {
@@ -83,58 +137,13 @@ void RenderFillLayer::render(PaintParameters& parameters) {
             auto& bucket = static_cast<FillBucket&>(*renderData->bucket);
             const auto& evaluated = getEvaluated<FillLayerProperties>(renderData->layerProperties);
 
-            auto draw = [&] (auto& programInstance,
-                             const auto& drawMode,
-                             const auto& depthMode,
-                             const auto& indexBuffer,
-                             const auto& segments,
-                             auto&& textureBindings) {
-                const auto& paintPropertyBinders = bucket.paintPropertyBinders.at(getID());
-
-                const auto allUniformValues = programInstance.computeAllUniformValues(
-                    FillProgram::LayoutUniformValues {
-                        uniforms::matrix::Value(
-                            tile.translatedMatrix(evaluated.get<FillTranslate>(),
-                                                  evaluated.get<FillTranslateAnchor>(),
-                                                  parameters.state)
-                        ),
-                        uniforms::world::Value( parameters.backend.getDefaultRenderable().getSize() ),
-                    },
-                    paintPropertyBinders,
-                    evaluated,
-                    parameters.state.getZoom()
-                );
-                const auto allAttributeBindings = programInstance.computeAllAttributeBindings(
-                    *bucket.vertexBuffer,
-                    paintPropertyBinders,
-                    evaluated
-                );
-
-                checkRenderability(parameters, programInstance.activeBindingCount(allAttributeBindings));
-
-                programInstance.draw(
-                    parameters.context,
-                    *parameters.renderPass,
-                    drawMode,
-                    depthMode,
-                    parameters.stencilModeForClipping(tile.id),
-                    parameters.colorModeForRenderPass(),
-                    gfx::CullFaceMode::disabled(),
-                    indexBuffer,
-                    segments,
-                    allUniformValues,
-                    allAttributeBindings,
-                    std::move(textureBindings),
-                    getID()
-                );
-            };
-
             // Only draw the fill when it's opaque and we're drawing opaque fragments,
             // or when it's translucent and we're drawing translucent fragments.
             if (bucket.triangleIndexBuffer &&
               (evaluated.get<FillColor>().constantOr(Color()).a >= 1.0f &&
                evaluated.get<FillOpacity>().constantOr(0) >= 1.0f) == (parameters.pass == RenderPass::Opaque)) {
-                draw(parameters.programs.getFillLayerPrograms().fill,
+                draw(tile, *renderData,
+                     parameters.programs.getFillLayerPrograms().fill,
                      gfx::Triangles(),
                      parameters.depthModeForSublayer(1, parameters.pass == RenderPass::Opaque
                         ? gfx::DepthMaskType::ReadWrite
@@ -143,9 +152,23 @@ void RenderFillLayer::render(PaintParameters& parameters) {
                      bucket.triangleSegments,
                      FillProgram::TextureBindings{});
             }
+        }
+
+        if (parameters.pass != RenderPass::Translucent) {
+            return;
+        }
+
+        for (const RenderTile& tile : renderTiles) {
+            const LayerRenderData* renderData = tile.tile.getLayerRenderData(*baseImpl);
+            if (!renderData) {
+                continue;
+            }
+            auto& bucket = static_cast<FillBucket&>(*renderData->bucket);
+            const auto& evaluated = getEvaluated<FillLayerProperties>(renderData->layerProperties);
 
-            if (evaluated.get<FillAntialias>() && parameters.pass == RenderPass::Translucent) {
-                draw(parameters.programs.getFillLayerPrograms().fillOutline,
+            if (evaluated.get<FillAntialias>()) {
+                draw(tile, *renderData,
+                     parameters.programs.getFillLayerPrograms().fillOutline,
                      gfx::Lines{ 2.0f },
                      parameters.depthModeForSublayer(
                          unevaluated.get<FillOutlineColor>().isUndefined() ? 2 : 0,
@@ -162,72 +185,79 @@ void RenderFillLayer::render(PaintParameters& parameters) {
 
         parameters.renderTileClippingMasks(renderTiles);
 
+        auto draw = [&] (const RenderTile& tile,
+                         const LayerRenderData& renderData,
+                         auto& programInstance,
+                         const auto& drawMode,
+                         const auto& depthMode,
+                         const auto& indexBuffer,
+                         const auto& segments,
+                         auto&& textureBindings) {
+            auto& bucket = static_cast<FillBucket&>(*renderData.bucket);
+            const auto& evaluated = getEvaluated<FillLayerProperties>(renderData.layerProperties);
+            const auto& crossfade = getCrossfade<FillLayerProperties>(renderData.layerProperties);
+
+            const auto& fillPatternValue = evaluated.get<FillPattern>().constantOr(Faded<std::basic_string<char>>{"", ""});
+            auto& geometryTile = static_cast<GeometryTile&>(tile.tile);
+            optional<ImagePosition> patternPosA = geometryTile.getPattern(fillPatternValue.from);
+            optional<ImagePosition> patternPosB = geometryTile.getPattern(fillPatternValue.to);
+
+            const auto& paintPropertyBinders = bucket.paintPropertyBinders.at(getID());
+            paintPropertyBinders.setPatternParameters(patternPosA, patternPosB, crossfade);
+
+            const auto allUniformValues = programInstance.computeAllUniformValues(
+                FillPatternProgram::layoutUniformValues(
+                    tile.translatedMatrix(evaluated.get<FillTranslate>(),
+                                          evaluated.get<FillTranslateAnchor>(),
+                                          parameters.state),
+                    parameters.backend.getDefaultRenderable().getSize(),
+                    geometryTile.iconAtlasTexture->size,
+                    crossfade,
+                    tile.id,
+                    parameters.state,
+                    parameters.pixelRatio
+                ),
+                paintPropertyBinders,
+                evaluated,
+                parameters.state.getZoom()
+            );
+            const auto allAttributeBindings = programInstance.computeAllAttributeBindings(
+                *bucket.vertexBuffer,
+                paintPropertyBinders,
+                evaluated
+            );
+
+            checkRenderability(parameters, programInstance.activeBindingCount(allAttributeBindings));
+
+            programInstance.draw(
+                parameters.context,
+                *parameters.renderPass,
+                drawMode,
+                depthMode,
+                parameters.stencilModeForClipping(tile.id),
+                parameters.colorModeForRenderPass(),
+                gfx::CullFaceMode::disabled(),
+                indexBuffer,
+                segments,
+                allUniformValues,
+                allAttributeBindings,
+                std::move(textureBindings),
+                getID()
+            );
+        };
+
+        // Draw the patterns of all tiles before any of their outlines; see above.
         for (const RenderTile& tile : renderTiles) {
             const LayerRenderData* renderData = tile.tile.getLayerRenderData(*baseImpl);
             if (!renderData) {
                 continue;
             }
             auto& bucket = static_cast<FillBucket&>(*renderData->bucket);
-            const auto& evaluated = getEvaluated<FillLayerProperties>(renderData->layerProperties);
-            const auto& crossfade = getCrossfade<FillLayerProperties>(renderData->layerProperties);
-
-            const auto& fillPatternValue = evaluated.get<FillPattern>().constantOr(Faded<std::basic_string<char>>{"", ""});
             auto& geometryTile = static_cast<GeometryTile&>(tile.tile);
-            optional<ImagePosition> patternPosA = geometryTile.getPattern(fillPatternValue.from);
-            optional<ImagePosition> patternPosB = geometryTile.getPattern(fillPatternValue.to);
-
-            auto draw = [&] (auto& programInstance,
-                             const auto& drawMode,
-                             const auto& depthMode,
-                             const auto& indexBuffer,
-                             const auto& segments,
-                             auto&& textureBindings) {
-                const auto& paintPropertyBinders = bucket.paintPropertyBinders.at(getID());
-                paintPropertyBinders.setPatternParameters(patternPosA, patternPosB, crossfade);
-
-                const auto allUniformValues = programInstance.computeAllUniformValues(
-                    FillPatternProgram::layoutUniformValues(
-                        tile.translatedMatrix(evaluated.get<FillTranslate>(),
-                                              evaluated.get<FillTranslateAnchor>(),
-                                              parameters.state),
-                        parameters.backend.getDefaultRenderable().getSize(),
-                        geometryTile.iconAtlasTexture->size,
-                        crossfade,
-                        tile.id,
-                        parameters.state,
-                        parameters.pixelRatio
-                    ),
-                    paintPropertyBinders,
-                    evaluated,
-                    parameters.state.getZoom()
-                );
-                const auto allAttributeBindings = programInstance.computeAllAttributeBindings(
-                    *bucket.vertexBuffer,
-                    paintPropertyBinders,
-                    evaluated
-                );
-
-                checkRenderability(parameters, programInstance.activeBindingCount(allAttributeBindings));
-
-                programInstance.draw(
-                    parameters.context,
-                    *parameters.renderPass,
-                    drawMode,
-                    depthMode,
-                    parameters.stencilModeForClipping(tile.id),
-                    parameters.colorModeForRenderPass(),
-                    gfx::CullFaceMode::disabled(),
-                    indexBuffer,
-                    segments,
-                    allUniformValues,
-                    allAttributeBindings,
-                    std::move(textureBindings),
-                    getID()
-                );
-            };
 
             if (bucket.triangleIndexBuffer) {
-                draw(parameters.programs.getFillLayerPrograms().fillPattern,
+                draw(tile, *renderData,
+                     parameters.programs.getFillLayerPrograms().fillPattern,
                      gfx::Triangles(),
                      parameters.depthModeForSublayer(1, gfx::DepthMaskType::ReadWrite),
                      *bucket.triangleIndexBuffer,
@@ -236,8 +266,20 @@ void RenderFillLayer::render(PaintParameters& parameters) {
                          textures::image::Value{ geometryTile.iconAtlasTexture->getResource(), gfx::TextureFilterType::Linear },
                      });
             }
+        }
+
+        for (const RenderTile& tile : renderTiles) {
+            const LayerRenderData* renderData = tile.tile.getLayerRenderData(*baseImpl);
+            if (!renderData) {
+                continue;
+            }
+            auto& bucket = static_cast<FillBucket&>(*renderData->bucket);
+            const auto& evaluated = getEvaluated<FillLayerProperties>(renderData->layerProperties);
+            auto& geometryTile = static_cast<GeometryTile&>(tile.tile);
+
             if (evaluated.get<FillAntialias>() && unevaluated.get<FillOutlineColor>().isUndefined()) {
-                draw(parameters.programs.getFillLayerPrograms().fillOutlinePattern,
+                draw(tile, *renderData,
+                     parameters.programs.getFillLayerPrograms().fillOutlinePattern,
                      gfx::Lines { 2.0f },
                      parameters.depthModeForSublayer(2, gfx::DepthMaskType::ReadOnly),
                      *bucket.lineIndexBuffer,
@@ -16,6 +16,8 @@
 #include <mbgl/layout/pattern_layout.hpp>
 
 #include <bitset>
+#include <limits>
+#include <unordered_map>
 
 namespace mbgl {
 
@@ -66,6 +68,22 @@ std::array<float, N*2> zoomInterpolatedAttributeValue(const std::array<float, N>
     return result;
 }
 
+/*
+   Vertices [start, end) of a paint attribute vertex vector were populated for the feature at
+   featureIndex in its source layer. Binders for expressions using `feature-state` remember
+   these ranges per feature ID, so that a state change only rewrites the vertices of the
+   features it affects instead of laying out the whole tile again. Text vertices also keep the
+   formatted section they belong to, which expressions may depend on as well.
+*/
+struct FeatureVertexRange {
+    std::size_t featureIndex;
+    std::size_t start;
+    std::size_t end;
+    style::expression::Value formattedSection;
+};
+
+using FeatureVertexRangeMap = std::unordered_map<std::string, std::vector<FeatureVertexRange>>;
+
 /*
    PaintPropertyBinder is an abstract class serving as the interface definition for
    the strategy used for constructing, uploading, and binding paint property data as
@@ -97,9 +115,12 @@ public:
     virtual ~PaintPropertyBinder() = default;
 
     virtual void populateVertexVector(const GeometryTileFeature& feature,
-                                      std::size_t length, const ImagePositions&,
+                                      std::size_t length, std::size_t index, const ImagePositions&,
                                       const optional<PatternDependency>&,
                                       const style::expression::Value&) = 0;
+    // Re-evaluates the vertices of the features whose state is given. Returns whether any
+    // vertex changed, in which case the next upload() only uploads the changed vertices.
+    virtual bool updateVertexVector(const FeatureStates&, const GeometryTileLayer&) = 0;
     virtual void upload(gfx::UploadPass&) = 0;
     virtual void setPatternParameters(const optional<ImagePosition>&, const optional<ImagePosition>&, const CrossfadeParameters&) = 0;
     virtual std::tuple<ExpandToType<As, optional<gfx::AttributeBinding>>...> attributeBinding(const PossiblyEvaluatedType& currentValue) const = 0;
@@ -118,7 +139,8 @@ public:
         : constant(std::move(constant_)) {
     }
 
-    void populateVertexVector(const GeometryTileFeature&, std::size_t, const ImagePositions&, const optional<PatternDependency>&, const style::expression::Value&) override {}
+    void populateVertexVector(const GeometryTileFeature&, std::size_t, std::size_t, const ImagePositions&, const optional<PatternDependency>&, const style::expression::Value&) override {}
+    bool updateVertexVector(const FeatureStates&, const GeometryTileLayer&) override { return false; }
     void upload(gfx::UploadPass&) override {}
     void setPatternParameters(const optional<ImagePosition>&, const optional<ImagePosition>&, const CrossfadeParameters&) override {};
 
@@ -145,7 +167,8 @@ public:
         : constant(std::move(constant_)), constantPatternPositions({}) {
     }
 
-    void populateVertexVector(const GeometryTileFeature&, std::size_t, const ImagePositions&, const optional<PatternDependency>&, const style::expression::Value&) override {}
+    void populateVertexVector(const GeometryTileFeature&, std::size_t, std::size_t, const ImagePositions&, const optional<PatternDependency>&, const style::expression::Value&) override {}
+    bool updateVertexVector(const FeatureStates&, const GeometryTileLayer&) override { return false; }
     void upload(gfx::UploadPass&) override {}
 
     void setPatternParameters(const optional<ImagePosition>& posA, const optional<ImagePosition>& posB, const CrossfadeParameters&) override {
@@ -187,18 +210,56 @@ public:
           defaultValue(std::move(defaultValue_)) {
     }
     void setPatternParameters(const optional<ImagePosition>&, const optional<ImagePosition>&, const CrossfadeParameters&) override {};
-    void populateVertexVector(const GeometryTileFeature& feature, std::size_t length, const ImagePositions&, const optional<PatternDependency>&, const style::expression::Value& formattedSection) override {
+    void populateVertexVector(const GeometryTileFeature& feature, std::size_t length, std::size_t index, const ImagePositions&, const optional<PatternDependency>&, const style::expression::Value& formattedSection) override {
         using style::expression::EvaluationContext;
         auto evaluated = expression.evaluate(EvaluationContext(&feature).withFormattedSection(&formattedSection), defaultValue);
         this->statistics.add(evaluated);
         auto value = attributeValue(evaluated);
-        for (std::size_t i = vertexVector.elements(); i < length; ++i) {
+        const std::size_t start = vertexVector.elements();
+        for (std::size_t i = start; i < length; ++i) {
             vertexVector.emplace_back(BaseVertex { value });
         }
+        if (!expression.isStateConstant() && start < length) {
+            if (auto id = featureIDtoString(feature.getID())) {
+                featureMap[*id].push_back({ index, start, length, formattedSection });
+            }
+        }
+    }
+
+    bool updateVertexVector(const FeatureStates& states, const GeometryTileLayer& layer) override {
+        using style::expression::EvaluationContext;
+        bool updated = false;
+        for (const auto& state : states) {
+            auto it = featureMap.find(state.first);
+            if (it == featureMap.end()) {
+                continue;
+            }
+            for (const auto& range : it->second) {
+                auto feature = layer.getFeature(range.featureIndex);
+                auto evaluated = expression.evaluate(EvaluationContext(feature.get())
+                                                         .withFormattedSection(&range.formattedSection)
+                                                         .withFeatureState(&state.second), defaultValue);
+                this->statistics.add(evaluated);
+                auto value = attributeValue(evaluated);
+                for (std::size_t i = range.start; i < range.end; ++i) {
+                    vertexVector.at(i) = BaseVertex { value };
+                }
+                dirtyStart = std::min(dirtyStart, range.start);
+                dirtyEnd = std::max(dirtyEnd, range.end);
+                updated = true;
+            }
+        }
+        return updated;
     }
 
     void upload(gfx::UploadPass& uploadPass) override {
-        vertexBuffer = uploadPass.createVertexBuffer(std::move(vertexVector));
+        if (!vertexBuffer) {
+            vertexBuffer = uploadPass.createVertexBuffer(std::move(vertexVector));
+        } else if (dirtyStart < dirtyEnd) {
+            uploadPass.updateVertexBufferSub(*vertexBuffer, vertexVector, dirtyStart, dirtyEnd);
+        }
+        dirtyStart = std::numeric_limits<std::size_t>::max();
+        dirtyEnd = 0;
     }
 
     std::tuple<optional<gfx::AttributeBinding>> attributeBinding(const PossiblyEvaluatedPropertyValue<T>& currentValue) const override {
@@ -229,6 +290,9 @@ private:
     T defaultValue;
     gfx::VertexVector<BaseVertex> vertexVector;
     optional<gfx::VertexBuffer<BaseVertex>> vertexBuffer;
+    FeatureVertexRangeMap featureMap;
+    std::size_t dirtyStart = std::numeric_limits<std::size_t>::max();
+    std::size_t dirtyEnd = 0;
 };
 
 template <class T, class A>
@@ -245,7 +309,7 @@ public:
           zoomRange({zoom, zoom + 1}) {
     }
     void setPatternParameters(const optional<ImagePosition>&, const optional<ImagePosition>&, const CrossfadeParameters&) override {};
-    void populateVertexVector(const GeometryTileFeature& feature, std::size_t length, const ImagePositions&, const optional<PatternDependency>&, const style::expression::Value& formattedSection) override {
+    void populateVertexVector(const GeometryTileFeature& feature, std::size_t length, std::size_t index, const ImagePositions&, const optional<PatternDependency>&, const style::expression::Value& formattedSection) override {
         using style::expression::EvaluationContext;
         Range<T> range = {
                 expression.evaluate(EvaluationContext(zoomRange.min, &feature).withFormattedSection(&formattedSection), defaultValue),
@@ -256,13 +320,59 @@ public:
         AttributeValue value = zoomInterpolatedAttributeValue(
             attributeValue(range.min),
             attributeValue(range.max));
-        for (std::size_t i = vertexVector.elements(); i < length; ++i) {
+        const std::size_t start = vertexVector.elements();
+        for (std::size_t i = start; i < length; ++i) {
             vertexVector.emplace_back(Vertex { value });
         }
+        if (!expression.isStateConstant() && start < length) {
+            if (auto id = featureIDtoString(feature.getID())) {
+                featureMap[*id].push_back({ index, start, length, formattedSection });
+            }
+        }
+    }
+
+    bool updateVertexVector(const FeatureStates& states, const GeometryTileLayer& layer) override {
+        using style::expression::EvaluationContext;
+        bool updated = false;
+        for (const auto& state : states) {
+            auto it = featureMap.find(state.first);
+            if (it == featureMap.end()) {
+                continue;
+            }
+            for (const auto& featureRange : it->second) {
+                auto feature = layer.getFeature(featureRange.featureIndex);
+                Range<T> range = {
+                        expression.evaluate(EvaluationContext(zoomRange.min, feature.get())
+                                                .withFormattedSection(&featureRange.formattedSection)
+                                                .withFeatureState(&state.second), defaultValue),
+                        expression.evaluate(EvaluationContext(zoomRange.max, feature.get())
+                                                .withFormattedSection(&featureRange.formattedSection)
+                                                .withFeatureState(&state.second), defaultValue),
+                };
+                this->statistics.add(range.min);
+                this->statistics.add(range.max);
+                AttributeValue value = zoomInterpolatedAttributeValue(
+                    attributeValue(range.min),
+                    attributeValue(range.max));
+                for (std::size_t i = featureRange.start; i < featureRange.end; ++i) {
+                    vertexVector.at(i) = Vertex { value };
+                }
+                dirtyStart = std::min(dirtyStart, featureRange.start);
+                dirtyEnd = std::max(dirtyEnd, featureRange.end);
+                updated = true;
+            }
+        }
+        return updated;
     }
 
     void upload(gfx::UploadPass& uploadPass) override {
-        vertexBuffer = uploadPass.createVertexBuffer(std::move(vertexVector));
+        if (!vertexBuffer) {
+            vertexBuffer = uploadPass.createVertexBuffer(std::move(vertexVector));
+        } else if (dirtyStart < dirtyEnd) {
+            uploadPass.updateVertexBufferSub(*vertexBuffer, vertexVector, dirtyStart, dirtyEnd);
+        }
+        dirtyStart = std::numeric_limits<std::size_t>::max();
+        dirtyEnd = 0;
     }
 
     std::tuple<optional<gfx::AttributeBinding>> attributeBinding(const PossiblyEvaluatedPropertyValue<T>& currentValue) const override {
@@ -298,6 +408,9 @@ private:
     Range<float> zoomRange;
     gfx::VertexVector<Vertex> vertexVector;
     optional<gfx::VertexBuffer<Vertex>> vertexBuffer;
+    FeatureVertexRangeMap featureMap;
+    std::size_t dirtyStart = std::numeric_limits<std::size_t>::max();
+    std::size_t dirtyEnd = 0;
 };
 
 template <class T, class A1, class A2>
@@ -322,7 +435,7 @@ public:
         crossfade = crossfade_;
     };
 
-    void populateVertexVector(const GeometryTileFeature&, std::size_t length, const ImagePositions& patternPositions, const optional<PatternDependency>& patternDependencies, const style::expression::Value&) override {
+    void populateVertexVector(const GeometryTileFeature&, std::size_t length, std::size_t, const ImagePositions& patternPositions, const optional<PatternDependency>& patternDependencies, const style::expression::Value&) override {
     
         if (!patternDependencies || patternDependencies->mid.empty())  {
             // Unlike other propperties with expressions that evaluate to null, the default value for `*-pattern` properties is an empty
@@ -353,8 +466,11 @@ public:
         }
     }
 
+    // `*-pattern` properties don't support `feature-state`.
+    bool updateVertexVector(const FeatureStates&, const GeometryTileLayer&) override { return false; }
+
     void upload(gfx::UploadPass& uploadPass) override {
-        if (!patternToVertexVector.empty()) {
+        if (!patternToVertexBuffer && !patternToVertexVector.empty()) {
             assert(!zoomInVertexVector.empty());
             assert(!zoomOutVertexVector.empty());
             patternToVertexBuffer = uploadPass.createVertexBuffer(std::move(patternToVertexVector));
@@ -491,10 +607,18 @@ public:
     PaintPropertyBinders(PaintPropertyBinders&&) = default;
     PaintPropertyBinders(const PaintPropertyBinders&) = delete;
 
-    void populateVertexVectors(const GeometryTileFeature& feature, std::size_t length, const ImagePositions& patternPositions, const optional<PatternDependency>& patternDependencies, const style::expression::Value& formattedSection = {}) {
+    void populateVertexVectors(const GeometryTileFeature& feature, std::size_t length, std::size_t index, const ImagePositions& patternPositions, const optional<PatternDependency>& patternDependencies, const style::expression::Value& formattedSection = {}) {
+        util::ignore({
+            (binders.template get<Ps>()->populateVertexVector(feature, length, index, patternPositions, patternDependencies, formattedSection), 0)...
+        });
+    }
+
+    bool updateVertexVectors(const FeatureStates& states, const GeometryTileLayer& layer) {
+        bool updated = false;
         util::ignore({
-            (binders.template get<Ps>()->populateVertexVector(feature, length, patternPositions, patternDependencies, formattedSection), 0)...
+            (updated |= binders.template get<Ps>()->updateVertexVector(states, layer), 0)...
         });
+        return updated;
     }
 
     void setPatternParameters(const optional<ImagePosition>& posA, const optional<ImagePosition>& posB, const CrossfadeParameters& crossfade) const {
@@ -69,6 +69,10 @@ void RenderSource::onTileError(Tile& tile, std::exception_ptr error) {
     observer->onTileError(*this, tile.id, error);
 }
 
+void RenderSource::onTileLayout(Tile& tile, Duration parseTime, Duration layoutTime) {
+    observer->onTileLayout(*this, tile.id, parseTime, layoutTime);
+}
+
 bool RenderSource::isEnabled() const {
     return enabled;
 }
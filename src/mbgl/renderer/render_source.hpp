@@ -22,6 +22,7 @@ class TransformState;
 class RenderTile;
 class RenderLayer;
 class RenderedQueryOptions;
+class RenderedFeatureQuery;
 class SourceQueryOptions;
 class Tile;
 class RenderSourceObserver;
@@ -82,9 +83,29 @@ public:
                           const RenderedQueryOptions& options,
                           const mat4& projMatrix) const = 0;
 
+    // Adds what a query of the rendered features needs from this source to run on another thread.
+    virtual void prepareRenderedQuery(RenderedFeatureQuery&,
+                                      const ScreenLineString&,
+                                      const TransformState&,
+                                      const std::vector<const RenderLayer*>&,
+                                      const mat4&) const {}
+
     virtual std::vector<Feature>
     querySourceFeatures(const SourceQueryOptions&) const = 0;
 
+    // Feature state is only kept by sources with geometry tiles; other sources ignore it.
+    virtual void setFeatureState(const optional<std::string>&,
+                                 const std::string&,
+                                 const FeatureState&) {}
+
+    virtual void getFeatureState(FeatureState&,
+                                 const optional<std::string>&,
+                                 const std::string&) const {}
+
+    virtual void removeFeatureState(const optional<std::string>&,
+                                    const optional<std::string>&,
+                                    const optional<std::string>&) {}
+
     virtual FeatureExtensionValue
     queryFeatureExtensions(const Feature&,
                            const std::string&,
@@ -109,6 +130,7 @@ protected:
 
     void onTileChanged(Tile&) override;
     void onTileError(Tile&, std::exception_ptr) final;
+    void onTileLayout(Tile&, Duration parseTime, Duration layoutTime) final;
 };
 
 } // namespace mbgl
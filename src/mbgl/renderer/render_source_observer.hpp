@@ -1,5 +1,7 @@
 #pragma once
 
+#include <mbgl/util/chrono.hpp>
+
 #include <exception>
 
 namespace mbgl {
@@ -13,6 +15,7 @@ public:
 
     virtual void onTileChanged(RenderSource&, const OverscaledTileID&) {}
     virtual void onTileError(RenderSource&, const OverscaledTileID&, std::exception_ptr) {}
+    virtual void onTileLayout(RenderSource&, const OverscaledTileID&, Duration /* parseTime */, Duration /* layoutTime */) {}
 };
 
 } // namespace mbgl
@@ -0,0 +1,88 @@
+#include <mbgl/renderer/rendered_feature_query.hpp>
+#include <mbgl/renderer/render_layer.hpp>
+#include <mbgl/layermanager/layer_manager.hpp>
+#include <mbgl/text/placement.hpp>
+
+#include <iterator>
+#include <unordered_map>
+
+namespace mbgl {
+
+RenderedFeatureQuery::RenderedFeatureQuery(const TransformState& transformState_,
+                                           RenderedQueryOptions options_,
+                                           const std::vector<const RenderLayer*>& renderLayers)
+    : transformState(transformState_),
+      options(std::move(options_)) {
+    // Render layers keep changing on the render thread, but feature queries only depend on their
+    // evaluated properties, which are immutable.
+    for (const RenderLayer* renderLayer : renderLayers) {
+        if (renderLayer->baseImpl->getTypeInfo()->source != style::LayerTypeInfo::Source::Required) {
+            continue;
+        }
+        if (auto copy = LayerManager::get()->createRenderLayer(renderLayer->baseImpl)) {
+            copy->evaluatedProperties = renderLayer->evaluatedProperties;
+            layers.push_back(copy.get());
+            layerCopies.push_back(std::move(copy));
+        }
+    }
+}
+
+RenderedFeatureQuery::~RenderedFeatureQuery() = default;
+
+void RenderedFeatureQuery::addTile(std::shared_ptr<const FeatureIndex> featureIndex,
+                                   GeometryCoordinates queryGeometry,
+                                   const mat4& posMatrix,
+                                   double tileSize,
+                                   double scale,
+                                   const UnwrappedTileID& tileID,
+                                   float additionalQueryPadding) {
+    tiles.push_back({ std::move(featureIndex), std::move(queryGeometry), posMatrix, tileSize, scale, tileID, additionalQueryPadding });
+}
+
+void RenderedFeatureQuery::addSymbols(const RetainedQueryData& queryData, std::vector<IndexedSubfeature> features) {
+    symbols.push_back({ queryData.featureIndex, std::move(features), queryData.tileID, queryData.featureSortOrder });
+}
+
+void RenderedFeatureQuery::setLayerOrder(std::vector<std::string> layerOrder_) {
+    layerOrder = std::move(layerOrder_);
+}
+
+std::vector<Feature> RenderedFeatureQuery::run() const {
+    std::unordered_map<std::string, std::vector<Feature>> resultsByLayer;
+
+    for (const auto& tile : tiles) {
+        tile.featureIndex->query(resultsByLayer,
+                                 tile.queryGeometry,
+                                 transformState,
+                                 tile.posMatrix,
+                                 tile.tileSize,
+                                 tile.scale,
+                                 options,
+                                 tile.tileID,
+                                 layers,
+                                 tile.additionalQueryPadding);
+    }
+
+    for (const auto& symbol : symbols) {
+        auto bucketSymbols = symbol.featureIndex->lookupSymbolFeatures(symbol.features,
+                                                                       options,
+                                                                       layers,
+                                                                       symbol.tileID,
+                                                                       symbol.featureSortOrder);
+        for (auto& layer : bucketSymbols) {
+            auto& resultFeatures = resultsByLayer[layer.first];
+            std::move(layer.second.begin(), layer.second.end(), std::back_inserter(resultFeatures));
+        }
+    }
+
+    std::vector<Feature> result;
+    for (const auto& layerID : layerOrder) {
+        auto it = resultsByLayer.find(layerID);
+        if (it != resultsByLayer.end()) {
+            std::move(it->second.begin(), it->second.end(), std::back_inserter(result));
+        }
+    }
+    return result;
+}
+
+} // namespace mbgl
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <mbgl/renderer/query.hpp>
+#include <mbgl/geometry/feature_index.hpp>
+#include <mbgl/map/transform_state.hpp>
+#include <mbgl/tile/geometry_tile_data.hpp>
+#include <mbgl/tile/tile_id.hpp>
+#include <mbgl/util/feature.hpp>
+#include <mbgl/util/mat4.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace mbgl {
+
+class RenderLayer;
+struct RetainedQueryData;
+
+// A query of the rendered features that can run on another thread. It is prepared on the render
+// thread, which captures the feature indexes of the tiles and the symbols it hits, along with
+// copies of the layers' evaluated properties; none of these change after it is made.
+class RenderedFeatureQuery {
+public:
+    RenderedFeatureQuery(const TransformState&, RenderedQueryOptions, const std::vector<const RenderLayer*>& layers);
+    ~RenderedFeatureQuery();
+
+    void addTile(std::shared_ptr<const FeatureIndex>,
+                 GeometryCoordinates queryGeometry,
+                 const mat4& posMatrix,
+                 double tileSize,
+                 double scale,
+                 const UnwrappedTileID&,
+                 float additionalQueryPadding);
+
+    void addSymbols(const RetainedQueryData&, std::vector<IndexedSubfeature>);
+
+    // The IDs of the layers in rendering order, of which the features are returned.
+    void setLayerOrder(std::vector<std::string>);
+
+    std::vector<Feature> run() const;
+
+private:
+    struct TileQuery {
+        std::shared_ptr<const FeatureIndex> featureIndex;
+        GeometryCoordinates queryGeometry;
+        mat4 posMatrix;
+        double tileSize;
+        double scale;
+        UnwrappedTileID tileID;
+        float additionalQueryPadding;
+    };
+
+    struct SymbolQuery {
+        std::shared_ptr<const FeatureIndex> featureIndex;
+        std::vector<IndexedSubfeature> features;
+        OverscaledTileID tileID;
+        std::shared_ptr<std::vector<size_t>> featureSortOrder;
+    };
+
+    const TransformState transformState;
+    const RenderedQueryOptions options;
+    std::vector<std::unique_ptr<RenderLayer>> layerCopies;
+    std::vector<const RenderLayer*> layers;
+    std::vector<TileQuery> tiles;
+    std::vector<SymbolQuery> symbols;
+    std::vector<std::string> layerOrder;
+};
+
+} // namespace mbgl
@@ -55,6 +55,28 @@ std::vector<Feature> Renderer::queryRenderedFeatures(const ScreenBox& box, const
     );
 }
 
+void Renderer::queryRenderedFeatures(const ScreenLineString& geometry, const RenderedQueryOptions& options, QueryCallback callback) {
+    impl->queryRenderedFeatures(geometry, options, std::move(callback));
+}
+
+void Renderer::queryRenderedFeatures(const ScreenCoordinate& point, const RenderedQueryOptions& options, QueryCallback callback) {
+    impl->queryRenderedFeatures({ point }, options, std::move(callback));
+}
+
+void Renderer::queryRenderedFeatures(const ScreenBox& box, const RenderedQueryOptions& options, QueryCallback callback) {
+    impl->queryRenderedFeatures(
+            {
+                    box.min,
+                    {box.max.x, box.min.y},
+                    box.max,
+                    {box.min.x, box.max.y},
+                    box.min
+            },
+            options,
+            std::move(callback)
+    );
+}
+
 AnnotationIDs Renderer::queryPointAnnotations(const ScreenBox& box) const {
     if (!LayerManager::annotationsEnabled) {
         return {};
@@ -107,6 +129,27 @@ FeatureExtensionValue Renderer::queryFeatureExtensions(const std::string& source
     return impl->queryFeatureExtensions(sourceID, feature, extension, extensionField, args);
 }
 
+void Renderer::setFeatureState(const std::string& sourceID,
+                               const optional<std::string>& sourceLayerID,
+                               const std::string& featureID,
+                               const FeatureState& state) {
+    impl->setFeatureState(sourceID, sourceLayerID, featureID, state);
+}
+
+void Renderer::getFeatureState(FeatureState& state,
+                               const std::string& sourceID,
+                               const optional<std::string>& sourceLayerID,
+                               const std::string& featureID) const {
+    impl->getFeatureState(state, sourceID, sourceLayerID, featureID);
+}
+
+void Renderer::removeFeatureState(const std::string& sourceID,
+                                  const optional<std::string>& sourceLayerID,
+                                  const optional<std::string>& featureID,
+                                  const optional<std::string>& stateKey) {
+    impl->removeFeatureState(sourceID, sourceLayerID, featureID, stateKey);
+}
+
 void Renderer::dumpDebugLogs() {
     impl->dumpDebugLogs();
 }
@@ -14,7 +14,11 @@
 #include <mbgl/renderer/render_tile.hpp>
 #include <mbgl/renderer/style_diff.hpp>
 #include <mbgl/renderer/query.hpp>
+#include <mbgl/renderer/rendered_feature_query.hpp>
 #include <mbgl/gfx/backend_scope.hpp>
+#include <mbgl/actor/actor.hpp>
+#include <mbgl/actor/mailbox.hpp>
+#include <mbgl/actor/scheduler.hpp>
 #include <mbgl/renderer/image_manager.hpp>
 #include <mbgl/gfx/renderer_backend.hpp>
 #include <mbgl/gfx/upload_pass.hpp>
@@ -40,6 +44,21 @@ static RendererObserver& nullObserver() {
     return observer;
 }
 
+// Runs asynchronous feature queries on a background thread.
+class RenderedQueryWorker {
+public:
+    RenderedQueryWorker(ActorRef<RenderedQueryWorker>, ActorRef<Renderer::Impl> renderer_)
+        : renderer(std::move(renderer_)) {
+    }
+
+    void query(uint64_t queryID, std::unique_ptr<RenderedFeatureQuery> query_) {
+        renderer.invoke(&Renderer::Impl::onRenderedFeatures, queryID, query_->run());
+    }
+
+private:
+    ActorRef<Renderer::Impl> renderer;
+};
+
 Renderer::Impl::Impl(gfx::RendererBackend& backend_,
                      float pixelRatio_,
                      const optional<std::string> programCacheDir_,
@@ -88,6 +107,14 @@ void Renderer::Impl::render(const UpdateParameters& updateParameters) {
     }
 
     assert(gfx::BackendScope::exists());
+    RenderingStats stats;
+    TimePoint phaseStart = Clock::now();
+    const auto finishPhase = [&phaseStart](Duration& phaseTime) {
+        const TimePoint phaseEnd = Clock::now();
+        phaseTime = phaseEnd - phaseStart;
+        phaseStart = phaseEnd;
+    };
+
     if (LayerManager::annotationsEnabled) {
         updateParameters.annotationManager.updateData();
     }
@@ -116,7 +143,8 @@ void Renderer::Impl::render(const UpdateParameters& updateParameters) {
         updateParameters.annotationManager,
         *imageManager,
         *glyphManager,
-        updateParameters.prefetchZoomDelta
+        updateParameters.prefetchZoomDelta,
+        backend.getContext().supportsInstancing
     };
 
     glyphManager->setURL(updateParameters.glyphURL);
@@ -158,6 +186,9 @@ void Renderer::Impl::render(const UpdateParameters& updateParameters) {
     imageManager->notifyIfMissingImageAdded();
     imageManager->setLoaded(updateParameters.spriteLoaded);
 
+    // Layer and source diffs don't capture reordering, so compare the style vectors themselves.
+    bool renderItemsChanged = layerImpls != updateParameters.layers || sourceImpls != updateParameters.sources;
+
     const LayerDifference layerDiff = diffLayers(layerImpls, updateParameters.layers);
     layerImpls = updateParameters.layers;
 
@@ -183,11 +214,13 @@ void Renderer::Impl::render(const UpdateParameters& updateParameters) {
     }
 
     // Update layers for class and zoom changes.
+    bool layersEvaluated = false;
     for (const auto& entry : renderLayers) {
         RenderLayer& layer = *entry.second;
         const bool layerAddedOrChanged = layerDiff.added.count(entry.first) || layerDiff.changed.count(entry.first);
         if (layerAddedOrChanged || zoomChanged || layer.hasTransition() || layer.hasCrossfade()) {
             layer.evaluate(evaluationParameters);
+            layersEvaluated = true;
         }
     }
 
@@ -212,72 +245,35 @@ void Renderer::Impl::render(const UpdateParameters& updateParameters) {
         staticData = std::make_unique<RenderStaticData>(backend.getContext(), pixelRatio, programCacheDir);
     }
 
-    Color backgroundColor;
+    // Zoom and paint property changes may turn layers on or off without changing the style.
+    if (!renderItemsChanged && (zoomChanged || layersEvaluated)) {
+        renderItemsChanged = hasLayerEligibilityChanged();
+    }
 
-    struct RenderItem {
-        RenderItem(RenderLayer& layer_, RenderSource* source_, uint32_t index_)
-            : layer(layer_), source(source_), index(index_) {}
-        std::reference_wrapper<RenderLayer> layer;
-        RenderSource* source;
-        uint32_t index;
-        bool operator<(const RenderItem& other) const { return index < other.index; }
-    };
+    if (renderItemsChanged) {
+        updateRenderItems(layerDiff);
+    }
+
+    Color backgroundColor;
+    if (solidBackgroundLayer) {
+        backgroundColor = solidBackgroundLayer->getSolidBackground().value_or(backgroundColor);
+    }
 
-    std::set<RenderItem> renderItems;
     std::vector<std::reference_wrapper<RenderLayer>> layersNeedPlacement;
-    auto renderItemsEmplaceHint = renderItems.begin();
 
-    // Update all sources and initialize renderItems.
-    staticData->has3D = false;
-    for (const auto& sourceImpl : *sourceImpls) {
-        RenderSource* source = renderSources.at(sourceImpl->id).get();
+    // Update all sources.
+    for (auto& entry : sourceRenderLayers) {
         std::vector<Immutable<LayerProperties>> filteredLayersForSource;
-        filteredLayersForSource.reserve(layerImpls->size());
-        bool sourceNeedsRendering = false;
-        bool sourceNeedsRelayout = false;       
-        
-        uint32_t index = 0u;
-        const auto begin = layerImpls->begin();
-        const auto end = layerImpls->end();
-        for (auto it = begin; it != end; ++it, ++index) {
-            const Immutable<Layer::Impl>& layerImpl = *it;
-            RenderLayer* layer = getRenderLayer(layerImpl->id);
-            const auto* layerInfo = layerImpl->getTypeInfo();
-            const bool layerNeedsRendering = layer->needsRendering();
-            const bool zoomFitsLayer = layer->supportsZoom(zoomHistory.lastZoom);
-            staticData->has3D = (staticData->has3D || layerInfo->pass3d == LayerTypeInfo::Pass3D::Required);
-
-            if (layerInfo->source != LayerTypeInfo::Source::NotRequired) {
-                if (layerImpl->source == sourceImpl->id) {
-                    sourceNeedsRelayout = (sourceNeedsRelayout || hasImageDiff || hasLayoutDifference(layerDiff, layerImpl->id));
-                    if (layerNeedsRendering) {
-                        filteredLayersForSource.push_back(layer->evaluatedProperties);
-                        if (zoomFitsLayer) {
-                            sourceNeedsRendering = true;
-                            renderItemsEmplaceHint = renderItems.emplace_hint(renderItemsEmplaceHint, *layer, source, index);
-                        }
-                    }
-                }
-                continue;
-            } 
-
-            // Handle layers without source.
-            if (layerNeedsRendering && zoomFitsLayer && sourceImpl.get() == sourceImpls->at(0).get()) {
-                if (!backend.contextIsShared() && layerImpl.get() == layerImpls->at(0).get()) {
-                    const auto& solidBackground = layer->getSolidBackground();
-                    if (solidBackground) {
-                        backgroundColor = *solidBackground;
-                        continue; // This layer is shown with background color, and it shall not be added to render items. 
-                    }
-                }
-                renderItemsEmplaceHint = renderItems.emplace_hint(renderItemsEmplaceHint, *layer, nullptr, index);
-            }
+        filteredLayersForSource.reserve(entry.layers.size());
+        for (const RenderLayer& layer : entry.layers) {
+            filteredLayersForSource.push_back(layer.evaluatedProperties);
         }
-        source->update(sourceImpl,
-                       filteredLayersForSource,
-                       sourceNeedsRendering,
-                       sourceNeedsRelayout,
-                       tileParameters);
+        entry.source.get().update(entry.impl,
+                                  filteredLayersForSource,
+                                  entry.needsRendering,
+                                  entry.needsRelayout || (hasImageDiff && entry.hasLayers),
+                                  tileParameters);
+        entry.needsRelayout = false;
     }
 
     const bool loaded = updateParameters.styleLoaded && isLoaded();
@@ -291,6 +287,8 @@ void Renderer::Impl::render(const UpdateParameters& updateParameters) {
 
     observer->onWillStartRenderingFrame();
 
+    finishPhase(stats.updateTime);
+
     TransformParameters transformParams(updateParameters.transformState);
 
     // Update all matrices and generate data that we should upload to the GPU.
@@ -311,6 +309,8 @@ void Renderer::Impl::render(const UpdateParameters& updateParameters) {
         }
     }
 
+    finishPhase(stats.prepareTime);
+
     {
         if (!isMapModeContinuous) {
             // TODO: Think about right way for symbol index to handle still rendering
@@ -350,10 +350,14 @@ void Renderer::Impl::render(const UpdateParameters& updateParameters) {
         }
     }
 
+    finishPhase(stats.placementTime);
+
     auto& context = backend.getContext();
 
     // Blocks execution until the renderable is available.
     backend.getDefaultRenderable().wait();
+    phaseStart = Clock::now();
+    const gfx::RenderingStats contextStatsBefore = context.getRenderingStats();
 
     PaintParameters parameters {
         context,
@@ -399,6 +403,22 @@ void Renderer::Impl::render(const UpdateParameters& updateParameters) {
         lineAtlas->upload(*uploadPass);
     }
 
+    finishPhase(stats.uploadTime);
+
+    // Indexed like renderItems; entries of layers that aren't drawn keep an empty ID.
+    std::vector<LayerRenderingStats> layerStats(renderItems.size());
+    const auto renderLayerWithStats = [&](RenderLayer& renderLayer, std::size_t itemIndex) {
+        LayerRenderingStats& entry = layerStats[itemIndex];
+        const std::size_t drawCallsBefore = context.getDrawCallCount();
+        const TimePoint layerStart = Clock::now();
+        renderLayer.render(parameters);
+        entry.renderTime += Clock::now() - layerStart;
+        entry.drawCalls += context.getDrawCallCount() - drawCallsBefore;
+        if (entry.layerID.empty()) {
+            entry.layerID = renderLayer.getID();
+        }
+    };
+
     // - 3D PASS -------------------------------------------------------------------------------------
     // Renders any 3D layers bottom-to-top to unique FBOs with texture attachments, but share the same
     // depth rbo between them.
@@ -421,7 +441,7 @@ void Renderer::Impl::render(const UpdateParameters& updateParameters) {
             RenderLayer& renderLayer = it->layer;
             if (renderLayer.hasRenderPass(parameters.pass)) {
                 const auto layerDebugGroup(parameters.encoder->createDebugGroup(renderLayer.getID().c_str()));
-                renderLayer.render(parameters);
+                renderLayerWithStats(renderLayer, renderItems.size() - 1 - i);
             }
         }
     }
@@ -455,7 +475,7 @@ void Renderer::Impl::render(const UpdateParameters& updateParameters) {
             RenderLayer& renderLayer = it->layer;
             if (renderLayer.hasRenderPass(parameters.pass)) {
                 const auto layerDebugGroup(parameters.renderPass->createDebugGroup(renderLayer.getID().c_str()));
-                renderLayer.render(parameters);
+                renderLayerWithStats(renderLayer, renderItems.size() - 1 - i);
             }
         }
     }
@@ -472,7 +492,7 @@ void Renderer::Impl::render(const UpdateParameters& updateParameters) {
             RenderLayer& renderLayer = it->layer;
             if (renderLayer.hasRenderPass(parameters.pass)) {
                 const auto layerDebugGroup(parameters.renderPass->createDebugGroup(renderLayer.getID().c_str()));
-                renderLayer.render(parameters);
+                renderLayerWithStats(renderLayer, renderItems.size() - 1 - i);
             }
         }
     }
@@ -503,6 +523,30 @@ void Renderer::Impl::render(const UpdateParameters& updateParameters) {
     }
 #endif
 
+    finishPhase(stats.drawTime);
+
+    const gfx::RenderingStats contextStats = context.getRenderingStats() - contextStatsBefore;
+    stats.drawCalls = contextStats.numDrawCalls;
+    stats.stateChanges = contextStats.numStateChanges;
+    stats.redundantStateChanges = contextStats.numRedundantStateChanges;
+    stats.bufferUploadBytes = contextStats.bufferUploadBytes;
+    stats.textureUploadBytes = contextStats.textureUploadBytes;
+
+    for (auto& entry : layerStats) {
+        if (!entry.layerID.empty()) {
+            stats.layers.push_back(std::move(entry));
+        }
+    }
+
+    stats.tileLayouts = tileLayouts;
+    stats.tileParseTime = tileParseTime;
+    stats.tileLayoutTime = tileLayoutTime;
+    tileLayouts = 0;
+    tileParseTime = Duration::zero();
+    tileLayoutTime = Duration::zero();
+
+    observer->onRenderingStats(stats);
+
     const bool needsRepaint = isMapModeContinuous && hasTransitions(parameters.timePoint);
     observer->onDidFinishRenderingFrame(
         loaded ? RendererObserver::RenderMode::Full : RendererObserver::RenderMode::Partial,
@@ -527,7 +571,7 @@ void Renderer::Impl::render(const UpdateParameters& updateParameters) {
     // CommandEncoder destructor submits render commands.
 }
 
-std::vector<Feature> Renderer::Impl::queryRenderedFeatures(const ScreenLineString& geometry, const RenderedQueryOptions& options) const {
+std::vector<const RenderLayer*> Renderer::Impl::getQueryLayers(const RenderedQueryOptions& options) const {
     std::vector<const RenderLayer*> layers;
     if (options.layerIDs) {
         for (const auto& layerID : *options.layerIDs) {
@@ -540,18 +584,81 @@ std::vector<Feature> Renderer::Impl::queryRenderedFeatures(const ScreenLineStrin
             layers.emplace_back(entry.second.get());
         }
     }
+    return layers;
+}
 
-    return queryRenderedFeatures(geometry, options, layers);
+std::vector<Feature> Renderer::Impl::queryRenderedFeatures(const ScreenLineString& geometry, const RenderedQueryOptions& options) const {
+    return queryRenderedFeatures(geometry, options, getQueryLayers(options));
 }
-    
-void Renderer::Impl::queryRenderedSymbols(std::unordered_map<std::string, std::vector<Feature>>& resultsByLayer,
-                                          const ScreenLineString& geometry,
-                                          const std::vector<const RenderLayer*>& layers,
-                                          const RenderedQueryOptions& options) const {
-    
+
+void Renderer::Impl::queryRenderedFeatures(const ScreenLineString& geometry,
+                                           const RenderedQueryOptions& options,
+                                           std::function<void (std::vector<Feature>)> callback) {
+    const std::vector<const RenderLayer*> layers = getQueryLayers(options);
+    auto query = std::make_unique<RenderedFeatureQuery>(transformState, options, layers);
+
+    // Only look up which tiles and symbols the geometry hits here. Reading the features from the
+    // tile data, which takes most of the time, is left to the query.
+    std::unordered_set<std::string> sourceIDs;
+    for (const RenderLayer* layer : layers) {
+        sourceIDs.emplace(layer->baseImpl->source);
+    }
+
+    mat4 projMatrix;
+    transformState.getProjMatrix(projMatrix);
+
+    for (const auto& sourceID : sourceIDs) {
+        if (RenderSource* renderSource = getRenderSource(sourceID)) {
+            renderSource->prepareRenderedQuery(*query, geometry, transformState, layers, projMatrix);
+        }
+    }
+
     auto renderedSymbols = placement->getCollisionIndex().queryRenderedSymbols(geometry);
+    for (const RetainedQueryData& queryData : getSymbolQueryData(renderedSymbols)) {
+        query->addSymbols(queryData, std::move(renderedSymbols[queryData.bucketInstanceId]));
+    }
+
+    std::vector<std::string> layerOrder;
+    for (const auto& layerImpl : *layerImpls) {
+        const RenderLayer* layer = getRenderLayer(layerImpl->id);
+        if (layer->needsRendering() && layer->supportsZoom(zoomHistory.lastZoom)) {
+            layerOrder.push_back(layerImpl->id);
+        }
+    }
+    query->setLayerOrder(std::move(layerOrder));
+
+    // Without a scheduler on this thread there is no way to receive the result; query in place.
+    if (!Scheduler::GetCurrent()) {
+        callback(query->run());
+        return;
+    }
+
+    if (!queryWorker) {
+        queryMailbox = std::make_shared<Mailbox>(*Scheduler::GetCurrent());
+        queryWorker = std::make_unique<Actor<RenderedQueryWorker>>(
+            Scheduler::GetBackground(), ActorRef<Renderer::Impl>(*this, queryMailbox));
+    }
+
+    const uint64_t queryID = nextQueryID++;
+    pendingQueries.emplace(queryID, std::move(callback));
+    queryWorker->self().invoke(&RenderedQueryWorker::query, queryID, std::move(query));
+}
+
+void Renderer::Impl::onRenderedFeatures(uint64_t queryID, std::vector<Feature> features) {
+    auto it = pendingQueries.find(queryID);
+    if (it == pendingQueries.end()) {
+        return;
+    }
+
+    auto callback = std::move(it->second);
+    pendingQueries.erase(it);
+    callback(std::move(features));
+}
+
+std::vector<std::reference_wrapper<const RetainedQueryData>>
+Renderer::Impl::getSymbolQueryData(const std::unordered_map<uint32_t, std::vector<IndexedSubfeature>>& renderedSymbols) const {
     std::vector<std::reference_wrapper<const RetainedQueryData>> bucketQueryData;
-    for (auto entry : renderedSymbols) {
+    for (const auto& entry : renderedSymbols) {
         bucketQueryData.emplace_back(placement->getQueryData(entry.first));
     }
     // Although symbol query is global, symbol results are only sortable within a bucket
@@ -561,8 +668,16 @@ void Renderer::Impl::queryRenderedSymbols(std::unordered_map<std::string, std::v
             std::tie(a.tileID.canonical.z, a.tileID.canonical.y, a.tileID.wrap, a.tileID.canonical.x) <
             std::tie(b.tileID.canonical.z, b.tileID.canonical.y, b.tileID.wrap, b.tileID.canonical.x);
     });
+    return bucketQueryData;
+}
+
+void Renderer::Impl::queryRenderedSymbols(std::unordered_map<std::string, std::vector<Feature>>& resultsByLayer,
+                                          const ScreenLineString& geometry,
+                                          const std::vector<const RenderLayer*>& layers,
+                                          const RenderedQueryOptions& options) const {
     
-    for (auto wrappedQueryData : bucketQueryData) {
+    auto renderedSymbols = placement->getCollisionIndex().queryRenderedSymbols(geometry);
+    for (auto wrappedQueryData : getSymbolQueryData(renderedSymbols)) {
         auto& queryData = wrappedQueryData.get();
         auto bucketSymbols = queryData.featureIndex->lookupSymbolFeatures(renderedSymbols[queryData.bucketInstanceId],
                                                                           options,
@@ -652,6 +767,35 @@ FeatureExtensionValue Renderer::Impl::queryFeatureExtensions(const std::string&
     return {};
 }
 
+void Renderer::Impl::setFeatureState(const std::string& sourceID,
+                                     const optional<std::string>& sourceLayerID,
+                                     const std::string& featureID,
+                                     const FeatureState& state) {
+    if (RenderSource* renderSource = getRenderSource(sourceID)) {
+        renderSource->setFeatureState(sourceLayerID, featureID, state);
+        observer->onInvalidate();
+    }
+}
+
+void Renderer::Impl::getFeatureState(FeatureState& state,
+                                     const std::string& sourceID,
+                                     const optional<std::string>& sourceLayerID,
+                                     const std::string& featureID) const {
+    if (RenderSource* renderSource = getRenderSource(sourceID)) {
+        renderSource->getFeatureState(state, sourceLayerID, featureID);
+    }
+}
+
+void Renderer::Impl::removeFeatureState(const std::string& sourceID,
+                                        const optional<std::string>& sourceLayerID,
+                                        const optional<std::string>& featureID,
+                                        const optional<std::string>& stateKey) {
+    if (RenderSource* renderSource = getRenderSource(sourceID)) {
+        renderSource->removeFeatureState(sourceLayerID, featureID, stateKey);
+        observer->onInvalidate();
+    }
+}
+
 void Renderer::Impl::reduceMemoryUse() {
     assert(gfx::BackendScope::exists());
     for (const auto& entry : renderSources) {
@@ -707,6 +851,90 @@ bool Renderer::Impl::hasTransitions(TimePoint timePoint) const {
     return false;
 }
 
+Renderer::Impl::LayerEligibility Renderer::Impl::getLayerEligibility(const RenderLayer& layer, bool isBottomLayer) const {
+    LayerEligibility eligibility;
+    eligibility.needsRendering = layer.needsRendering();
+    eligibility.supportsZoom = layer.supportsZoom(zoomHistory.lastZoom);
+    // The bottom layer may be drawn with the clear color instead of being rendered.
+    eligibility.solidBackground = isBottomLayer && !backend.contextIsShared() && bool(layer.getSolidBackground());
+    return eligibility;
+}
+
+bool Renderer::Impl::hasLayerEligibilityChanged() const {
+    assert(orderedRenderLayers.size() == layerEligibility.size());
+    for (std::size_t i = 0; i < orderedRenderLayers.size(); ++i) {
+        if (getLayerEligibility(orderedRenderLayers[i], i == 0) != layerEligibility[i]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void Renderer::Impl::updateRenderItems(const LayerDifference& layerDiff) {
+    renderItems.clear();
+    sourceRenderLayers.clear();
+    orderedRenderLayers.clear();
+    layerEligibility.clear();
+    solidBackgroundLayer = nullptr;
+    staticData->has3D = false;
+
+    orderedRenderLayers.reserve(layerImpls->size());
+    layerEligibility.reserve(layerImpls->size());
+    for (const auto& layerImpl : *layerImpls) {
+        RenderLayer* layer = getRenderLayer(layerImpl->id);
+        assert(layer);
+        layerEligibility.push_back(getLayerEligibility(*layer, orderedRenderLayers.empty()));
+        orderedRenderLayers.emplace_back(*layer);
+    }
+
+    // Layers are only rendered if the style has at least one source.
+    if (sourceImpls->empty()) {
+        return;
+    }
+
+    std::unordered_map<std::string, std::size_t> sourceIndices;
+    sourceRenderLayers.reserve(sourceImpls->size());
+    for (const auto& sourceImpl : *sourceImpls) {
+        sourceIndices.emplace(sourceImpl->id, sourceRenderLayers.size());
+        sourceRenderLayers.emplace_back(*renderSources.at(sourceImpl->id), sourceImpl);
+    }
+
+    for (uint32_t index = 0u; index < layerImpls->size(); ++index) {
+        const Immutable<Layer::Impl>& layerImpl = layerImpls->at(index);
+        RenderLayer& layer = orderedRenderLayers[index];
+        const LayerEligibility& eligibility = layerEligibility[index];
+        const auto* layerInfo = layerImpl->getTypeInfo();
+        staticData->has3D = (staticData->has3D || layerInfo->pass3d == LayerTypeInfo::Pass3D::Required);
+
+        if (layerInfo->source != LayerTypeInfo::Source::NotRequired) {
+            auto it = sourceIndices.find(layerImpl->source);
+            if (it != sourceIndices.end()) {
+                SourceRenderLayers& source = sourceRenderLayers[it->second];
+                source.hasLayers = true;
+                source.needsRelayout = source.needsRelayout || hasLayoutDifference(layerDiff, layerImpl->id);
+                if (eligibility.needsRendering) {
+                    source.layers.emplace_back(layer);
+                    if (eligibility.supportsZoom) {
+                        source.needsRendering = true;
+                        renderItems.emplace_back(layer, &source.source.get(), index);
+                    }
+                }
+            }
+            continue;
+        }
+
+        // Handle layers without source.
+        if (eligibility.needsRendering && eligibility.supportsZoom) {
+            if (eligibility.solidBackground) {
+                // This layer is shown with background color, and it shall not be added to render items.
+                solidBackgroundLayer = &layer;
+                continue;
+            }
+            renderItems.emplace_back(layer, nullptr, index);
+        }
+    }
+}
+
 void Renderer::Impl::updateFadingTiles() {
     fadingTiles = false;
     for (auto& source : renderSources) {
@@ -750,6 +978,12 @@ void Renderer::Impl::onTileChanged(RenderSource&, const OverscaledTileID&) {
     observer->onInvalidate();
 }
 
+void Renderer::Impl::onTileLayout(RenderSource&, const OverscaledTileID&, Duration parseTime, Duration layoutTime) {
+    tileLayouts++;
+    tileParseTime += parseTime;
+    tileLayoutTime += layoutTime;
+}
+
 void Renderer::Impl::onStyleImageMissing(const std::string& id, std::function<void()> done) {
     observer->onStyleImageMissing(id, std::move(done));
 }
@@ -3,6 +3,7 @@
 #include <mbgl/renderer/renderer.hpp>
 #include <mbgl/renderer/render_source_observer.hpp>
 #include <mbgl/renderer/render_light.hpp>
+#include <mbgl/renderer/style_diff.hpp>
 #include <mbgl/style/image.hpp>
 #include <mbgl/style/source.hpp>
 #include <mbgl/style/layer.hpp>
@@ -13,12 +14,18 @@
 #include <mbgl/renderer/image_manager_observer.hpp>
 #include <mbgl/text/placement.hpp>
 
+#include <functional>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace mbgl {
 
+class Mailbox;
+template <class> class Actor;
+class RenderedQueryWorker;
+
 class RendererObserver;
 class RenderSource;
 class RenderLayer;
@@ -54,6 +61,7 @@ public:
     void render(const UpdateParameters&);
 
     std::vector<Feature> queryRenderedFeatures(const ScreenLineString&, const RenderedQueryOptions&) const;
+    void queryRenderedFeatures(const ScreenLineString&, const RenderedQueryOptions&, std::function<void (std::vector<Feature>)>);
     std::vector<Feature> querySourceFeatures(const std::string& sourceID, const SourceQueryOptions&) const;
     std::vector<Feature> queryShapeAnnotations(const ScreenLineString&) const;
 
@@ -63,9 +71,27 @@ public:
                                                  const std::string& extensionField,
                                                  const optional<std::map<std::string, Value>>& args) const;
 
+    void setFeatureState(const std::string& sourceID,
+                         const optional<std::string>& sourceLayerID,
+                         const std::string& featureID,
+                         const FeatureState& state);
+
+    void getFeatureState(FeatureState& state,
+                         const std::string& sourceID,
+                         const optional<std::string>& sourceLayerID,
+                         const std::string& featureID) const;
+
+    void removeFeatureState(const std::string& sourceID,
+                            const optional<std::string>& sourceLayerID,
+                            const optional<std::string>& featureID,
+                            const optional<std::string>& stateKey);
+
     void reduceMemoryUse();
     void dumpDebugLogs();
 
+    // Invoked by RenderedQueryWorker
+    void onRenderedFeatures(uint64_t queryID, std::vector<Feature>);
+
 private:
     bool isLoaded() const;
     bool hasTransitions(TimePoint) const;
@@ -74,6 +100,10 @@ private:
 
           RenderLayer* getRenderLayer(const std::string& id);
     const RenderLayer* getRenderLayer(const std::string& id) const;
+
+    std::vector<const RenderLayer*> getQueryLayers(const RenderedQueryOptions&) const;
+    std::vector<std::reference_wrapper<const RetainedQueryData>>
+    getSymbolQueryData(const std::unordered_map<uint32_t, std::vector<IndexedSubfeature>>& renderedSymbols) const;
               
     void queryRenderedSymbols(std::unordered_map<std::string, std::vector<Feature>>& resultsByLayer,
                               const ScreenLineString& geometry,
@@ -88,6 +118,7 @@ private:
     // RenderSourceObserver implementation.
     void onTileChanged(RenderSource&, const OverscaledTileID&) override;
     void onTileError(RenderSource&, const OverscaledTileID&, std::exception_ptr) override;
+    void onTileLayout(RenderSource&, const OverscaledTileID&, Duration parseTime, Duration layoutTime) override;
 
     // ImageManagerObserver implementation
     void onStyleImageMissing(const std::string&, std::function<void()>) override;
@@ -95,6 +126,26 @@ private:
 
     void updateFadingTiles();
 
+    class LayerEligibility {
+    public:
+        bool needsRendering = false;
+        bool supportsZoom = false;
+        bool solidBackground = false;
+
+        bool operator!=(const LayerEligibility& other) const {
+            return needsRendering != other.needsRendering ||
+                   supportsZoom != other.supportsZoom ||
+                   solidBackground != other.solidBackground;
+        }
+    };
+
+    LayerEligibility getLayerEligibility(const RenderLayer&, bool isBottomLayer) const;
+    bool hasLayerEligibilityChanged() const;
+
+    // Rebuilds the retained render items and per-source layer lists. Must be called whenever
+    // the style layers or sources change, or a layer becomes (in)eligible for rendering.
+    void updateRenderItems(const LayerDifference&);
+
     friend class Renderer;
 
     gfx::RendererBackend& backend;
@@ -128,11 +179,51 @@ private:
     std::unordered_map<std::string, std::unique_ptr<RenderLayer>> renderLayers;
     RenderLight renderLight;
 
+    class RenderItem {
+    public:
+        RenderItem(RenderLayer& layer_, RenderSource* source_, uint32_t index_)
+            : layer(layer_), source(source_), index(index_) {}
+        std::reference_wrapper<RenderLayer> layer;
+        RenderSource* source;
+        uint32_t index;
+    };
+
+    class SourceRenderLayers {
+    public:
+        SourceRenderLayers(RenderSource& source_, Immutable<style::Source::Impl> impl_)
+            : source(source_), impl(std::move(impl_)) {}
+        std::reference_wrapper<RenderSource> source;
+        Immutable<style::Source::Impl> impl;
+        // Layers using this source that can be rendered at some zoom level.
+        std::vector<std::reference_wrapper<RenderLayer>> layers;
+        bool hasLayers = false;
+        bool needsRendering = false;
+        bool needsRelayout = false;
+    };
+
+    // Render items sorted by style layer index, retained across frames.
+    std::vector<RenderItem> renderItems;
+    std::vector<SourceRenderLayers> sourceRenderLayers;
+    std::vector<std::reference_wrapper<RenderLayer>> orderedRenderLayers;
+    std::vector<LayerEligibility> layerEligibility;
+    RenderLayer* solidBackgroundLayer = nullptr;
+
     CrossTileSymbolIndex crossTileSymbolIndex;
     std::unique_ptr<Placement> placement;
 
     bool contextLost = false;
     bool fadingTiles = false;
+
+    // Tile worker results received since the last frame.
+    std::size_t tileLayouts = 0;
+    Duration tileParseTime = Duration::zero();
+    Duration tileLayoutTime = Duration::zero();
+
+    // Asynchronous feature queries that haven't finished yet.
+    std::unordered_map<uint64_t, std::function<void (std::vector<Feature>)>> pendingQueries;
+    uint64_t nextQueryID = 0;
+    std::shared_ptr<Mailbox> queryMailbox;
+    std::unique_ptr<Actor<RenderedQueryWorker>> queryWorker;
 };
 
 } // namespace mbgl
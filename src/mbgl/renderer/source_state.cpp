@@ -0,0 +1,99 @@
+#include <mbgl/renderer/source_state.hpp>
+#include <mbgl/tile/tile.hpp>
+
+#include <vector>
+
+namespace mbgl {
+
+void SourceFeatureState::updateState(const optional<std::string>& sourceLayerID, const std::string& featureID, const FeatureState& newState) {
+    FeatureState state;
+    getState(state, sourceLayerID, featureID);
+    for (const auto& entry : newState) {
+        state[entry.first] = entry.second;
+    }
+    stateChanges[sourceLayerID.value_or(std::string())][featureID] = std::move(state);
+}
+
+void SourceFeatureState::getState(FeatureState& result, const optional<std::string>& sourceLayerID, const std::string& featureID) const {
+    const std::string sourceLayer = sourceLayerID.value_or(std::string());
+
+    // Pending changes hold the complete new state of a feature.
+    for (const auto* states : { &stateChanges, &currentStates }) {
+        const auto layerStates = states->find(sourceLayer);
+        if (layerStates == states->end()) {
+            continue;
+        }
+        const auto state = layerStates->second.find(featureID);
+        if (state != layerStates->second.end()) {
+            result = state->second;
+            return;
+        }
+    }
+
+    result = {};
+}
+
+void SourceFeatureState::removeState(const optional<std::string>& sourceLayerID, const optional<std::string>& featureID, const optional<std::string>& stateKey) {
+    const std::string sourceLayer = sourceLayerID.value_or(std::string());
+
+    // Removed state is recorded as a shrunk or empty state instead of being erased, so that the
+    // vertices of the affected features are evaluated again without it.
+    auto removeFeatureState = [&] (const std::string& id) {
+        FeatureState state;
+        getState(state, sourceLayerID, id);
+        if (stateKey) {
+            state.erase(*stateKey);
+        } else {
+            state.clear();
+        }
+        stateChanges[sourceLayer][id] = std::move(state);
+    };
+
+    if (featureID) {
+        removeFeatureState(*featureID);
+    } else if (!stateKey) {
+        std::vector<std::string> ids;
+        for (const auto* states : { &currentStates, &stateChanges }) {
+            const auto layerStates = states->find(sourceLayer);
+            if (layerStates != states->end()) {
+                for (const auto& state : layerStates->second) {
+                    ids.push_back(state.first);
+                }
+            }
+        }
+        for (const auto& id : ids) {
+            removeFeatureState(id);
+        }
+    }
+}
+
+void SourceFeatureState::coalesceChanges(const std::map<OverscaledTileID, std::unique_ptr<Tile>>& tiles) {
+    const bool changed = !stateChanges.empty();
+    if (changed) {
+        for (const auto& layerStates : stateChanges) {
+            for (const auto& state : layerStates.second) {
+                currentStates[layerStates.first][state.first] = state.second;
+            }
+        }
+        version++;
+    }
+
+    if (version > 0) {
+        for (const auto& entry : tiles) {
+            Tile& tile = *entry.second;
+            if (tile.featureStateVersion == version) {
+                continue;
+            }
+            // Tiles that saw all previous changes only need the latest ones. Tiles that weren't
+            // around when the version was bumped missed changes and need the complete state.
+            const bool upToDate = changed && tile.featureStateVersion != 0 &&
+                                  tile.featureStateVersion + 1 == version;
+            tile.setFeatureState(upToDate ? stateChanges : currentStates);
+            tile.featureStateVersion = version;
+        }
+    }
+
+    stateChanges.clear();
+}
+
+} // namespace mbgl
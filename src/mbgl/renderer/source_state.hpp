@@ -0,0 +1,36 @@
+#pragma once
+
+#include <mbgl/util/feature.hpp>
+
+#include <map>
+#include <memory>
+#include <string>
+
+namespace mbgl {
+
+class OverscaledTileID;
+class Tile;
+
+// Holds the state of the features of one source, keyed by source layer and feature ID. State
+// changes are collected until the next frame, and are then applied to the tiles of the source
+// at once. Tiles that saw all previous changes only get the new ones; other tiles, e.g. new
+// tiles, get the complete state.
+class SourceFeatureState {
+public:
+    void updateState(const optional<std::string>& sourceLayerID, const std::string& featureID, const FeatureState& newState);
+    void getState(FeatureState& result, const optional<std::string>& sourceLayerID, const std::string& featureID) const;
+    // Removes a single key of the state of a feature, the whole state of a feature, or the
+    // state of all features in the source layer, depending on the arguments given. A state key
+    // without a feature ID is ignored.
+    void removeState(const optional<std::string>& sourceLayerID, const optional<std::string>& featureID, const optional<std::string>& stateKey);
+
+    // Applies the changes made since the last call to the given tiles.
+    void coalesceChanges(const std::map<OverscaledTileID, std::unique_ptr<Tile>>& tiles);
+
+private:
+    LayerFeatureStates currentStates;
+    LayerFeatureStates stateChanges;
+    uint64_t version = 0;
+};
+
+} // namespace mbgl
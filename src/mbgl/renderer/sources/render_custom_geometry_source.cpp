@@ -72,10 +72,36 @@ RenderCustomGeometrySource::queryRenderedFeatures(const ScreenLineString& geomet
    return tilePyramid.queryRenderedFeatures(geometry, transformState, layers, options, projMatrix);
 }
 
+void RenderCustomGeometrySource::prepareRenderedQuery(RenderedFeatureQuery& query,
+                                                      const ScreenLineString& geometry,
+                                                      const TransformState& transformState,
+                                                      const std::vector<const RenderLayer*>& layers,
+                                                      const mat4& projMatrix) const {
+    tilePyramid.prepareRenderedQuery(query, geometry, transformState, layers, projMatrix);
+}
+
 std::vector<Feature> RenderCustomGeometrySource::querySourceFeatures(const SourceQueryOptions& options) const {
     return tilePyramid.querySourceFeatures(options);
 }
 
+void RenderCustomGeometrySource::setFeatureState(const optional<std::string>& sourceLayerID,
+                                                 const std::string& featureID,
+                                                 const FeatureState& state) {
+    tilePyramid.setFeatureState(sourceLayerID, featureID, state);
+}
+
+void RenderCustomGeometrySource::getFeatureState(FeatureState& state,
+                                                 const optional<std::string>& sourceLayerID,
+                                                 const std::string& featureID) const {
+    tilePyramid.getFeatureState(state, sourceLayerID, featureID);
+}
+
+void RenderCustomGeometrySource::removeFeatureState(const optional<std::string>& sourceLayerID,
+                                                    const optional<std::string>& featureID,
+                                                    const optional<std::string>& stateKey) {
+    tilePyramid.removeFeatureState(sourceLayerID, featureID, stateKey);
+}
+
 void RenderCustomGeometrySource::reduceMemoryUse() {
     tilePyramid.reduceMemoryUse();
 }
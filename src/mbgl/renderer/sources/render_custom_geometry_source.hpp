@@ -31,9 +31,27 @@ public:
                           const RenderedQueryOptions& options,
                           const mat4& projMatrix) const final;
 
+    void prepareRenderedQuery(RenderedFeatureQuery&,
+                              const ScreenLineString& geometry,
+                              const TransformState& transformState,
+                              const std::vector<const RenderLayer*>& layers,
+                              const mat4& projMatrix) const final;
+
     std::vector<Feature>
     querySourceFeatures(const SourceQueryOptions&) const final;
 
+    void setFeatureState(const optional<std::string>& sourceLayerID,
+                         const std::string& featureID,
+                         const FeatureState&) final;
+
+    void getFeatureState(FeatureState&,
+                         const optional<std::string>& sourceLayerID,
+                         const std::string& featureID) const final;
+
+    void removeFeatureState(const optional<std::string>& sourceLayerID,
+                            const optional<std::string>& featureID,
+                            const optional<std::string>& stateKey) final;
+
     void reduceMemoryUse() final;
     void dumpDebugLogs() const final;
     
@@ -3,9 +3,14 @@
 #include <mbgl/renderer/paint_parameters.hpp>
 #include <mbgl/tile/geojson_tile.hpp>
 #include <mbgl/renderer/tile_parameters.hpp>
+#include <mbgl/actor/actor.hpp>
+#include <mbgl/actor/scheduler.hpp>
+#include <mbgl/util/constants.hpp>
 
 #include <mapbox/eternal.hpp>
 
+#include <algorithm>
+
 namespace mbgl {
 
 using namespace style;
@@ -77,6 +82,11 @@ const style::GeoJSONSource::Impl& RenderGeoJSONSource::impl() const {
 }
 
 bool RenderGeoJSONSource::isLoaded() const {
+    for (const auto& pair : tilePyramid.getTiles()) {
+        if (static_cast<const GeoJSONTile*>(pair.second.get())->isSlicing()) {
+            return false;
+        }
+    }
     return tilePyramid.isLoaded();
 }
 
@@ -91,15 +101,38 @@ void RenderGeoJSONSource::update(Immutable<style::Source::Impl> baseImpl_,
 
     auto data_ = impl().getData().lock();
 
-    if (data.lock() != data_) {
+    auto previousData = data.lock();
+    if (previousData != data_) {
         data = data_;
         tilePyramid.reduceMemoryUse();
 
+        // Tiles are sliced from the data off the render thread. Destroying the slicer would wait
+        // for the slice it is working on, so it is handed the new data instead. Slices of the
+        // previous data that are still queued are ignored by their tiles.
+        if (slicer) {
+            slicer->self().invoke(&GeoJSONTileSlicer::setData, data_);
+        } else if (data_) {
+            slicer = std::make_unique<Actor<GeoJSONTileSlicer>>(Scheduler::GetBackground(), data_);
+        }
+
         if (data_) {
+            // When only some features changed, only the tiles they touch are sliced again.
+            const auto changes = previousData ? data_->getChangesSince(previousData->version) : nullopt;
+
             const uint8_t maxZ = impl().getZoomRange().max;
+            const double buffer = double(impl().getOptions().buffer) / util::tileSize;
             for (const auto& pair : tilePyramid.getTiles()) {
-                if (pair.first.canonical.z <= maxZ) {
-                    static_cast<GeoJSONTile*>(pair.second.get())->updateData(data_->getTile(pair.first.canonical));
+                if (pair.first.canonical.z > maxZ) {
+                    continue;
+                }
+
+                // Tiles still waiting for a slice of the previous data need a new one as well.
+                auto& tile = static_cast<GeoJSONTile&>(*pair.second);
+                if (!changes || tile.isSlicing() ||
+                    std::any_of(changes->begin(), changes->end(), [&] (const GeoJSONData::Bounds& area) {
+                        return GeoJSONData::touchesTile(area, pair.first.canonical, buffer);
+                    })) {
+                    tile.updateData(slicer->self());
                 }
             }
         }
@@ -118,8 +151,8 @@ void RenderGeoJSONSource::update(Immutable<style::Source::Impl> baseImpl_,
                        util::tileSize,
                        impl().getZoomRange(),
                        optional<LatLngBounds>{},
-                       [&, data_] (const OverscaledTileID& tileID) {
-                           return std::make_unique<GeoJSONTile>(tileID, impl().id, parameters, data_->getTile(tileID.canonical));
+                       [&] (const OverscaledTileID& tileID) {
+                           return std::make_unique<GeoJSONTile>(tileID, impl().id, parameters, slicer->self());
                        });
 }
 
@@ -148,10 +181,36 @@ RenderGeoJSONSource::queryRenderedFeatures(const ScreenLineString& geometry,
     return tilePyramid.queryRenderedFeatures(geometry, transformState, layers, options, projMatrix);
 }
 
+void RenderGeoJSONSource::prepareRenderedQuery(RenderedFeatureQuery& query,
+                                               const ScreenLineString& geometry,
+                                               const TransformState& transformState,
+                                               const std::vector<const RenderLayer*>& layers,
+                                               const mat4& projMatrix) const {
+    tilePyramid.prepareRenderedQuery(query, geometry, transformState, layers, projMatrix);
+}
+
 std::vector<Feature> RenderGeoJSONSource::querySourceFeatures(const SourceQueryOptions& options) const {
     return tilePyramid.querySourceFeatures(options);
 }
 
+void RenderGeoJSONSource::setFeatureState(const optional<std::string>& sourceLayerID,
+                                          const std::string& featureID,
+                                          const FeatureState& state) {
+    tilePyramid.setFeatureState(sourceLayerID, featureID, state);
+}
+
+void RenderGeoJSONSource::getFeatureState(FeatureState& state,
+                                          const optional<std::string>& sourceLayerID,
+                                          const std::string& featureID) const {
+    tilePyramid.getFeatureState(state, sourceLayerID, featureID);
+}
+
+void RenderGeoJSONSource::removeFeatureState(const optional<std::string>& sourceLayerID,
+                                             const optional<std::string>& featureID,
+                                             const optional<std::string>& stateKey) {
+    tilePyramid.removeFeatureState(sourceLayerID, featureID, stateKey);
+}
+
 mapbox::util::variant<Value, FeatureCollection>
 RenderGeoJSONSource::queryFeatureExtensions(const Feature& feature,
                                             const std::string& extension,
@@ -6,6 +6,11 @@
 
 namespace mbgl {
 
+class GeoJSONTileSlicer;
+
+template <class>
+class Actor;
+
 namespace style {
 class GeoJSONData;
 } // namespace style
@@ -36,9 +41,27 @@ public:
                           const RenderedQueryOptions& options,
                           const mat4& projMatrix) const final;
 
+    void prepareRenderedQuery(RenderedFeatureQuery&,
+                              const ScreenLineString& geometry,
+                              const TransformState& transformState,
+                              const std::vector<const RenderLayer*>& layers,
+                              const mat4& projMatrix) const final;
+
     std::vector<Feature>
     querySourceFeatures(const SourceQueryOptions&) const final;
 
+    void setFeatureState(const optional<std::string>& sourceLayerID,
+                         const std::string& featureID,
+                         const FeatureState&) final;
+
+    void getFeatureState(FeatureState&,
+                         const optional<std::string>& sourceLayerID,
+                         const std::string& featureID) const final;
+
+    void removeFeatureState(const optional<std::string>& sourceLayerID,
+                            const optional<std::string>& featureID,
+                            const optional<std::string>& stateKey) final;
+
     FeatureExtensionValue
     queryFeatureExtensions(const Feature& feature,
                            const std::string& extension,
@@ -53,6 +76,7 @@ private:
 
     TilePyramid tilePyramid;
     std::weak_ptr<style::GeoJSONData> data;
+    std::unique_ptr<Actor<GeoJSONTileSlicer>> slicer;
 };
 
 template <>
@@ -82,10 +82,36 @@ RenderVectorSource::queryRenderedFeatures(const ScreenLineString& geometry,
     return tilePyramid.queryRenderedFeatures(geometry, transformState, layers, options, projMatrix);
 }
 
+void RenderVectorSource::prepareRenderedQuery(RenderedFeatureQuery& query,
+                                              const ScreenLineString& geometry,
+                                              const TransformState& transformState,
+                                              const std::vector<const RenderLayer*>& layers,
+                                              const mat4& projMatrix) const {
+    tilePyramid.prepareRenderedQuery(query, geometry, transformState, layers, projMatrix);
+}
+
 std::vector<Feature> RenderVectorSource::querySourceFeatures(const SourceQueryOptions& options) const {
     return tilePyramid.querySourceFeatures(options);
 }
 
+void RenderVectorSource::setFeatureState(const optional<std::string>& sourceLayerID,
+                                         const std::string& featureID,
+                                         const FeatureState& state) {
+    tilePyramid.setFeatureState(sourceLayerID, featureID, state);
+}
+
+void RenderVectorSource::getFeatureState(FeatureState& state,
+                                         const optional<std::string>& sourceLayerID,
+                                         const std::string& featureID) const {
+    tilePyramid.getFeatureState(state, sourceLayerID, featureID);
+}
+
+void RenderVectorSource::removeFeatureState(const optional<std::string>& sourceLayerID,
+                                            const optional<std::string>& featureID,
+                                            const optional<std::string>& stateKey) {
+    tilePyramid.removeFeatureState(sourceLayerID, featureID, stateKey);
+}
+
 void RenderVectorSource::reduceMemoryUse() {
     tilePyramid.reduceMemoryUse();
 }
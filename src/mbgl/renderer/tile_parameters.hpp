@@ -23,6 +23,8 @@ public:
     ImageManager& imageManager;
     GlyphManager& glyphManager;
     const uint8_t prefetchZoomDelta;
+    // Buckets may use a layout that is drawn with instanced draw calls.
+    const bool supportsInstancing;
 };
 
 } // namespace mbgl
@@ -6,6 +6,7 @@
 #include <mbgl/renderer/query.hpp>
 #include <mbgl/map/transform.hpp>
 #include <mbgl/math/clamp.hpp>
+#include <mbgl/util/tile_coordinate.hpp>
 #include <mbgl/util/tile_cover.hpp>
 #include <mbgl/util/tile_range.hpp>
 #include <mbgl/util/enum.hpp>
@@ -24,6 +25,22 @@ using namespace style;
 
 static TileObserver nullObserver;
 
+// Ranks the resource requests of a tile: ideal tiles are needed first, those closest to the center
+// of the viewport first. They're followed by other tiles, e.g. parents that stand in for ideal
+// tiles that are still loading and prefetched lower zoom tiles, ordered by how far their zoom
+// level is from the ideal one, and then by their distance from the center.
+static uint32_t tileRank(const OverscaledTileID& id, bool ideal, int32_t idealZoom, const LatLng& center) {
+    const uint8_t z = id.canonical.z;
+    const auto centerCoord = TileCoordinate::fromLatLng(z, center).p;
+    const double dx = std::remainder(id.canonical.x + 0.5 - centerCoord.x, double(1u << z));
+    const double dy = id.canonical.y + 0.5 - centerCoord.y;
+
+    // Distance in tiles at the tile's zoom level, in steps of 1/16 tile.
+    const uint32_t distance = static_cast<uint32_t>(std::min(std::hypot(dx, dy) * 16, double((1u << 20) - 1)));
+    const uint32_t zoomDistance = ideal ? 0 : 1 + std::min<uint32_t>(std::abs(idealZoom - z), 254);
+    return (zoomDistance << 20) | distance;
+}
+
 TilePyramid::TilePyramid()
     : observer(&nullObserver) {
 }
@@ -47,6 +64,7 @@ void TilePyramid::upload(gfx::UploadPass& parameters) {
 }
 
 void TilePyramid::prepare(const SourcePrepareParameters& parameters) {
+    featureState.coalesceChanges(tiles);
     for (auto& tile : renderTiles) {
         tile.prepare(parameters);
     }
@@ -242,6 +260,22 @@ void TilePyramid::update(const std::vector<Immutable<style::LayerProperties>>& l
         pair.second->setShowCollisionBoxes(parameters.debugOptions & MapDebugOptions::Collision);
     }
 
+    // Re-rank the requests of retained tiles that are still waiting for their data as the camera
+    // moves, so that the tiles in view are fetched before the ones that scrolled out of it, e.g.
+    // during a fling. The loaders only message their requests when the rank actually changes.
+    if (!tiles.empty()) {
+        const std::set<UnwrappedTileID> ideal(idealTiles.begin(), idealTiles.end());
+        const LatLng center = parameters.transformState.getLatLng();
+        const int32_t idealZoom = idealTiles.empty() ? tileZoom : idealTiles.front().canonical.z;
+        for (auto& pair : tiles) {
+            if (pair.second->isLoaded()) {
+                continue;
+            }
+            const bool isIdeal = ideal.count(pair.first.toUnwrapped()) != 0;
+            pair.second->setRank(tileRank(pair.first, isIdeal, idealZoom, center));
+        }
+    }
+
     // Initialize render tiles fields and update the tile contained layer render data.
     for (RenderTile& renderTile : renderTiles) {
         Tile& tile = renderTile.tile;
@@ -301,14 +335,12 @@ void TilePyramid::handleWrapJump(float lng) {
 }
 
 
-std::unordered_map<std::string, std::vector<Feature>> TilePyramid::queryRenderedFeatures(const ScreenLineString& geometry,
-                                           const TransformState& transformState,
-                                           const std::vector<const RenderLayer*>& layers,
-                                           const RenderedQueryOptions& options,
-                                           const mat4& projMatrix) const {
-    std::unordered_map<std::string, std::vector<Feature>> result;
+void TilePyramid::forEachQueriedTile(const ScreenLineString& geometry,
+                                     const TransformState& transformState,
+                                     const std::vector<const RenderLayer*>& layers,
+                                     const std::function<void (const RenderTile&, const GeometryCoordinates&)>& fn) const {
     if (renderTiles.empty() || geometry.empty()) {
-        return result;
+        return;
     }
 
     LineString<double> queryGeometry;
@@ -349,27 +381,68 @@ std::unordered_map<std::string, std::vector<Feature>> TilePyramid::queryRendered
             tileSpaceQueryGeometry.push_back(TileCoordinate::toGeometryCoordinate(renderTile.id, c));
         }
 
+        fn(renderTile, tileSpaceQueryGeometry);
+    }
+}
+
+std::unordered_map<std::string, std::vector<Feature>> TilePyramid::queryRenderedFeatures(const ScreenLineString& geometry,
+                                           const TransformState& transformState,
+                                           const std::vector<const RenderLayer*>& layers,
+                                           const RenderedQueryOptions& options,
+                                           const mat4& projMatrix) const {
+    std::unordered_map<std::string, std::vector<Feature>> result;
+    forEachQueriedTile(geometry, transformState, layers, [&] (const RenderTile& renderTile, const GeometryCoordinates& queryGeometry) {
         renderTile.tile.queryRenderedFeatures(result,
-                                              tileSpaceQueryGeometry,
+                                              queryGeometry,
                                               transformState,
                                               layers,
                                               options,
                                               projMatrix);
-    }
-
+    });
     return result;
 }
 
+void TilePyramid::prepareRenderedQuery(RenderedFeatureQuery& query,
+                                       const ScreenLineString& geometry,
+                                       const TransformState& transformState,
+                                       const std::vector<const RenderLayer*>& layers,
+                                       const mat4& projMatrix) const {
+    forEachQueriedTile(geometry, transformState, layers, [&] (const RenderTile& renderTile, const GeometryCoordinates& queryGeometry) {
+        renderTile.tile.prepareRenderedQuery(query, queryGeometry, transformState, layers, projMatrix);
+    });
+}
+
 std::vector<Feature> TilePyramid::querySourceFeatures(const SourceQueryOptions& options) const {
     std::vector<Feature> result;
+    std::set<FeatureIdentifier> seenIDs;
 
-    for (const auto& pair : tiles) {
-        pair.second->querySourceFeatures(result, options);
+    if (options.deduplicate) {
+        // Tiles are ordered by zoom level; visit the most detailed ones first, so that features
+        // are taken from the tiles with the least simplified geometry.
+        for (auto it = tiles.rbegin(); it != tiles.rend(); ++it) {
+            it->second->querySourceFeatures(result, options, seenIDs);
+        }
+    } else {
+        for (const auto& pair : tiles) {
+            pair.second->querySourceFeatures(result, options, seenIDs);
+        }
     }
 
     return result;
 }
 
+void TilePyramid::setFeatureState(const optional<std::string>& sourceLayerID, const std::string& featureID, const FeatureState& state) {
+    featureState.updateState(sourceLayerID, featureID, state);
+}
+
+void TilePyramid::getFeatureState(FeatureState& state, const optional<std::string>& sourceLayerID, const std::string& featureID) const {
+    featureState.getState(state, sourceLayerID, featureID);
+}
+
+void TilePyramid::removeFeatureState(const optional<std::string>& sourceLayerID, const optional<std::string>& featureID, const optional<std::string>& stateKey) {
+    featureState.removeState(sourceLayerID, featureID, stateKey);
+}
+
 void TilePyramid::setCacheSize(size_t size) {
     cache.setSize(size);
 }
@@ -4,6 +4,7 @@
 #include <mbgl/tile/tile_observer.hpp>
 #include <mbgl/tile/tile.hpp>
 #include <mbgl/tile/tile_cache.hpp>
+#include <mbgl/renderer/source_state.hpp>
 #include <mbgl/style/types.hpp>
 #include <mbgl/style/layer_properties.hpp>
 
@@ -11,6 +12,7 @@
 #include <mbgl/util/feature.hpp>
 #include <mbgl/util/range.hpp>
 
+#include <functional>
 #include <memory>
 #include <unordered_map>
 #include <vector>
@@ -23,6 +25,7 @@ class TransformState;
 class RenderTile;
 class RenderLayer;
 class RenderedQueryOptions;
+class RenderedFeatureQuery;
 class SourceQueryOptions;
 class TileParameters;
 class SourcePrepareParameters;
@@ -60,8 +63,19 @@ public:
                           const RenderedQueryOptions& options,
                           const mat4& projMatrix) const;
 
+    void prepareRenderedQuery(RenderedFeatureQuery&,
+                              const ScreenLineString& geometry,
+                              const TransformState& transformState,
+                              const std::vector<const RenderLayer*>&,
+                              const mat4& projMatrix) const;
+
     std::vector<Feature> querySourceFeatures(const SourceQueryOptions&) const;
 
+    // Feature state changes are applied to the tiles in prepare().
+    void setFeatureState(const optional<std::string>& sourceLayerID, const std::string& featureID, const FeatureState&);
+    void getFeatureState(FeatureState&, const optional<std::string>& sourceLayerID, const std::string& featureID) const;
+    void removeFeatureState(const optional<std::string>& sourceLayerID, const optional<std::string>& featureID, const optional<std::string>& stateKey);
+
     void setCacheSize(size_t);
     void reduceMemoryUse();
 
@@ -74,11 +88,20 @@ public:
 private:
     void addRenderTile(const UnwrappedTileID& tileID, Tile& tile);
 
+    // Calls the function for each render tile the query geometry may hit, in query order, with the
+    // geometry in the coordinates of the tile.
+    void forEachQueriedTile(const ScreenLineString& geometry,
+                            const TransformState&,
+                            const std::vector<const RenderLayer*>&,
+                            const std::function<void (const RenderTile&, const GeometryCoordinates&)>&) const;
+
     std::map<OverscaledTileID, std::unique_ptr<Tile>> tiles;
     TileCache cache;
 
     std::list<RenderTile> renderTiles;
 
+    SourceFeatureState featureState;
+
     TileObserver* observer = nullptr;
 
     float prevLng = 0;
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <mbgl/storage/file_source.hpp>
+
+namespace mbgl {
+
+// Serves tile sets packaged as MBTiles files. mbtiles:///path/to/file.mbtiles resolves to a
+// TileJSON document built from the metadata table, and mbtiles:///path/to/file.mbtiles/{z}/{x}/{y}
+// to the tile stored at those coordinates.
+class MBTilesFileSource : public FileSource {
+public:
+    MBTilesFileSource();
+    ~MBTilesFileSource() override;
+
+    std::unique_ptr<AsyncRequest> request(const Resource&, Callback) override;
+
+    static bool acceptsURL(const std::string& url);
+
+private:
+    class Impl;
+
+    std::unique_ptr<Impl> impl;
+};
+
+} // namespace mbgl
@@ -5,6 +5,7 @@
 #include <mbgl/style/expression/type.hpp>
 #include <mbgl/style/expression/compound_expression.hpp>
 #include <mbgl/style/expression/boolean_operator.hpp>
+#include <mbgl/style/expression/is_constant.hpp>
 #include <mbgl/util/geometry.hpp>
 
 namespace mbgl {
@@ -24,6 +25,9 @@ optional<Filter> Converter<Filter>::operator()(const Convertible& value, Error&
         if (!parseResult) {
             error.message = parsingContext.getCombinedErrors();
             return nullopt;
+        } else if (!isStateConstant(**parseResult)) {
+            error.message = "\"feature-state\" data expressions are not supported with filters.";
+            return nullopt;
         } else {
             return { Filter(std::move(parseResult)) };
         }
@@ -415,6 +415,21 @@ const auto& getObjectCompoundExpression() {
     return signature;
 }
 
+const auto& featureStateCompoundExpression() {
+    static auto signature = detail::makeSignature("feature-state", [](const EvaluationContext& params, const std::string& key) -> Result<Value> {
+        if (!params.featureState) {
+            return Null;
+        }
+
+        auto it = params.featureState->find(key);
+        if (it == params.featureState->end()) {
+            return Null;
+        }
+        return Value(toExpressionValue(it->second));
+    });
+    return signature;
+}
+
 const auto& propertiesCompoundExpression() {
     static auto signature = detail::makeSignature("properties", [](const EvaluationContext& params) -> Result<std::unordered_map<std::string, Value>> {
         if (!params.feature) {
@@ -874,6 +889,7 @@ MAPBOX_ETERNAL_CONSTEXPR const auto compoundExpressionRegistry = mapbox::eternal
     { "has", hasObjectCompoundExpression },
     { "get", getContextCompoundExpression },
     { "get", getObjectCompoundExpression },
+    { "feature-state", featureStateCompoundExpression },
     { "properties", propertiesCompoundExpression },
     { "geometry-type", geometryTypeCompoundExpression },
     { "id", idCompoundExpression },
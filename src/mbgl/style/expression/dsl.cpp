@@ -108,6 +108,10 @@ std::unique_ptr<Expression> get(std::unique_ptr<Expression> property) {
     return compound("get", std::move(property));
 }
 
+std::unique_ptr<Expression> featureState(const char* value) {
+    return compound("feature-state", literal(value));
+}
+
 std::unique_ptr<Expression> id() {
     return compound("id");
 }
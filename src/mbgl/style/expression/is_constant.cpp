@@ -20,7 +20,8 @@ bool isFeatureConstant(const Expression& expression) {
         } else if (
             name == "properties" ||
             name == "geometry-type" ||
-            name == "id"
+            name == "id" ||
+            name == "feature-state"
         ) {
             return false;
         } else if (0u == name.rfind(filter, 0u)) {
@@ -53,6 +54,10 @@ bool isZoomConstant(const Expression& e) {
     return isGlobalPropertyConstant(e, std::array<std::string, 1>{{"zoom"}});
 }
 
+bool isStateConstant(const Expression& e) {
+    return isGlobalPropertyConstant(e, std::array<std::string, 1>{{"feature-state"}});
+}
+
 
 } // namespace expression
 } // namespace style
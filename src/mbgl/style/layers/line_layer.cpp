@@ -702,6 +702,9 @@ optional<Error> LineLayer::setLayoutProperty(const std::string& name, const Conv
         if (!typedValue) {
             return error;
         }
+        if (typedValue->isExpression() && !typedValue->asExpression().isStateConstant()) {
+            return Error { "\"feature-state\" data expressions are not supported with layout properties." };
+        }
         
         setLineJoin(*typedValue);
         return nullopt;
@@ -1499,6 +1499,9 @@ optional<Error> SymbolLayer::setLayoutProperty(const std::string& name, const Co
         if (!typedValue) {
             return error;
         }
+        if (typedValue->isExpression() && !typedValue->asExpression().isStateConstant()) {
+            return Error { "\"feature-state\" data expressions are not supported with layout properties." };
+        }
         
         if (property == Property::IconAnchor) {
             setIconAnchor(*typedValue);
@@ -1518,6 +1521,9 @@ optional<Error> SymbolLayer::setLayoutProperty(const std::string& name, const Co
         if (!typedValue) {
             return error;
         }
+        if (typedValue->isExpression() && !typedValue->asExpression().isStateConstant()) {
+            return Error { "\"feature-state\" data expressions are not supported with layout properties." };
+        }
         
         setIconImage(*typedValue);
         return nullopt;
@@ -1530,6 +1536,9 @@ optional<Error> SymbolLayer::setLayoutProperty(const std::string& name, const Co
         if (!typedValue) {
             return error;
         }
+        if (typedValue->isExpression() && !typedValue->asExpression().isStateConstant()) {
+            return Error { "\"feature-state\" data expressions are not supported with layout properties." };
+        }
         
         if (property == Property::IconOffset) {
             setIconOffset(*typedValue);
@@ -1612,6 +1621,9 @@ optional<Error> SymbolLayer::setLayoutProperty(const std::string& name, const Co
         if (!typedValue) {
             return error;
         }
+        if (typedValue->isExpression() && !typedValue->asExpression().isStateConstant()) {
+            return Error { "\"feature-state\" data expressions are not supported with layout properties." };
+        }
         
         if (property == Property::IconRotate) {
             setIconRotate(*typedValue);
@@ -1709,6 +1721,9 @@ optional<Error> SymbolLayer::setLayoutProperty(const std::string& name, const Co
         if (!typedValue) {
             return error;
         }
+        if (typedValue->isExpression() && !typedValue->asExpression().isStateConstant()) {
+            return Error { "\"feature-state\" data expressions are not supported with layout properties." };
+        }
         
         setTextField(*typedValue);
         return nullopt;
@@ -1721,6 +1736,9 @@ optional<Error> SymbolLayer::setLayoutProperty(const std::string& name, const Co
         if (!typedValue) {
             return error;
         }
+        if (typedValue->isExpression() && !typedValue->asExpression().isStateConstant()) {
+            return Error { "\"feature-state\" data expressions are not supported with layout properties." };
+        }
         
         setTextFont(*typedValue);
         return nullopt;
@@ -1733,6 +1751,9 @@ optional<Error> SymbolLayer::setLayoutProperty(const std::string& name, const Co
         if (!typedValue) {
             return error;
         }
+        if (typedValue->isExpression() && !typedValue->asExpression().isStateConstant()) {
+            return Error { "\"feature-state\" data expressions are not supported with layout properties." };
+        }
         
         setTextJustify(*typedValue);
         return nullopt;
@@ -1745,6 +1766,9 @@ optional<Error> SymbolLayer::setLayoutProperty(const std::string& name, const Co
         if (!typedValue) {
             return error;
         }
+        if (typedValue->isExpression() && !typedValue->asExpression().isStateConstant()) {
+            return Error { "\"feature-state\" data expressions are not supported with layout properties." };
+        }
         
         setTextTransform(*typedValue);
         return nullopt;
@@ -8,6 +8,7 @@ PropertyExpressionBase::PropertyExpressionBase(std::unique_ptr<expression::Expre
       zoomCurve(expression::findZoomCurveChecked(expression.get())) {
     isZoomConstant_ = expression::isZoomConstant(*expression);
     isFeatureConstant_ = expression::isFeatureConstant(*expression);
+    isStateConstant_ = expression::isStateConstant(*expression);
 }
 
 bool PropertyExpressionBase::isZoomConstant() const noexcept {
@@ -18,6 +19,10 @@ bool PropertyExpressionBase::isFeatureConstant() const noexcept {
     return isFeatureConstant_;
 }
 
+bool PropertyExpressionBase::isStateConstant() const noexcept {
+    return isStateConstant_;
+}
+
 bool PropertyExpressionBase::canEvaluateWith(const expression::EvaluationContext& context) const noexcept {
     if (context.zoom) {
         if (context.feature != nullptr) {
@@ -1,16 +1,60 @@
 #include <mbgl/style/sources/geojson_source.hpp>
 #include <mbgl/style/sources/geojson_source_impl.hpp>
 #include <mbgl/style/source_observer.hpp>
-#include <mbgl/style/conversion/json.hpp>
-#include <mbgl/style/conversion/geojson.hpp>
 #include <mbgl/storage/file_source.hpp>
+#include <mbgl/actor/actor.hpp>
+#include <mbgl/actor/scheduler.hpp>
+#include <mbgl/util/geojson_parser.hpp>
 #include <mbgl/util/logging.hpp>
 
+#include <cassert>
+
 namespace mbgl {
 namespace style {
 
+namespace {
+
+GeoJSON parseGeoJSON(const std::string& data) {
+    try {
+        return util::parseGeoJSON(data);
+    } catch (const std::exception& ex) {
+        Log::Error(Event::ParseStyle, "Failed to parse GeoJSON data: %s", ex.what());
+        // Create an empty GeoJSON VT object to make sure we're not infinitely waiting for
+        // tiles to load.
+        return FeatureCollection{};
+    }
+}
+
+} // namespace
+
+class GeoJSONIndexBuilder {
+public:
+    GeoJSONIndexBuilder(ActorRef<GeoJSONSource> source_, GeoJSONFeatureStore features_)
+        : source(std::move(source_)),
+          features(std::move(features_)) {
+    }
+
+    void set(uint64_t buildID, GeoJSON geoJSON) {
+        source.invoke(&GeoJSONSource::onIndexBuilt, buildID, features.set(std::move(geoJSON)));
+    }
+
+    // Parses the data here as well, since large files take a while to parse.
+    void load(uint64_t buildID, std::shared_ptr<const std::string> data) {
+        set(buildID, parseGeoJSON(*data));
+    }
+
+    void update(uint64_t buildID, FeatureCollection changed, std::vector<FeatureIdentifier> removed) {
+        source.invoke(&GeoJSONSource::onIndexBuilt, buildID, features.update(std::move(changed), removed));
+    }
+
+private:
+    ActorRef<GeoJSONSource> source;
+    GeoJSONFeatureStore features;
+};
+
 GeoJSONSource::GeoJSONSource(const std::string& id, const GeoJSONOptions& options)
-    : Source(makeMutable<Impl>(std::move(id), options)) {
+    : Source(makeMutable<Impl>(std::move(id), options)),
+      features(std::make_unique<GeoJSONFeatureStore>(options)) {
 }
 
 GeoJSONSource::~GeoJSONSource() = default;
@@ -23,17 +67,94 @@ void GeoJSONSource::setURL(const std::string& url_) {
     url = std::move(url_);
 
     // Signal that the source description needs a reload
-    if (loaded || req) {
+    if (loaded || req || building) {
         loaded = false;
         req.reset();
+        // Drop the index of any data that is still being built.
+        latestBuild++;
+        building = false;
+        loadingFromURL = false;
         observer->onSourceDescriptionChanged(*this);
     }
 }
 
 void GeoJSONSource::setGeoJSON(const mapbox::geojson::geojson& geoJSON) {
     req.reset();
-    baseImpl = makeMutable<Impl>(impl(), geoJSON);
-    observer->onSourceChanged(*this);
+    loadingFromURL = false;
+    buildIndex(geoJSON);
+}
+
+void GeoJSONSource::updateFeatures(const FeatureCollection& changed) {
+    changeFeatures(changed, {});
+}
+
+void GeoJSONSource::removeFeatures(const std::vector<FeatureIdentifier>& removed) {
+    changeFeatures({}, removed);
+}
+
+void GeoJSONSource::buildIndex(const GeoJSON& geoJSON) {
+    if (startBuild()) {
+        indexBuilder->self().invoke(&GeoJSONIndexBuilder::set, latestBuild, geoJSON);
+    } else {
+        onIndexBuilt(latestBuild, features->set(geoJSON));
+    }
+}
+
+void GeoJSONSource::loadData(std::shared_ptr<const std::string> data) {
+    loadingFromURL = true;
+    if (startBuild()) {
+        indexBuilder->self().invoke(&GeoJSONIndexBuilder::load, latestBuild, std::move(data));
+    } else {
+        onIndexBuilt(latestBuild, features->set(parseGeoJSON(*data)));
+    }
+}
+
+void GeoJSONSource::changeFeatures(const FeatureCollection& changed, const std::vector<FeatureIdentifier>& removed) {
+    if (startBuild()) {
+        indexBuilder->self().invoke(&GeoJSONIndexBuilder::update, latestBuild, changed, removed);
+    } else {
+        onIndexBuilt(latestBuild, features->update(changed, removed));
+    }
+}
+
+bool GeoJSONSource::startBuild() {
+    latestBuild++;
+
+    // Without a scheduler on this thread there is no way to receive the result; build in place.
+    if (!Scheduler::GetCurrent()) {
+        assert(features);
+        return false;
+    }
+
+    if (!indexBuilder) {
+        mailbox = std::make_shared<Mailbox>(*Scheduler::GetCurrent());
+        indexBuilder = std::make_unique<Actor<GeoJSONIndexBuilder>>(
+            Scheduler::GetBackground(), ActorRef<GeoJSONSource>(*this, mailbox), std::move(*features));
+        features.reset();
+    }
+
+    // The source isn't loaded until the new data can be rendered, while the previous data keeps
+    // being rendered in the meantime.
+    building = true;
+    loaded = false;
+    return true;
+}
+
+void GeoJSONSource::onIndexBuilt(uint64_t buildID, std::unique_ptr<GeoJSONData> data) {
+    if (buildID != latestBuild) {
+        return;
+    }
+
+    building = false;
+    baseImpl = makeMutable<Impl>(impl(), std::move(data));
+    loaded = true;
+
+    if (loadingFromURL) {
+        loadingFromURL = false;
+        observer->onSourceLoaded(*this);
+    } else {
+        observer->onSourceChanged(*this);
+    }
 }
 
 optional<std::string> GeoJSONSource::getURL() const {
@@ -41,6 +162,11 @@ optional<std::string> GeoJSONSource::getURL() const {
 }
 
 void GeoJSONSource::loadDescription(FileSource& fileSource) {
+    // The source gets loaded once the index of its data is built.
+    if (building) {
+        return;
+    }
+
     if (!url) {
         loaded = true;
         return;
@@ -60,20 +186,7 @@ void GeoJSONSource::loadDescription(FileSource& fileSource) {
             observer->onSourceError(
                 *this, std::make_exception_ptr(std::runtime_error("unexpectedly empty GeoJSON")));
         } else {
-            conversion::Error error;
-            optional<GeoJSON> geoJSON = conversion::convertJSON<GeoJSON>(*res.data, error);
-            if (!geoJSON) {
-                Log::Error(Event::ParseStyle, "Failed to parse GeoJSON data: %s",
-                           error.message.c_str());
-                // Create an empty GeoJSON VT object to make sure we're not infinitely waiting for
-                // tiles to load.
-                baseImpl = makeMutable<Impl>(impl(), GeoJSON{ FeatureCollection{} });
-            } else {
-                baseImpl = makeMutable<Impl>(impl(), *geoJSON);
-            }
-
-            loaded = true;
-            observer->onSourceLoaded(*this);
+            loadData(res.data);
         }
     });
 }
@@ -2,23 +2,107 @@
 #include <mbgl/util/constants.hpp>
 #include <mbgl/tile/tile_id.hpp>
 #include <mbgl/util/string.hpp>
+#include <mbgl/math/clamp.hpp>
 
 #include <mapbox/geojsonvt.hpp>
+#include <mapbox/geometry/envelope.hpp>
 #include <supercluster.hpp>
 
+#include <algorithm>
+#include <cassert>
 #include <cmath>
+#include <iterator>
+#include <limits>
+#include <mutex>
 
 namespace mbgl {
 namespace style {
 
+namespace {
+
+GeoJSONData::Bounds getBounds(const Feature::geometry_type& geometry) {
+    auto bounds = mapbox::geometry::envelope(geometry);
+    // Features beyond the poles are drawn at the edge of the world.
+    bounds.min.y = util::clamp(bounds.min.y, -util::LATITUDE_MAX, util::LATITUDE_MAX);
+    bounds.max.y = util::clamp(bounds.max.y, -util::LATITUDE_MAX, util::LATITUDE_MAX);
+    return bounds;
+}
+
+mapbox::geojsonvt::Options geoJSONVTOptions(const GeoJSONOptions& options) {
+    constexpr double scale = util::EXTENT / util::tileSize;
+
+    mapbox::geojsonvt::Options vtOptions;
+    vtOptions.maxZoom = options.maxzoom;
+    vtOptions.extent = util::EXTENT;
+    vtOptions.buffer = ::round(scale * options.buffer);
+    vtOptions.tolerance = scale * options.tolerance;
+    vtOptions.lineMetrics = options.lineMetrics;
+    return vtOptions;
+}
+
+} // namespace
+
+// A run of consecutive features of a source with its own GeoJSON-VT index, which is built when
+// the first tile is requested from it.
+class GeoJSONVTChunk {
+public:
+    GeoJSONVTChunk(FeatureCollection features_, const GeoJSONOptions& options)
+        : features(std::move(features_)),
+          bounds(getFeatureBounds(features)),
+          vtOptions(geoJSONVTOptions(options)) {
+    }
+
+    mapbox::feature::feature_collection<int16_t> getTile(const CanonicalTileID& tileID) {
+        // Chunks are shared between versions of the data, which may be sliced concurrently.
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!index) {
+            index = std::make_unique<mapbox::geojsonvt::GeoJSONVT>(features, vtOptions);
+        }
+        return index->getTile(tileID.z, tileID.x, tileID.y).features;
+    }
+
+    const FeatureCollection features;
+    const GeoJSONData::Bounds bounds;
+
+private:
+    static GeoJSONData::Bounds getFeatureBounds(const FeatureCollection& collection) {
+        GeoJSONData::Bounds result { { std::numeric_limits<double>::max(), std::numeric_limits<double>::max() },
+                                     { std::numeric_limits<double>::lowest(), std::numeric_limits<double>::lowest() } };
+        for (const auto& feature : collection) {
+            const auto featureBounds = getBounds(feature.geometry);
+            result.min.x = std::min(result.min.x, featureBounds.min.x);
+            result.min.y = std::min(result.min.y, featureBounds.min.y);
+            result.max.x = std::max(result.max.x, featureBounds.max.x);
+            result.max.y = std::max(result.max.y, featureBounds.max.y);
+        }
+        return result;
+    }
+
+    const mapbox::geojsonvt::Options vtOptions;
+    std::mutex mutex;
+    std::unique_ptr<mapbox::geojsonvt::GeoJSONVT> index;
+};
+
 class GeoJSONVTData : public GeoJSONData {
 public:
-    GeoJSONVTData(const GeoJSON& geoJSON,
-                  const mapbox::geojsonvt::Options& options)
-        : impl(geoJSON, options) {}
+    GeoJSONVTData(std::vector<std::shared_ptr<GeoJSONVTChunk>> chunks_, const GeoJSONOptions& options)
+        : chunks(std::move(chunks_)),
+          buffer(double(options.buffer) / util::tileSize) {
+    }
 
     mapbox::feature::feature_collection<int16_t> getTile(const CanonicalTileID& tileID) final {
-        return impl.getTile(tileID.z, tileID.x, tileID.y).features;
+        if (chunks.size() == 1) {
+            return chunks.front()->getTile(tileID);
+        }
+
+        mapbox::feature::feature_collection<int16_t> result;
+        for (const auto& chunk : chunks) {
+            if (touchesTile(chunk->bounds, tileID, buffer)) {
+                auto features = chunk->getTile(tileID);
+                std::move(features.begin(), features.end(), std::back_inserter(result));
+            }
+        }
+        return result;
     }
 
     mapbox::feature::feature_collection<double> getChildren(const std::uint32_t) final {
@@ -36,7 +120,8 @@ public:
     }
 
 private:
-    mapbox::geojsonvt::GeoJSONVT impl;
+    const std::vector<std::shared_ptr<GeoJSONVTChunk>> chunks;
+    const double buffer;
 };
 
 class SuperclusterData : public GeoJSONData {
@@ -67,38 +152,243 @@ private:
     mapbox::supercluster::Supercluster impl;
 };
 
-GeoJSONSource::Impl::Impl(std::string id_, GeoJSONOptions options_)
-    : Source::Impl(SourceType::GeoJSON, std::move(id_)),
-      options(std::move(options_)) {
-}
-
-GeoJSONSource::Impl::Impl(const Impl& other, const GeoJSON& geoJSON)
-    : Source::Impl(other),
-      options(other.options) {
+std::unique_ptr<GeoJSONData> GeoJSONData::create(const FeatureCollection& features, const GeoJSONOptions& options) {
     constexpr double scale = util::EXTENT / util::tileSize;
 
-    if (options.cluster
-        && geoJSON.is<mapbox::feature::feature_collection<double>>()
-        && !geoJSON.get<mapbox::feature::feature_collection<double>>().empty()) {
+    if (options.cluster && !features.empty()) {
         mapbox::supercluster::Options clusterOptions;
         clusterOptions.maxZoom = options.clusterMaxZoom;
         clusterOptions.extent = util::EXTENT;
         clusterOptions.radius = ::round(scale * options.clusterRadius);
-        data = std::make_shared<SuperclusterData>(
-            geoJSON.get<mapbox::feature::feature_collection<double>>(), clusterOptions);
+        return std::make_unique<SuperclusterData>(features, clusterOptions);
+    }
+
+    return std::make_unique<GeoJSONVTData>(
+        std::vector<std::shared_ptr<GeoJSONVTChunk>>{ std::make_shared<GeoJSONVTChunk>(features, options) }, options);
+}
+
+optional<std::vector<GeoJSONData::Bounds>> GeoJSONData::getChangesSince(uint64_t since) const {
+    // Changes need to be known for every version after the given one.
+    if (since >= version || changes.empty() || changes.front().first > since + 1) {
+        return nullopt;
+    }
+
+    std::vector<Bounds> result;
+    for (const auto& change : changes) {
+        if (change.first > since) {
+            result.insert(result.end(), change.second->begin(), change.second->end());
+        }
+    }
+    return result;
+}
+
+bool GeoJSONData::touchesTile(const Bounds& area, const CanonicalTileID& tileID, double buffer) {
+    const double worldSize = std::pow(2.0, tileID.z);
+    const auto longitude = [&] (double x) {
+        return x / worldSize * 360.0 - 180.0;
+    };
+    const auto latitude = [&] (double y) {
+        return util::RAD2DEG * std::atan(std::sinh(M_PI * (1.0 - 2.0 * y / worldSize)));
+    };
+
+    if (area.min.y > latitude(tileID.y - buffer) || area.max.y < latitude(tileID.y + 1 + buffer)) {
+        return false;
+    }
+
+    const double west = longitude(tileID.x - buffer);
+    const double east = longitude(tileID.x + 1 + buffer);
+    for (const double shift : { -360.0, 0.0, 360.0 }) {
+        if (area.min.x + shift <= east && area.max.x + shift >= west) {
+            return true;
+        }
+    }
+    return false;
+}
+
+namespace {
+
+// Changes are kept for this many versions, which covers versions the renderer skipped.
+constexpr std::size_t maxChanges = 16;
+
+} // namespace
+
+GeoJSONFeatureStore::GeoJSONFeatureStore(GeoJSONOptions options_, std::size_t chunkSize_)
+    : options(std::move(options_)),
+      chunkSize(chunkSize_) {
+}
+
+std::unique_ptr<GeoJSONData> GeoJSONFeatureStore::set(GeoJSON geoJSON) {
+    FeatureCollection features = geoJSON.match(
+        [] (FeatureCollection& collection) {
+            return std::move(collection);
+        },
+        [] (Feature& feature) {
+            FeatureCollection collection;
+            collection.push_back(std::move(feature));
+            return collection;
+        },
+        [] (Feature::geometry_type& geometry) {
+            FeatureCollection collection;
+            collection.emplace_back(std::move(geometry));
+            return collection;
+        });
+
+    chunks.clear();
+    chunkKeys.clear();
+    for (std::size_t begin = 0; begin < features.size(); begin += chunkSize) {
+        const std::size_t end = std::min(begin + chunkSize, features.size());
+        const uint64_t key = nextChunk++;
+        for (std::size_t i = begin; i < end; ++i) {
+            if (!features[i].id.is<NullValue>()) {
+                chunkKeys[features[i].id] = key;
+            }
+        }
+        chunks.emplace(key, std::make_shared<GeoJSONVTChunk>(
+            FeatureCollection(std::make_move_iterator(features.begin() + begin),
+                              std::make_move_iterator(features.begin() + end)),
+            options));
+    }
+
+    changes.clear();
+    return build(nullptr);
+}
+
+std::unique_ptr<GeoJSONData> GeoJSONFeatureStore::update(FeatureCollection changed,
+                                                         const std::vector<FeatureIdentifier>& removed) {
+    auto touched = std::make_shared<std::vector<GeoJSONData::Bounds>>();
+
+    // The features of the chunks that change, copied when they are first changed.
+    std::map<uint64_t, FeatureCollection> edited;
+    const auto edit = [&] (uint64_t key) -> FeatureCollection& {
+        auto it = edited.find(key);
+        if (it == edited.end()) {
+            it = edited.emplace(key, chunks.at(key)->features).first;
+        }
+        return it->second;
+    };
+    const auto find = [] (FeatureCollection& features, const FeatureIdentifier& id) {
+        return std::find_if(features.begin(), features.end(), [&] (const Feature& feature) {
+            return feature.id == id;
+        });
+    };
+
+    for (const auto& id : removed) {
+        auto it = chunkKeys.find(id);
+        if (it != chunkKeys.end()) {
+            auto& features = edit(it->second);
+            auto feature = find(features, id);
+            assert(feature != features.end());
+            touched->push_back(getBounds(feature->geometry));
+            // Keep the order of the remaining features, which is the order they are drawn in.
+            features.erase(feature);
+            chunkKeys.erase(it);
+        }
+    }
+
+    // New features are appended to the last chunk, until it is full.
+    optional<uint64_t> lastChunk;
+    if (!chunks.empty()) {
+        lastChunk = chunks.rbegin()->first;
+    }
+
+    for (auto& feature : changed) {
+        touched->push_back(getBounds(feature.geometry));
+
+        if (!feature.id.is<NullValue>()) {
+            auto it = chunkKeys.find(feature.id);
+            if (it != chunkKeys.end()) {
+                auto& features = edit(it->second);
+                auto current = find(features, feature.id);
+                assert(current != features.end());
+                touched->push_back(getBounds(current->geometry));
+                *current = std::move(feature);
+                continue;
+            }
+        }
+
+        const auto lastEdited = lastChunk ? edited.find(*lastChunk) : edited.end();
+        const std::size_t lastSize = !lastChunk ? chunkSize
+            : lastEdited != edited.end() ? lastEdited->second.size()
+            : chunks.at(*lastChunk)->features.size();
+        if (lastSize >= chunkSize) {
+            lastChunk = nextChunk++;
+            edited.emplace(*lastChunk, FeatureCollection());
+        }
+
+        if (!feature.id.is<NullValue>()) {
+            chunkKeys[feature.id] = *lastChunk;
+        }
+        edit(*lastChunk).push_back(std::move(feature));
+    }
+
+    for (auto& entry : edited) {
+        if (entry.second.empty()) {
+            chunks.erase(entry.first);
+        } else {
+            chunks[entry.first] = std::make_shared<GeoJSONVTChunk>(std::move(entry.second), options);
+        }
+    }
+
+    // A change to a single point may move clusters anywhere, so clustered data is sliced again
+    // as a whole.
+    if (options.cluster) {
+        changes.clear();
+        return build(nullptr);
+    }
+    return build(std::move(touched));
+}
+
+std::unique_ptr<GeoJSONData> GeoJSONFeatureStore::build(std::shared_ptr<const std::vector<GeoJSONData::Bounds>> touched) {
+    version++;
+    if (touched) {
+        changes.emplace_back(version, std::move(touched));
+        if (changes.size() > maxChanges) {
+            changes.pop_front();
+        }
+    }
+
+    std::unique_ptr<GeoJSONData> data;
+    if (options.cluster) {
+        // Superclusters can't be combined, so they are built from all features.
+        FeatureCollection features;
+        for (const auto& entry : chunks) {
+            features.insert(features.end(), entry.second->features.begin(), entry.second->features.end());
+        }
+        data = GeoJSONData::create(features, options);
     } else {
-        mapbox::geojsonvt::Options vtOptions;
-        vtOptions.maxZoom = options.maxzoom;
-        vtOptions.extent = util::EXTENT;
-        vtOptions.buffer = ::round(scale * options.buffer);
-        vtOptions.tolerance = scale * options.tolerance;
-        vtOptions.lineMetrics = options.lineMetrics;
-        data = std::make_shared<GeoJSONVTData>(geoJSON, vtOptions);
+        std::vector<std::shared_ptr<GeoJSONVTChunk>> indexed;
+        indexed.reserve(chunks.size());
+        for (const auto& entry : chunks) {
+            indexed.push_back(entry.second);
+        }
+        if (indexed.empty()) {
+            indexed.push_back(std::make_shared<GeoJSONVTChunk>(FeatureCollection(), options));
+        }
+        data = std::make_unique<GeoJSONVTData>(std::move(indexed), options);
     }
+
+    data->version = version;
+    data->changes = changes;
+    return data;
+}
+
+GeoJSONSource::Impl::Impl(std::string id_, GeoJSONOptions options_)
+    : Source::Impl(SourceType::GeoJSON, std::move(id_)),
+      options(std::move(options_)) {
+}
+
+GeoJSONSource::Impl::Impl(const Impl& other, std::shared_ptr<GeoJSONData> data_)
+    : Source::Impl(other),
+      options(other.options),
+      data(std::move(data_)) {
 }
 
 GeoJSONSource::Impl::~Impl() = default;
 
+const GeoJSONOptions& GeoJSONSource::Impl::getOptions() const {
+    return options;
+}
+
 Range<uint8_t> GeoJSONSource::Impl::getZoomRange() const {
     return { options.minzoom, options.maxzoom };
 }
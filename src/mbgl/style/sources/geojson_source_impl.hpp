@@ -4,6 +4,11 @@
 #include <mbgl/style/sources/geojson_source.hpp>
 #include <mbgl/util/range.hpp>
 
+#include <mapbox/geometry/box.hpp>
+
+#include <deque>
+#include <map>
+
 namespace mbgl {
 
 class AsyncRequest;
@@ -13,6 +18,9 @@ namespace style {
 
 class GeoJSONData {
 public:
+    // An area of the world, in longitude and latitude.
+    using Bounds = mapbox::geometry::box<double>;
+
     virtual ~GeoJSONData() = default;
     virtual mapbox::feature::feature_collection<int16_t> getTile(const CanonicalTileID&) = 0;
 
@@ -22,14 +30,69 @@ public:
                                                                    const std::uint32_t limit  = 10u,
                                                                    const std::uint32_t offset = 0u) = 0;
     virtual std::uint8_t getClusterExpansionZoom(std::uint32_t) = 0;
+
+    // Builds the GeoJSON-VT or Supercluster index of the data. This is expensive for large data,
+    // and is done on a background thread unless no scheduler is available.
+    static std::unique_ptr<GeoJSONData> create(const FeatureCollection&, const GeoJSONOptions&);
+
+    // Returns the areas touched by the changes made since the given version of the data, or
+    // nothing if they aren't known, e.g. because the data was replaced as a whole since.
+    optional<std::vector<Bounds>> getChangesSince(uint64_t version) const;
+
+    // Whether the area touches the given tile, including a buffer given as a fraction of the tile
+    // size, or the same tile in one of the neighbouring copies of the world.
+    static bool touchesTile(const Bounds&, const CanonicalTileID&, double buffer);
+
+    // Increases with every change to the data of a source.
+    uint64_t version = 0;
+
+    // The areas touched by each of the latest changes, by version, oldest first.
+    std::deque<std::pair<uint64_t, std::shared_ptr<const std::vector<Bounds>>>> changes;
+};
+
+class GeoJSONVTChunk;
+
+// Keeps the features of a source, so that changes to them can be applied without sending all
+// of them again, and builds the index of them after every change.
+//
+// Unless the source is clustered, the features are split into chunks of consecutive features that
+// are indexed separately. The chunks are shared between versions of the data, so that a change
+// only indexes the chunks holding the changed features again.
+class GeoJSONFeatureStore {
+public:
+    static constexpr std::size_t defaultChunkSize = 4096;
+
+    GeoJSONFeatureStore(GeoJSONOptions, std::size_t chunkSize = defaultChunkSize);
+
+    std::unique_ptr<GeoJSONData> set(GeoJSON);
+
+    // Replaces the features that have the same identifier as one of the given features, and
+    // adds the others.
+    std::unique_ptr<GeoJSONData> update(FeatureCollection changed, const std::vector<FeatureIdentifier>& removed);
+
+private:
+    std::unique_ptr<GeoJSONData> build(std::shared_ptr<const std::vector<GeoJSONData::Bounds>> touched);
+
+    const GeoJSONOptions options;
+    const std::size_t chunkSize;
+
+    // The features in the order they are drawn in, by increasing chunk key.
+    std::map<uint64_t, std::shared_ptr<GeoJSONVTChunk>> chunks;
+    uint64_t nextChunk = 0;
+    // Chunks of the features that have an identifier.
+    std::map<FeatureIdentifier, uint64_t> chunkKeys;
+
+    uint64_t version = 0;
+    std::deque<std::pair<uint64_t, std::shared_ptr<const std::vector<GeoJSONData::Bounds>>>> changes;
 };
 
 class GeoJSONSource::Impl : public Source::Impl {
 public:
     Impl(std::string id, GeoJSONOptions);
-    Impl(const GeoJSONSource::Impl&, const GeoJSON&);
+    Impl(const GeoJSONSource::Impl&, std::shared_ptr<GeoJSONData>);
     ~Impl() final;
 
+    const GeoJSONOptions& getOptions() const;
     Range<uint8_t> getZoomRange() const;
     std::weak_ptr<GeoJSONData> getData() const;
 
@@ -68,23 +68,14 @@ void CustomGeometryTile::setNecessity(TileNecessity newNecessity) {
 
 void CustomGeometryTile::querySourceFeatures(
     std::vector<Feature>& result,
-    const SourceQueryOptions& queryOptions) {
+    const SourceQueryOptions& queryOptions,
+    std::set<FeatureIdentifier>& seenIDs) {
 
     // Ignore the sourceLayer, there is only one
     auto layer = getData()->getLayer({});
 
     if (layer) {
-        auto featureCount = layer->featureCount();
-        for (std::size_t i = 0; i < featureCount; i++) {
-            auto feature = layer->getFeature(i);
-
-            // Apply filter, if any
-            if (queryOptions.filter && !(*queryOptions.filter)(style::expression::EvaluationContext { static_cast<float>(id.overscaledZ), feature.get() })) {
-                continue;
-            }
-
-            result.push_back(convertFeature(*feature, id.canonical));
-        }
+        querySourceLayer(result, *layer, queryOptions, seenIDs);
     }
 }
 
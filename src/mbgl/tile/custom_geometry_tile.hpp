@@ -30,7 +30,8 @@ public:
 
     void querySourceFeatures(
         std::vector<Feature>& result,
-        const SourceQueryOptions&) override;
+        const SourceQueryOptions&,
+        std::set<FeatureIdentifier>& seenIDs) override;
 
 private:
     bool stale = true;
@@ -2,39 +2,57 @@
 #include <mbgl/tile/geojson_tile_data.hpp>
 #include <mbgl/renderer/query.hpp>
 #include <mbgl/renderer/tile_parameters.hpp>
+#include <mbgl/style/sources/geojson_source_impl.hpp>
+#include <mbgl/actor/mailbox.hpp>
+#include <mbgl/actor/scheduler.hpp>
 
 namespace mbgl {
 
+GeoJSONTileSlicer::GeoJSONTileSlicer(std::shared_ptr<style::GeoJSONData> data_)
+    : data(std::move(data_)) {
+}
+
+void GeoJSONTileSlicer::setData(std::shared_ptr<style::GeoJSONData> data_) {
+    data = std::move(data_);
+}
+
+void GeoJSONTileSlicer::slice(CanonicalTileID tileID, ActorRef<GeoJSONTile> tile, uint64_t correlationID) {
+    tile.invoke(&GeoJSONTile::onSliced, data->getTile(tileID), correlationID);
+}
+
 GeoJSONTile::GeoJSONTile(const OverscaledTileID& overscaledTileID,
                          std::string sourceID_,
                          const TileParameters& parameters,
-                         mapbox::feature::feature_collection<int16_t> features)
-    : GeometryTile(overscaledTileID, sourceID_, parameters) {
-    updateData(std::move(features));
+                         ActorRef<GeoJSONTileSlicer> slicer)
+    : GeometryTile(overscaledTileID, sourceID_, parameters),
+      mailbox(std::make_shared<Mailbox>(*Scheduler::GetCurrent())),
+      actorRef(*this, mailbox) {
+    updateData(std::move(slicer));
 }
 
-void GeoJSONTile::updateData(mapbox::feature::feature_collection<int16_t> features) {
+void GeoJSONTile::updateData(ActorRef<GeoJSONTileSlicer> slicer) {
+    slicing = true;
+    slicer.invoke(&GeoJSONTileSlicer::slice, id.canonical, actorRef, ++sliceCorrelationID);
+}
+
+void GeoJSONTile::onSliced(mapbox::feature::feature_collection<int16_t> features, uint64_t correlationID) {
+    if (correlationID != sliceCorrelationID) {
+        return;
+    }
+
+    slicing = false;
     setData(std::make_unique<GeoJSONTileData>(std::move(features)));
 }
 
 void GeoJSONTile::querySourceFeatures(
     std::vector<Feature>& result,
-    const SourceQueryOptions& options) {
+    const SourceQueryOptions& options,
+    std::set<FeatureIdentifier>& seenIDs) {
 
     // Ignore the sourceLayer, there is only one
     if (auto tileData = getData()) {
         if (auto layer = tileData->getLayer({})) {
-            auto featureCount = layer->featureCount();
-            for (std::size_t i = 0; i < featureCount; i++) {
-                auto feature = layer->getFeature(i);
-
-                // Apply filter, if any
-                if (options.filter && !(*options.filter)(style::expression::EvaluationContext { static_cast<float>(this->id.overscaledZ), feature.get() })) {
-                    continue;
-                }
-
-                result.push_back(convertFeature(*feature, id.canonical));
-            }
+            querySourceLayer(result, *layer, options, seenIDs);
         }
     }
 }
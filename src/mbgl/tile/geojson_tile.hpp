@@ -2,23 +2,61 @@
 
 #include <mbgl/tile/geometry_tile.hpp>
 #include <mbgl/util/feature.hpp>
+#include <mbgl/actor/actor_ref.hpp>
 
 namespace mbgl {
 
 class TileParameters;
+class GeoJSONTile;
+
+namespace style {
+class GeoJSONData;
+} // namespace style
+
+// Slices the tiles of a GeoJSON source from the index of its data, on the background thread pool.
+// All tiles of a source are sliced by a single actor, since the index is built up lazily while
+// being sliced and doesn't support concurrent access. The actor lives as long as the source, and
+// slices requested after setData() are cut from the new data.
+class GeoJSONTileSlicer {
+public:
+    GeoJSONTileSlicer(std::shared_ptr<style::GeoJSONData>);
+
+    void setData(std::shared_ptr<style::GeoJSONData>);
+    void slice(CanonicalTileID, ActorRef<GeoJSONTile>, uint64_t correlationID);
+
+private:
+    std::shared_ptr<style::GeoJSONData> data;
+};
 
 class GeoJSONTile : public GeometryTile {
 public:
     GeoJSONTile(const OverscaledTileID&,
                 std::string sourceID,
                 const TileParameters&,
-                mapbox::feature::feature_collection<int16_t>);
+                ActorRef<GeoJSONTileSlicer>);
+
+    // Requests the features of the tile from new data. The tile keeps its current features
+    // until they arrive.
+    void updateData(ActorRef<GeoJSONTileSlicer>);
+
+    // Invoked by GeoJSONTileSlicer
+    void onSliced(mapbox::feature::feature_collection<int16_t>, uint64_t correlationID);
 
-    void updateData(mapbox::feature::feature_collection<int16_t>);
+    // Whether the features of the tile are still being sliced from the latest data.
+    bool isSlicing() const { return slicing; }
 
     void querySourceFeatures(
         std::vector<Feature>& result,
-        const SourceQueryOptions&) override;
+        const SourceQueryOptions&,
+        std::set<FeatureIdentifier>& seenIDs) override;
+
+private:
+    std::shared_ptr<Mailbox> mailbox;
+    ActorRef<GeoJSONTile> actorRef;
+
+    // Replies to requests made before the latest data was set are dropped.
+    uint64_t sliceCorrelationID = 0;
+    bool slicing = false;
 };
 
 } // namespace mbgl
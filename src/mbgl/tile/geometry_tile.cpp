@@ -12,6 +12,7 @@
 #include <mbgl/renderer/layers/render_symbol_layer.hpp>
 #include <mbgl/renderer/buckets/symbol_bucket.hpp>
 #include <mbgl/renderer/query.hpp>
+#include <mbgl/renderer/rendered_feature_query.hpp>
 #include <mbgl/text/glyph_atlas.hpp>
 #include <mbgl/renderer/image_atlas.hpp>
 #include <mbgl/geometry/feature_index.hpp>
@@ -53,7 +54,8 @@ GeometryTile::GeometryTile(const OverscaledTileID& id_,
              obsolete,
              parameters.mode,
              parameters.pixelRatio,
-             parameters.debugOptions & MapDebugOptions::Collision),
+             parameters.debugOptions & MapDebugOptions::Collision,
+             parameters.supportsInstancing),
       fileSource(parameters.fileSource),
       glyphManager(parameters.glyphManager),
       imageManager(parameters.imageManager),
@@ -134,6 +136,9 @@ void GeometryTile::onLayout(LayoutResult result, const uint64_t resultCorrelatio
     
     latestFeatureIndex = std::move(result.featureIndex);
 
+    // The new buckets were laid out without feature state. Apply it before they're rendered.
+    updateBucketsFeatureState(featureStates);
+
     if (result.glyphAtlasImage) {
         glyphAtlasImage = std::move(*result.glyphAtlasImage);
     }
@@ -141,6 +146,7 @@ void GeometryTile::onLayout(LayoutResult result, const uint64_t resultCorrelatio
         iconAtlas = std::move(result.iconAtlas);
     }
 
+    observer->onTileLayout(*this, result.parseTime, result.layoutTime);
     observer->onTileChanged(*this);
 }
 
@@ -277,9 +283,34 @@ void GeometryTile::queryRenderedFeatures(
                               queryPadding * transformState.maxPitchScaleFactor());
 }
 
+void GeometryTile::prepareRenderedQuery(
+    RenderedFeatureQuery& query,
+    const GeometryCoordinates& queryGeometry,
+    const TransformState& transformState,
+    const std::vector<const RenderLayer*>& layers,
+    const mat4& projMatrix) {
+
+    if (!getData()) return;
+
+    const float queryPadding = getQueryPadding(layers);
+
+    mat4 posMatrix;
+    transformState.matrixFor(posMatrix, id.toUnwrapped());
+    matrix::multiply(posMatrix, projMatrix, posMatrix);
+
+    query.addTile(latestFeatureIndex,
+                  queryGeometry,
+                  posMatrix,
+                  util::tileSize * id.overscaleFactor(),
+                  std::pow(2, transformState.getZoom() - id.overscaledZ),
+                  id.toUnwrapped(),
+                  queryPadding * transformState.maxPitchScaleFactor());
+}
+
 void GeometryTile::querySourceFeatures(
     std::vector<Feature>& result,
-    const SourceQueryOptions& options) {
+    const SourceQueryOptions& options,
+    std::set<FeatureIdentifier>& seenIDs) {
 
     // Data not yet available, or tile is empty
     if (!getData()) {
@@ -298,17 +329,44 @@ void GeometryTile::querySourceFeatures(
         auto layer = getData()->getLayer(sourceLayer);
         
         if (layer) {
-            auto featureCount = layer->featureCount();
-            for (std::size_t i = 0; i < featureCount; i++) {
-                auto feature = layer->getFeature(i);
+            querySourceLayer(result, *layer, options, seenIDs);
+        }
+    }
+}
+
+void GeometryTile::setFeatureState(const LayerFeatureStates& states) {
+    // Changes hold the complete new state of each feature.
+    for (const auto& layerStates : states) {
+        for (const auto& state : layerStates.second) {
+            featureStates[layerStates.first][state.first] = state.second;
+        }
+    }
+
+    updateBucketsFeatureState(states);
+}
+
+void GeometryTile::updateBucketsFeatureState(const LayerFeatureStates& states) {
+    // Data not yet available, or tile is empty
+    if (!getData() || states.empty()) {
+        return;
+    }
 
-                // Apply filter, if any
-                if (options.filter && !(*options.filter)(style::expression::EvaluationContext { static_cast<float>(this->id.overscaledZ), feature.get() })) {
-                    continue;
-                }
+    for (auto& entry : layerIdToLayerRenderData) {
+        const auto& layerID = entry.first;
+        const auto& renderData = entry.second;
+        if (!renderData.bucket) {
+            continue;
+        }
 
-                result.push_back(convertFeature(*feature, id.canonical));
-            }
+        const auto& sourceLayer = renderData.layerProperties->baseImpl->sourceLayer;
+        const auto sourceLayerStates = states.find(sourceLayer);
+        if (sourceLayerStates == states.end() || sourceLayerStates->second.empty()) {
+            continue;
+        }
+
+        auto layer = getData()->getLayer(sourceLayer);
+        if (layer) {
+            renderData.bucket->update(sourceLayerStates->second, *layer, layerID);
         }
     }
 }
@@ -55,12 +55,22 @@ public:
             const RenderedQueryOptions& options,
             const mat4& projMatrix) override;
 
+    void prepareRenderedQuery(
+            RenderedFeatureQuery&,
+            const GeometryCoordinates& queryGeometry,
+            const TransformState&,
+            const std::vector<const RenderLayer*>& layers,
+            const mat4& projMatrix) override;
+
     void querySourceFeatures(
         std::vector<Feature>& result,
-        const SourceQueryOptions&) override;
+        const SourceQueryOptions&,
+        std::set<FeatureIdentifier>& seenIDs) override;
 
     float getQueryPadding(const std::vector<const RenderLayer*>&) override;
 
+    void setFeatureState(const LayerFeatureStates&) override;
+
     void cancel() override;
 
     class LayoutResult {
@@ -69,15 +79,22 @@ public:
         std::unique_ptr<FeatureIndex> featureIndex;
         optional<AlphaImage> glyphAtlasImage;
         ImageAtlas iconAtlas;
+        // CPU time the worker spent parsing features and laying out symbols.
+        Duration parseTime;
+        Duration layoutTime;
 
         LayoutResult(std::unordered_map<std::string, LayerRenderData> renderData_,
                      std::unique_ptr<FeatureIndex> featureIndex_,
                      optional<AlphaImage> glyphAtlasImage_,
-                     ImageAtlas iconAtlas_)
+                     ImageAtlas iconAtlas_,
+                     Duration parseTime_,
+                     Duration layoutTime_)
             : renderData(std::move(renderData_)),
               featureIndex(std::move(featureIndex_)),
               glyphAtlasImage(std::move(glyphAtlasImage_)),
-              iconAtlas(std::move(iconAtlas_)) {}
+              iconAtlas(std::move(iconAtlas_)),
+              parseTime(parseTime_),
+              layoutTime(layoutTime_) {}
     };
     void onLayout(LayoutResult, uint64_t correlationID);
 
@@ -102,6 +119,8 @@ protected:
 private:
     void markObsolete();
 
+    void updateBucketsFeatureState(const LayerFeatureStates&);
+
     // Used to signal the worker that it should abandon parsing this tile as soon as possible.
     std::atomic<bool> obsolete { false };
 
@@ -118,6 +137,10 @@ private:
     
     std::shared_ptr<FeatureIndex> latestFeatureIndex;
 
+    // All feature state applied to this tile so far. Buckets of a new layout are laid out
+    // without state, so it is applied to them as soon as they arrive.
+    LayerFeatureStates featureStates;
+
     optional<AlphaImage> glyphAtlasImage;
     ImageAtlas iconAtlas;
 
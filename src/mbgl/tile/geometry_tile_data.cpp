@@ -180,4 +180,29 @@ Feature convertFeature(const GeometryTileFeature& geometryTileFeature, const Can
     return feature;
 }
 
+Feature convertFeature(const GeometryTileFeature& geometryTileFeature,
+                       const CanonicalTileID& tileID,
+                       const optional<std::vector<std::string>>& properties,
+                       bool includeGeometry) {
+    if (!properties && includeGeometry) {
+        return convertFeature(geometryTileFeature, tileID);
+    }
+
+    Feature feature;
+    if (includeGeometry) {
+        feature.geometry = convertGeometry(geometryTileFeature, tileID);
+    }
+    if (properties) {
+        for (const auto& key : *properties) {
+            if (auto value = geometryTileFeature.getValue(key)) {
+                feature.properties.emplace(key, std::move(*value));
+            }
+        }
+    } else {
+        feature.properties = geometryTileFeature.getProperties();
+    }
+    feature.id = geometryTileFeature.getID();
+    return feature;
+}
+
 } // namespace mbgl
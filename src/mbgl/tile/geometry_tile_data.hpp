@@ -78,6 +78,14 @@ void limitHoles(GeometryCollection&, uint32_t maxHoles);
 // convert from GeometryTileFeature to Feature (eventually we should eliminate GeometryTileFeature)
 Feature convertFeature(const GeometryTileFeature&, const CanonicalTileID&);
 
+// Like the above, but only reads the given properties (or all of them, when not set), and leaves
+// the geometry empty unless `includeGeometry` is set. Decoding either isn't free, and queries
+// often only need the feature ID.
+Feature convertFeature(const GeometryTileFeature&,
+                       const CanonicalTileID&,
+                       const optional<std::vector<std::string>>& properties,
+                       bool includeGeometry);
+
 // Fix up possibly-non-V2-compliant polygon geometry using angus clipper.
 // The result is guaranteed to have correctly wound, strictly simple rings.
 GeometryCollection fixupPolygons(const GeometryCollection&);
@@ -34,7 +34,8 @@ GeometryTileWorker::GeometryTileWorker(ActorRef<GeometryTileWorker> self_,
                                        const std::atomic<bool>& obsolete_,
                                        const MapMode mode_,
                                        const float pixelRatio_,
-                                       const bool showCollisionBoxes_)
+                                       const bool showCollisionBoxes_,
+                                       const bool supportsInstancing_)
     : self(std::move(self_)),
       parent(std::move(parent_)),
       id(std::move(id_)),
@@ -42,7 +43,8 @@ GeometryTileWorker::GeometryTileWorker(ActorRef<GeometryTileWorker> self_,
       obsolete(obsolete_),
       mode(mode_),
       pixelRatio(pixelRatio_),
-      showCollisionBoxes(showCollisionBoxes_) {
+      showCollisionBoxes(showCollisionBoxes_),
+      supportsInstancing(supportsInstancing_) {
 }
 
 GeometryTileWorker::~GeometryTileWorker() = default;
@@ -318,6 +320,7 @@ void GeometryTileWorker::parse() {
     }
 
     MBGL_TIMING_START(watch)
+    const TimePoint parseStart = Clock::now();
 
     std::unordered_map<std::string, std::unique_ptr<SymbolLayout>> symbolLayoutMap;
 
@@ -346,7 +349,7 @@ void GeometryTileWorker::parse() {
         }
 
         const style::Layer::Impl& leaderImpl = *(group.at(0)->baseImpl);
-        BucketParameters parameters { id, mode, pixelRatio, leaderImpl.getTypeInfo() };
+        BucketParameters parameters { id, mode, pixelRatio, leaderImpl.getTypeInfo(), supportsInstancing };
 
         auto geometryLayer = (*data)->getLayer(leaderImpl.sourceLayer);
         if (!geometryLayer) {
@@ -383,7 +386,7 @@ void GeometryTileWorker::parse() {
                     continue;
 
                 GeometryCollection geometries = feature->getGeometries();
-                bucket->addFeature(*feature, geometries, {}, PatternLayerMap ());
+                bucket->addFeature(*feature, geometries, {}, PatternLayerMap (), i);
                 featureIndex->insert(geometries, i, sourceLayerID, leaderImpl.id);
             }
 
@@ -400,6 +403,8 @@ void GeometryTileWorker::parse() {
     requestNewGlyphs(glyphDependencies);
     requestNewImages(imageDependencies);
 
+    parseTime = Clock::now() - parseStart;
+
     MBGL_TIMING_FINISH(watch,
                        " Action: " << "Parsing," <<
                        " SourceID: " << sourceID.c_str() <<
@@ -427,6 +432,7 @@ void GeometryTileWorker::finalizeLayout() {
     }
     
     MBGL_TIMING_START(watch)
+    const TimePoint layoutStart = Clock::now();
     optional<AlphaImage> glyphAtlasImage;
     ImageAtlas iconAtlas = makeImageAtlas(imageMap, patternMap, versionMap);
     if (!layouts.empty()) {
@@ -464,8 +470,12 @@ void GeometryTileWorker::finalizeLayout() {
         std::move(renderData),
         std::move(featureIndex),
         std::move(glyphAtlasImage),
-        std::move(iconAtlas)
+        std::move(iconAtlas),
+        parseTime,
+        Clock::now() - layoutStart
     }, correlationID);
+
+    parseTime = Duration::zero();
 }
 
 } // namespace mbgl
@@ -35,7 +35,8 @@ public:
                        const std::atomic<bool>&,
                        const MapMode,
                        const float pixelRatio,
-                       const bool showCollisionBoxes_);
+                       const bool showCollisionBoxes_,
+                       const bool supportsInstancing_);
     ~GeometryTileWorker();
 
     void setLayers(std::vector<Immutable<style::LayerProperties>>, uint64_t correlationID);
@@ -98,7 +99,10 @@ private:
     ImageVersionMap versionMap;
     
     bool showCollisionBoxes;
+    const bool supportsInstancing;
     bool firstLoad = true;
+    // Time spent in the last parse(), reported together with the layout result.
+    Duration parseTime = Duration::zero();
 };
 
 } // namespace mbgl
@@ -122,4 +122,8 @@ void RasterDEMTile::setNecessity(TileNecessity necessity) {
     loader.setNecessity(necessity);
 }
 
+void RasterDEMTile::setRank(uint32_t rank) {
+    loader.setRank(rank);
+}
+
 } // namespace mbgl
@@ -78,4 +78,8 @@ void RasterTile::setNecessity(TileNecessity necessity) {
     loader.setNecessity(necessity);
 }
 
+void RasterTile::setRank(uint32_t rank) {
+    loader.setRank(rank);
+}
+
 } // namespace mbgl
@@ -23,6 +23,7 @@ public:
     ~RasterTile() override;
 
     void setNecessity(TileNecessity) final;
+    void setRank(uint32_t) final;
 
     void setError(std::exception_ptr);
     void setMetadata(optional<Timestamp> modified, optional<Timestamp> expires);
@@ -1,6 +1,8 @@
 #include <mbgl/tile/tile.hpp>
 #include <mbgl/tile/tile_observer.hpp>
 #include <mbgl/renderer/query.hpp>
+#include <mbgl/util/constants.hpp>
+#include <mbgl/util/intersection_tests.hpp>
 #include <mbgl/util/string.hpp>
 #include <mbgl/util/logging.hpp>
 
@@ -47,12 +49,78 @@ void Tile::queryRenderedFeatures(
         const RenderedQueryOptions&,
         const mat4&) {}
 
+void Tile::prepareRenderedQuery(
+        RenderedFeatureQuery&,
+        const GeometryCoordinates&,
+        const TransformState&,
+        const std::vector<const RenderLayer*>&,
+        const mat4&) {}
+
 float Tile::getQueryPadding(const std::vector<const RenderLayer*>&) {
     return 0;
 }
 
 void Tile::querySourceFeatures(
         std::vector<Feature>&,
-        const SourceQueryOptions&) {}
+        const SourceQueryOptions&,
+        std::set<FeatureIdentifier>&) {}
+
+static bool featureIntersects(const GeometryTileFeature& feature, const GeometryCoordinates& polygon) {
+    const GeometryCollection geometries = feature.getGeometries();
+    switch (feature.getType()) {
+    case FeatureType::Point:
+        return util::polygonIntersectsBufferedMultiPoint(polygon, geometries, 0);
+    case FeatureType::LineString:
+        return util::polygonIntersectsBufferedMultiLine(polygon, geometries, 0);
+    case FeatureType::Polygon:
+        return util::polygonIntersectsMultiPolygon(polygon, geometries);
+    default:
+        return false;
+    }
+}
+
+void Tile::querySourceLayer(std::vector<Feature>& result,
+                            const GeometryTileLayer& layer,
+                            const SourceQueryOptions& options,
+                            std::set<FeatureIdentifier>& seenIDs) const {
+    GeometryCoordinates boundsGeometry;
+    if (options.bounds) {
+        // Features are only decoded far enough to compare them with the bounds, in the
+        // coordinates of this tile. Bounds are given within -180 and 180 degrees of longitude,
+        // so they're compared with the copy of the tile in that world.
+        const UnwrappedTileID unwrapped(id.canonical.z, id.canonical.x, id.canonical.y);
+        const GeometryCoordinate nw = TileCoordinate::toGeometryCoordinate(unwrapped, TileCoordinate::fromLatLng(0, options.bounds->northwest()).p);
+        const GeometryCoordinate se = TileCoordinate::toGeometryCoordinate(unwrapped, TileCoordinate::fromLatLng(0, options.bounds->southeast()).p);
+        if (se.x < 0 || se.y < 0 || nw.x > util::EXTENT || nw.y > util::EXTENT) {
+            return;
+        }
+        boundsGeometry = { nw, { se.x, nw.y }, se, { nw.x, se.y }, nw };
+    }
+
+    const std::size_t featureCount = layer.featureCount();
+    for (std::size_t i = 0; i < featureCount; i++) {
+        auto feature = layer.getFeature(i);
+
+        const FeatureIdentifier featureID = options.deduplicate ? feature->getID() : NullValue();
+        if (!featureID.is<NullValue>() && seenIDs.count(featureID)) {
+            continue;
+        }
+
+        // Apply filter, if any
+        if (options.filter && !(*options.filter)(style::expression::EvaluationContext { static_cast<float>(id.overscaledZ), feature.get() })) {
+            continue;
+        }
+
+        if (options.bounds && !featureIntersects(*feature, boundsGeometry)) {
+            continue;
+        }
+
+        if (!featureID.is<NullValue>()) {
+            seenIDs.insert(featureID);
+        }
+
+        result.push_back(convertFeature(*feature, id.canonical, options.properties, options.geometry));
+    }
+}
 
 } // namespace mbgl
@@ -16,6 +16,7 @@
 #include <string>
 #include <memory>
 #include <functional>
+#include <set>
 #include <unordered_map>
 
 namespace mbgl {
@@ -25,6 +26,7 @@ class TransformState;
 class TileObserver;
 class RenderLayer;
 class RenderedQueryOptions;
+class RenderedFeatureQuery;
 class SourceQueryOptions;
 class CollisionIndex;
 
@@ -49,6 +51,9 @@ public:
 
     virtual void setNecessity(TileNecessity) {}
 
+    // Orders the tile's resource requests relative to those of other tiles; see Resource::rank.
+    virtual void setRank(uint32_t) {}
+
     // Mark this tile as no longer needed and cancel any pending work.
     virtual void cancel();
 
@@ -80,12 +85,27 @@ public:
             const RenderedQueryOptions& options,
             const mat4& projMatrix);
 
+    // Adds the feature index of this tile to a query that runs later, on another thread.
+    virtual void prepareRenderedQuery(
+            RenderedFeatureQuery&,
+            const GeometryCoordinates& queryGeometry,
+            const TransformState&,
+            const std::vector<const RenderLayer*>&,
+            const mat4& projMatrix);
+
+    // `seenIDs` holds the IDs of features already returned from other tiles, which are skipped
+    // when deduplicating.
     virtual void querySourceFeatures(
             std::vector<Feature>& result,
-            const SourceQueryOptions&);
+            const SourceQueryOptions&,
+            std::set<FeatureIdentifier>& seenIDs);
 
     virtual float getQueryPadding(const std::vector<const RenderLayer*>&);
 
+    // Updates the paint properties of the buckets of this tile that depend on the state of the
+    // given features, keyed by source layer.
+    virtual void setFeatureState(const LayerFeatureStates&) {}
+
     void setTriedCache();
 
     // Returns true when the tile source has received a first response, regardless of whether a load
@@ -138,7 +158,16 @@ public:
     optional<Timestamp> modified;
     optional<Timestamp> expires;
 
+    // The version of the source's feature state that was last applied to this tile.
+    uint64_t featureStateVersion = 0;
+
 protected:
+    // Appends the features of a layer of this tile's data that match the options.
+    void querySourceLayer(std::vector<Feature>& result,
+                          const GeometryTileLayer&,
+                          const SourceQueryOptions&,
+                          std::set<FeatureIdentifier>& seenIDs) const;
+
     bool triedOptional = false;
     bool renderable = false;
     bool pending = false;
@@ -33,6 +33,8 @@ public:
         }
     }
 
+    void setRank(uint32_t);
+
 private:
     // called when the tile is one of the ideal tiles that we want to show definitely. the tile source
     // should try to make every effort (e.g. fetch from internet, or revalidate existing resources).
@@ -93,6 +93,16 @@ void TileLoader<T>::makeOptional() {
     }
 }
 
+template <typename T>
+void TileLoader<T>::setRank(uint32_t rank) {
+    if (rank != resource.rank) {
+        resource.rank = rank;
+        if (request) {
+            request->setRank(rank);
+        }
+    }
+}
+
 template <typename T>
 void TileLoader<T>::loadedData(const Response& res) {
     if (res.error && res.error->reason != Response::Error::Reason::NotFound) {
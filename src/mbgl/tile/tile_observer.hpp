@@ -1,5 +1,7 @@
 #pragma once
 
+#include <mbgl/util/chrono.hpp>
+
 #include <exception>
 
 namespace mbgl {
@@ -12,6 +14,8 @@ public:
 
     virtual void onTileChanged(Tile&) {}
     virtual void onTileError(Tile&, std::exception_ptr) {}
+    // Worker finished parsing and laying out the tile in the given CPU time.
+    virtual void onTileLayout(Tile&, Duration /* parseTime */, Duration /* layoutTime */) {}
 };
 
 } // namespace mbgl
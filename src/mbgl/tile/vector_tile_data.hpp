@@ -5,6 +5,7 @@
 
 #include <unordered_map>
 #include <functional>
+#include <mutex>
 #include <utility>
 
 namespace mbgl {
@@ -47,7 +48,8 @@ public:
 
 private:
     std::shared_ptr<const std::string> data;
-    mutable bool parsed = false;
+    // Feature queries may read the layers from other threads.
+    mutable std::once_flag parsed;
     mutable std::map<std::string, const protozero::data_view> layers;
 };
 
@@ -0,0 +1,552 @@
+#include <mbgl/util/geojson_parser.hpp>
+#include <mbgl/util/string.hpp>
+
+#include <rapidjson/reader.h>
+#include <rapidjson/error/en.h>
+
+#include <stdexcept>
+#include <vector>
+
+namespace mbgl {
+namespace util {
+
+namespace {
+
+using Geometry = Feature::geometry_type;
+using Point = mapbox::geometry::point<double>;
+
+std::runtime_error error(const std::string& message) {
+    return std::runtime_error(message);
+}
+
+// A GeoJSON object being read. Its members may come in any order, so that it can only be told
+// what the object is once it ends.
+struct Object {
+    // The member whose value is being read.
+    std::string key;
+
+    optional<std::string> type;
+    optional<FeatureIdentifier> id;
+    optional<PropertyMap> properties;
+    optional<Geometry> geometry;
+
+    // Coordinates are kept as a tape of array delimiters and numbers until the type of the
+    // geometry is known.
+    bool hasCoordinates = false;
+    std::string tape;
+    std::vector<double> numbers;
+
+    bool hasGeometries = false;
+    mapbox::geometry::geometry_collection<double> geometries;
+
+    bool hasFeatures = false;
+    FeatureCollection features;
+};
+
+// Reads the coordinates of a geometry back from their tape.
+class CoordinatesReader {
+public:
+    CoordinatesReader(const Object& object)
+        : tape(object.tape),
+          numbers(object.numbers) {
+    }
+
+    Point point() {
+        expect('[');
+        Point result;
+        std::size_t count = 0;
+        while (position < tape.size() && tape[position] == 'n') {
+            if (count == 0) {
+                result.x = numbers[number];
+            } else if (count == 1) {
+                result.y = numbers[number];
+            }
+            count++;
+            number++;
+            position++;
+        }
+        expect(']');
+
+        if (count < 2) {
+            throw error("coordinates array must have at least 2 numbers");
+        }
+        return result;
+    }
+
+    template <class T, class Element>
+    T array(Element element) {
+        expect('[');
+        T result;
+        while (position < tape.size() && tape[position] != ']') {
+            result.push_back(element());
+        }
+        expect(']');
+        return result;
+    }
+
+    void end() {
+        if (position != tape.size()) {
+            throw error("coordinates must be arrays of numbers");
+        }
+    }
+
+private:
+    void expect(char token) {
+        if (position >= tape.size() || tape[position] != token) {
+            throw error("coordinates must be arrays of numbers");
+        }
+        position++;
+    }
+
+    const std::string& tape;
+    const std::vector<double>& numbers;
+    std::size_t position = 0;
+    std::size_t number = 0;
+};
+
+Geometry toGeometry(Object& object) {
+    if (!object.type) {
+        throw error("Geometry must have a type property");
+    }
+    const std::string& type = *object.type;
+
+    if (type == "GeometryCollection") {
+        if (!object.hasGeometries) {
+            throw error("GeometryCollection must have a geometries property");
+        }
+        return std::move(object.geometries);
+    }
+
+    if (!object.hasCoordinates) {
+        throw error("Geometry must have a coordinates property");
+    }
+
+    CoordinatesReader reader(object);
+    const auto point = [&] { return reader.point(); };
+    const auto line = [&] { return reader.array<mapbox::geometry::line_string<double>>(point); };
+    const auto ring = [&] { return reader.array<mapbox::geometry::linear_ring<double>>(point); };
+    const auto polygon = [&] { return reader.array<mapbox::geometry::polygon<double>>(ring); };
+
+    Geometry geometry;
+    if (type == "Point") {
+        geometry = point();
+    } else if (type == "MultiPoint") {
+        geometry = reader.array<mapbox::geometry::multi_point<double>>(point);
+    } else if (type == "LineString") {
+        geometry = line();
+    } else if (type == "MultiLineString") {
+        geometry = reader.array<mapbox::geometry::multi_line_string<double>>(line);
+    } else if (type == "Polygon") {
+        geometry = polygon();
+    } else if (type == "MultiPolygon") {
+        geometry = reader.array<mapbox::geometry::multi_polygon<double>>(polygon);
+    } else {
+        throw error(type + " not yet implemented");
+    }
+
+    reader.end();
+    return geometry;
+}
+
+Feature toFeature(Object& object) {
+    if (!object.type) {
+        throw error("Feature must have a type property");
+    }
+    if (*object.type != "Feature") {
+        throw error("Feature type must be Feature");
+    }
+    if (!object.geometry) {
+        throw error("Feature must have a geometry property");
+    }
+
+    Feature feature { std::move(*object.geometry) };
+    if (object.id) {
+        feature.id = std::move(*object.id);
+    }
+    if (object.properties) {
+        feature.properties = std::move(*object.properties);
+    }
+    return feature;
+}
+
+GeoJSON toGeoJSON(Object& object) {
+    if (!object.type) {
+        throw error("GeoJSON must have a type property");
+    }
+
+    if (*object.type == "FeatureCollection") {
+        if (!object.hasFeatures) {
+            throw error("FeatureCollection must have features property");
+        }
+        return std::move(object.features);
+    }
+    if (*object.type == "Feature") {
+        return toFeature(object);
+    }
+    return toGeometry(object);
+}
+
+FeatureIdentifier toIdentifier(Value&& value) {
+    return value.match(
+        [] (uint64_t id) -> FeatureIdentifier { return id; },
+        [] (int64_t id) -> FeatureIdentifier { return id; },
+        [] (double id) -> FeatureIdentifier { return id; },
+        [] (std::string& id) -> FeatureIdentifier { return std::move(id); },
+        [] (NullValue) -> FeatureIdentifier { return NullValue(); },
+        [] (const auto&) -> FeatureIdentifier {
+            throw error("Feature id must be a string or number");
+        });
+}
+
+// Receives the events of the SAX parser. What an event means depends on the part of the
+// document being read, which is tracked with a stack of frames. Errors are thrown, which
+// rapidjson's reader is safe against.
+class Handler {
+public:
+    bool Null() { return scalar(NullValue()); }
+    bool Bool(bool value) { return scalar(value); }
+    bool Int(int value) { return Int64(value); }
+    bool Uint(unsigned value) { return scalar(uint64_t(value)); }
+    bool Int64(int64_t value) { return value < 0 ? scalar(value) : scalar(uint64_t(value)); }
+    bool Uint64(uint64_t value) { return scalar(value); }
+    bool Double(double value) { return scalar(value); }
+    bool RawNumber(const char*, rapidjson::SizeType, bool) { return false; }
+
+    bool String(const char* string, rapidjson::SizeType length, bool) {
+        return scalar(std::string(string, length));
+    }
+
+    bool Key(const char* string, rapidjson::SizeType length, bool) {
+        switch (frames.back()) {
+        case Frame::Object:
+            objects.back().key.assign(string, length);
+            break;
+        case Frame::Properties:
+            values.back().key.assign(string, length);
+            break;
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool StartObject() {
+        if (frames.empty()) {
+            frames.push_back(Frame::Object);
+            objects.emplace_back();
+            return true;
+        }
+
+        switch (frames.back()) {
+        case Frame::Object: {
+            const std::string& key = objects.back().key;
+            if (key == "geometry") {
+                frames.push_back(Frame::Object);
+                objects.emplace_back();
+            } else if (key == "properties") {
+                frames.push_back(Frame::Properties);
+                values.emplace_back(true);
+            } else if (isMember(key)) {
+                throwInvalidMember(key);
+            } else {
+                frames.push_back(Frame::Skip);
+                skipDepth = 1;
+            }
+            break;
+        }
+        case Frame::Features:
+        case Frame::Geometries:
+            frames.push_back(Frame::Object);
+            objects.emplace_back();
+            break;
+        case Frame::Coordinates:
+            throw error("coordinates must be arrays of numbers");
+        case Frame::Properties:
+            values.emplace_back(true);
+            break;
+        case Frame::Skip:
+            skipDepth++;
+            break;
+        }
+        return true;
+    }
+
+    bool EndObject(rapidjson::SizeType) {
+        switch (frames.back()) {
+        case Frame::Object: {
+            frames.pop_back();
+            Object object = std::move(objects.back());
+            objects.pop_back();
+            endObject(object);
+            break;
+        }
+        case Frame::Properties:
+            endContainer();
+            break;
+        case Frame::Skip:
+            endSkipped();
+            break;
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool StartArray() {
+        if (frames.empty()) {
+            throw error("GeoJSON must be an object");
+        }
+
+        switch (frames.back()) {
+        case Frame::Object: {
+            Object& object = objects.back();
+            if (object.key == "features") {
+                object.hasFeatures = true;
+                frames.push_back(Frame::Features);
+            } else if (object.key == "geometries") {
+                object.hasGeometries = true;
+                frames.push_back(Frame::Geometries);
+            } else if (object.key == "coordinates") {
+                object.hasCoordinates = true;
+                object.tape += '[';
+                frames.push_back(Frame::Coordinates);
+                coordinatesDepth = 1;
+            } else if (isMember(object.key)) {
+                throwInvalidMember(object.key);
+            } else {
+                frames.push_back(Frame::Skip);
+                skipDepth = 1;
+            }
+            break;
+        }
+        case Frame::Features:
+            throw error("Feature must be an object");
+        case Frame::Geometries:
+            throw error("Geometry must be an object");
+        case Frame::Coordinates:
+            objects.back().tape += '[';
+            coordinatesDepth++;
+            break;
+        case Frame::Properties:
+            values.emplace_back(false);
+            break;
+        case Frame::Skip:
+            skipDepth++;
+            break;
+        }
+        return true;
+    }
+
+    bool EndArray(rapidjson::SizeType) {
+        switch (frames.back()) {
+        case Frame::Features:
+        case Frame::Geometries:
+            frames.pop_back();
+            break;
+        case Frame::Coordinates:
+            objects.back().tape += ']';
+            if (--coordinatesDepth == 0) {
+                frames.pop_back();
+            }
+            break;
+        case Frame::Properties:
+            endContainer();
+            break;
+        case Frame::Skip:
+            endSkipped();
+            break;
+        default:
+            break;
+        }
+        return true;
+    }
+
+    GeoJSON getResult() {
+        if (!result) {
+            throw error("GeoJSON must be an object");
+        }
+        return std::move(*result);
+    }
+
+private:
+    enum class Frame : uint8_t {
+        Object,
+        Features,
+        Geometries,
+        Coordinates,
+        Properties,
+        Skip
+    };
+
+    // An array or object within the properties of a feature.
+    struct Container {
+        Container(bool isObject_) : isObject(isObject_) {}
+
+        bool isObject;
+        std::string key;
+        PropertyMap object;
+        std::vector<Value> array;
+    };
+
+    static bool isMember(const std::string& key) {
+        return key == "type" || key == "id" || key == "geometry" || key == "properties" ||
+               key == "coordinates" || key == "features" || key == "geometries";
+    }
+
+    [[noreturn]] static void throwInvalidMember(const std::string& key) {
+        if (key == "type") {
+            throw error("GeoJSON type must be a string");
+        } else if (key == "id") {
+            throw error("Feature id must be a string or number");
+        } else if (key == "geometry") {
+            throw error("Geometry must be an object");
+        } else if (key == "properties") {
+            throw error("properties must be an object");
+        } else if (key == "coordinates") {
+            throw error("coordinates must be arrays of numbers");
+        } else if (key == "features") {
+            throw error("FeatureCollection features property must be an array");
+        } else {
+            throw error("GeometryCollection geometries property must be an array");
+        }
+    }
+
+    bool scalar(Value value) {
+        if (frames.empty()) {
+            throw error("GeoJSON must be an object");
+        }
+
+        switch (frames.back()) {
+        case Frame::Object:
+            member(std::move(value));
+            break;
+        case Frame::Features:
+            throw error("Feature must be an object");
+        case Frame::Geometries:
+            throw error("Geometry must be an object");
+        case Frame::Coordinates:
+            coordinate(value);
+            break;
+        case Frame::Properties:
+            add(std::move(value));
+            break;
+        case Frame::Skip:
+            break;
+        }
+        return true;
+    }
+
+    void member(Value&& value) {
+        Object& object = objects.back();
+        const std::string& key = object.key;
+
+        if (key == "type") {
+            if (!value.is<std::string>()) {
+                throwInvalidMember(key);
+            }
+            object.type = std::move(value.get<std::string>());
+        } else if (key == "id") {
+            object.id = toIdentifier(std::move(value));
+        } else if (key == "geometry" || key == "properties") {
+            if (!value.is<NullValue>()) {
+                throwInvalidMember(key);
+            }
+            if (key == "geometry") {
+                object.geometry = Geometry { mapbox::geometry::empty() };
+            }
+        } else if (key == "coordinates") {
+            object.hasCoordinates = true;
+            coordinate(value);
+        } else if (isMember(key)) {
+            throwInvalidMember(key);
+        }
+    }
+
+    void coordinate(const Value& value) {
+        Object& object = objects.back();
+        object.tape += 'n';
+        object.numbers.push_back(value.match(
+            [] (uint64_t number) { return double(number); },
+            [] (int64_t number) { return double(number); },
+            [] (double number) { return number; },
+            [] (const auto&) -> double {
+                throw error("coordinates must be arrays of numbers");
+            }));
+    }
+
+    void add(Value&& value) {
+        Container& container = values.back();
+        if (container.isObject) {
+            container.object.emplace(container.key, std::move(value));
+        } else {
+            container.array.push_back(std::move(value));
+        }
+    }
+
+    void endContainer() {
+        Container container = std::move(values.back());
+        values.pop_back();
+
+        if (values.empty()) {
+            // The end of the properties of the feature.
+            frames.pop_back();
+            objects.back().properties = std::move(container.object);
+        } else if (container.isObject) {
+            add(Value(std::move(container.object)));
+        } else {
+            add(Value(std::move(container.array)));
+        }
+    }
+
+    void endSkipped() {
+        if (--skipDepth == 0) {
+            frames.pop_back();
+        }
+    }
+
+    void endObject(Object& object) {
+        if (frames.empty()) {
+            result = toGeoJSON(object);
+            return;
+        }
+
+        switch (frames.back()) {
+        case Frame::Features:
+            objects.back().features.push_back(toFeature(object));
+            break;
+        case Frame::Geometries:
+            objects.back().geometries.push_back(toGeometry(object));
+            break;
+        default:
+            // The geometry of a feature.
+            objects.back().geometry = toGeometry(object);
+            break;
+        }
+    }
+
+    std::vector<Frame> frames;
+    std::vector<Object> objects;
+    std::vector<Container> values;
+    std::size_t coordinatesDepth = 0;
+    std::size_t skipDepth = 0;
+    optional<GeoJSON> result;
+};
+
+} // namespace
+
+GeoJSON parseGeoJSON(const std::string& json) {
+    Handler handler;
+    rapidjson::Reader reader;
+    rapidjson::StringStream stream(json.c_str());
+
+    const rapidjson::ParseResult result = reader.Parse(stream, handler);
+    if (result.IsError()) {
+        throw error(std::string{ rapidjson::GetParseError_En(result.Code()) } + " at offset " +
+                    util::toString(result.Offset()));
+    }
+
+    return handler.getResult();
+}
+
+} // namespace util
+} // namespace mbgl
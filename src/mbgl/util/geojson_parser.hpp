@@ -0,0 +1,17 @@
+#pragma once
+
+#include <mbgl/util/geojson.hpp>
+
+#include <string>
+
+namespace mbgl {
+namespace util {
+
+// Parses GeoJSON with a SAX parser, building the features while reading the text instead of
+// building a JSON document first. Peak memory use stays close to the size of the result, which
+// matters for large sources. Accepts the same input as mapbox::geojson::convert(), and throws
+// std::runtime_error for invalid input.
+GeoJSON parseGeoJSON(const std::string&);
+
+} // namespace util
+} // namespace mbgl
@@ -3,15 +3,23 @@
 #include <mbgl/test/map_adapter.hpp>
 
 #include <mbgl/annotation/annotation.hpp>
+#include <mbgl/annotation/annotation_manager.hpp>
+#include <mbgl/annotation/annotation_tile.hpp>
 #include <mbgl/style/style.hpp>
 #include <mbgl/style/image.hpp>
 #include <mbgl/map/map_options.hpp>
+#include <mbgl/map/transform_state.hpp>
 #include <mbgl/util/io.hpp>
 #include <mbgl/util/run_loop.hpp>
 #include <mbgl/util/color.hpp>
 #include <mbgl/renderer/renderer.hpp>
+#include <mbgl/renderer/image_manager.hpp>
+#include <mbgl/renderer/tile_parameters.hpp>
+#include <mbgl/text/glyph_manager.hpp>
 #include <mbgl/gfx/headless_frontend.hpp>
 
+#include <algorithm>
+
 using namespace mbgl;
 
 namespace {
@@ -170,6 +178,78 @@ TEST(Annotations, AddMultiple) {
     test.checkRendering("add_multiple");
 }
 
+TEST(Annotations, UpdateSymbolAnnotationGeometryBatchedRebuildsTouchedTiles) {
+    util::RunLoop loop;
+    std::shared_ptr<FileSource> fileSource = std::make_shared<StubFileSource>();
+    style::Style style { *fileSource, 1 };
+    AnnotationManager annotationManager { style };
+    ImageManager imageManager;
+    GlyphManager glyphManager;
+    TransformState transformState;
+    TileParameters tileParameters {
+        1.0,
+        MapDebugOptions(),
+        transformState,
+        fileSource,
+        MapMode::Continuous,
+        annotationManager,
+        imageManager,
+        glyphManager,
+        0,
+        false
+    };
+
+    AnnotationID left = annotationManager.addAnnotation(SymbolAnnotation { Point<double> { -90, 45 }, "default_marker" });
+    AnnotationID right = annotationManager.addAnnotation(SymbolAnnotation { Point<double> { 90, 45 }, "default_marker" });
+    annotationManager.updateData();
+
+    // The points are in the two northern tiles at zoom level 1.
+    std::vector<std::unique_ptr<AnnotationTile>> tiles;
+    for (uint32_t y = 0; y < 2; ++y) {
+        for (uint32_t x = 0; x < 2; ++x) {
+            tiles.push_back(std::make_unique<AnnotationTile>(OverscaledTileID(1, x, y), tileParameters));
+            tiles.back()->setLayers({});
+        }
+    }
+
+    auto complete = [&] {
+        return std::all_of(tiles.begin(), tiles.end(), [] (const auto& tile) { return tile->isComplete(); });
+    };
+    while (!complete()) {
+        loop.runOnce();
+    }
+
+    // Only the tile of the moved point gets new data.
+    annotationManager.updateAnnotations({
+        { left, SymbolAnnotation { Point<double> { -100, 45 }, "default_marker" } },
+        { right, SymbolAnnotation { Point<double> { 90, 45 }, "default_marker" } }
+    });
+    annotationManager.updateData();
+    EXPECT_FALSE(tiles[0]->isComplete());
+    EXPECT_TRUE(tiles[1]->isComplete());
+    EXPECT_TRUE(tiles[2]->isComplete());
+    EXPECT_TRUE(tiles[3]->isComplete());
+
+    while (!complete()) {
+        loop.runOnce();
+    }
+}
+
+TEST(Annotations, AddMultipleBatched) {
+    AnnotationTest test;
+
+    test.map.getStyle().loadJSON(util::read_file("test/fixtures/api/empty.json"));
+    test.map.addAnnotationImage(namedMarker("default_marker"));
+    auto points = test.map.addAnnotations({
+        SymbolAnnotation { Point<double> { -10, 0 }, "default_marker" },
+        SymbolAnnotation { Point<double> { 10, 0 }, "default_marker" }
+    });
+
+    EXPECT_EQ(2u, points.size());
+    EXPECT_NE(points[0], points[1]);
+    test.checkRendering("add_multiple");
+}
+
 TEST(Annotations, NonImmediateAdd) {
     AnnotationTest test;
 
@@ -198,6 +278,24 @@ TEST(Annotations, UpdateSymbolAnnotationGeometry) {
     test.checkRendering("update_point");
 }
 
+TEST(Annotations, UpdateSymbolAnnotationGeometryBatched) {
+    AnnotationTest test;
+
+    test.map.getStyle().loadJSON(util::read_file("test/fixtures/api/empty.json"));
+    test.map.addAnnotationImage(namedMarker("default_marker"));
+    AnnotationID left = test.map.addAnnotation(SymbolAnnotation { Point<double> { 0, 0 }, "default_marker" });
+    AnnotationID right = test.map.addAnnotation(SymbolAnnotation { Point<double> { 10, 0 }, "default_marker" });
+
+    test.frontend.render(test.map);
+
+    // Only the tiles of the moved point change.
+    test.map.updateAnnotations({
+        { left, SymbolAnnotation { Point<double> { -10, 0 }, "default_marker" } },
+        { right, SymbolAnnotation { Point<double> { 10, 0 }, "default_marker" } }
+    });
+    test.checkRendering("add_multiple");
+}
+
 TEST(Annotations, UpdateSymbolAnnotationIcon) {
     AnnotationTest test;
 
@@ -293,6 +391,22 @@ TEST(Annotations, RemovePoint) {
     test.checkRendering("remove_point");
 }
 
+TEST(Annotations, RemoveMultipleBatched) {
+    AnnotationTest test;
+
+    test.map.getStyle().loadJSON(util::read_file("test/fixtures/api/empty.json"));
+    test.map.addAnnotationImage(namedMarker("default_marker"));
+    auto points = test.map.addAnnotations({
+        SymbolAnnotation { Point<double> { -10, 0 }, "default_marker" },
+        SymbolAnnotation { Point<double> { 10, 0 }, "default_marker" }
+    });
+
+    test.frontend.render(test.map);
+
+    test.map.removeAnnotations(points);
+    test.checkRendering("remove_point");
+}
+
 TEST(Annotations, RemoveShape) {
     AnnotationTest test;
 
@@ -82,6 +82,23 @@ TEST(Query, QueryRenderedFeatures) {
     EXPECT_EQ(features2.size(), 0u);
 }
 
+TEST(Query, QueryRenderedFeaturesAsync) {
+    QueryTest test;
+
+    auto zz = test.map.pixelForLatLng({ 0, 0 });
+    auto expected = test.frontend.getRenderer()->queryRenderedFeatures(zz, {{{ "layer1", "layer2" }}, {}});
+
+    std::vector<Feature> features;
+    test.frontend.getRenderer()->queryRenderedFeatures(zz, {{{ "layer1", "layer2" }}, {}}, [&](std::vector<Feature> result) {
+        features = std::move(result);
+        test.loop.stop();
+    });
+    test.loop.run();
+
+    EXPECT_EQ(features.size(), 2u);
+    EXPECT_EQ(features, expected);
+}
+
 TEST(Query, QueryRenderedFeaturesFilterLayer) {
     QueryTest test;
 
@@ -119,6 +136,23 @@ TEST(Query, QueryRenderedFeaturesFilter) {
     EXPECT_EQ(features3.size(), 1u);
 }
 
+TEST(Query, QueryRenderedFeaturesProjection) {
+    using namespace mbgl::style::expression::dsl;
+
+    QueryTest test;
+    auto zz = test.map.pixelForLatLng({ 0, 0 });
+
+    RenderedQueryOptions options({}, { Filter(eq(get("key1"), literal("value1"))) });
+    options.properties = std::vector<std::string>{ "key1" };
+    options.geometry = false;
+
+    auto features = test.frontend.getRenderer()->queryRenderedFeatures(zz, options);
+    ASSERT_EQ(features.size(), 1u);
+    EXPECT_EQ(features[0].properties.size(), 1u);
+    EXPECT_EQ(features[0].properties.at("key1"), Value("value1"s));
+    EXPECT_TRUE(features[0].geometry.is<mapbox::geometry::empty>());
+}
+
 TEST(Query, QuerySourceFeatures) {
     QueryTest test;
 
@@ -160,6 +194,44 @@ TEST(Query, QuerySourceFeaturesFilter) {
     EXPECT_EQ(features3.size(), 1u);
 }
 
+TEST(Query, QuerySourceFeaturesBounds) {
+    QueryTest test;
+
+    SourceQueryOptions options;
+    options.bounds = LatLngBounds::hull({ -10, -10 }, { 10, 10 });
+    auto features1 = test.frontend.getRenderer()->querySourceFeatures("source4", options);
+    EXPECT_EQ(features1.size(), 1u);
+
+    options.bounds = LatLngBounds::hull({ 20, 20 }, { 30, 30 });
+    auto features2 = test.frontend.getRenderer()->querySourceFeatures("source4", options);
+    EXPECT_EQ(features2.size(), 0u);
+
+    // Tiles of another copy of the world are compared with the bounds as if they were in this one.
+    test.map.jumpTo(CameraOptions().withCenter(LatLng { 0, 360 }));
+    test.frontend.render(test.map);
+
+    options.bounds = LatLngBounds::hull({ -10, -10 }, { 10, 10 });
+    auto features3 = test.frontend.getRenderer()->querySourceFeatures("source4", options);
+    EXPECT_EQ(features3.size(), 1u);
+}
+
+TEST(Query, QuerySourceFeaturesDeduplicate) {
+    QueryTest test;
+
+    // The feature lies on the corner of the four tiles at zoom 1.
+    test.map.jumpTo(CameraOptions().withCenter(LatLng { 0, 0 }).withZoom(1.0));
+    test.frontend.render(test.map);
+
+    auto features1 = test.frontend.getRenderer()->querySourceFeatures("source4");
+    EXPECT_GT(features1.size(), 1u);
+
+    SourceQueryOptions options;
+    options.deduplicate = true;
+    auto features2 = test.frontend.getRenderer()->querySourceFeatures("source4", options);
+    ASSERT_EQ(features2.size(), 1u);
+    EXPECT_EQ(features2[0].id, FeatureIdentifier("feature1"s));
+}
+
 TEST(Query, QueryFeatureExtensionsInvalidExtension) {
     QueryTest test;
 
@@ -47,12 +47,12 @@ TEST(Buckets, CircleBucket) {
     gfx::BackendScope scope { backend };
 
     gl::Context context{ backend };
-    CircleBucket bucket { { {0, 0, 0}, MapMode::Static, 1.0, nullptr }, {} };
+    CircleBucket bucket { { {0, 0, 0}, MapMode::Static, 1.0, nullptr, false }, {} };
     ASSERT_FALSE(bucket.hasData());
     ASSERT_FALSE(bucket.needsUpload());
 
     GeometryCollection point { { { 0, 0 } } };
-    bucket.addFeature(StubGeometryTileFeature { {}, FeatureType::Point, point, properties }, point, {}, PatternLayerMap());
+    bucket.addFeature(StubGeometryTileFeature { {}, FeatureType::Point, point, properties }, point, {}, PatternLayerMap(), 0);
     ASSERT_TRUE(bucket.hasData());
     ASSERT_TRUE(bucket.needsUpload());
 
@@ -63,6 +63,24 @@ TEST(Buckets, CircleBucket) {
     ASSERT_FALSE(bucket.needsUpload());
 }
 
+TEST(Buckets, CircleBucketInstanced) {
+    CircleBucket bucket { { {0, 0, 0}, MapMode::Static, 1.0, nullptr, true }, {} };
+    ASSERT_FALSE(bucket.hasData());
+
+    GeometryCollection points { { { 0, 0 } }, { { 10, 10 } } };
+    bucket.addFeature(StubGeometryTileFeature { {}, FeatureType::Point, points, properties }, points, {}, PatternLayerMap(), 0);
+    ASSERT_TRUE(bucket.hasData());
+
+    // All circles share one quad and only store their center.
+    EXPECT_EQ(4u, bucket.quadVertices.elements());
+    EXPECT_EQ(6u, bucket.triangles.elements());
+    EXPECT_EQ(2u, bucket.instanceVertices.elements());
+    EXPECT_EQ(0u, bucket.vertices.elements());
+    EXPECT_TRUE(bucket.segments.empty());
+    ASSERT_EQ(1u, bucket.instancedSegments.size());
+    EXPECT_EQ(6u, bucket.instancedSegments[0].indexLength);
+}
+
 TEST(Buckets, FillBucket) {
     gl::HeadlessBackend backend({ 512, 256 });
     gfx::BackendScope scope { backend };
@@ -74,7 +92,7 @@ TEST(Buckets, FillBucket) {
     ASSERT_FALSE(bucket.needsUpload());
 
     GeometryCollection polygon { { { 0, 0 }, { 0, 1 }, { 1, 1 } } };
-    bucket.addFeature(StubGeometryTileFeature { {}, FeatureType::Polygon, polygon, properties }, polygon, {}, PatternLayerMap());
+    bucket.addFeature(StubGeometryTileFeature { {}, FeatureType::Polygon, polygon, properties }, polygon, {}, PatternLayerMap(), 0);
     ASSERT_TRUE(bucket.hasData());
     ASSERT_TRUE(bucket.needsUpload());
 
@@ -96,11 +114,11 @@ TEST(Buckets, LineBucket) {
 
     // Ignore invalid feature type.
     GeometryCollection point { { { 0, 0 } } };
-    bucket.addFeature(StubGeometryTileFeature { {}, FeatureType::Point, point, properties }, point, {}, PatternLayerMap());
+    bucket.addFeature(StubGeometryTileFeature { {}, FeatureType::Point, point, properties }, point, {}, PatternLayerMap(), 0);
     ASSERT_FALSE(bucket.hasData());
 
     GeometryCollection line { { { 0, 0 }, { 1, 1 } } };
-    bucket.addFeature(StubGeometryTileFeature { {}, FeatureType::LineString, line, properties }, line, {}, PatternLayerMap());
+    bucket.addFeature(StubGeometryTileFeature { {}, FeatureType::LineString, line, properties }, line, {}, PatternLayerMap(), 0);
     ASSERT_TRUE(bucket.hasData());
     ASSERT_TRUE(bucket.needsUpload());
 
@@ -131,7 +149,7 @@ TEST(Buckets, SymbolBucket) {
 
     // SymbolBucket::addFeature() is a no-op.
     GeometryCollection point { { { 0, 0 } } };
-    bucket.addFeature(StubGeometryTileFeature { {}, FeatureType::Point, point, properties }, point, {}, PatternLayerMap());
+    bucket.addFeature(StubGeometryTileFeature { {}, FeatureType::Point, point, properties }, point, {}, PatternLayerMap(), 0);
     ASSERT_FALSE(bucket.hasData());
     ASSERT_FALSE(bucket.needsUpload());
 
@@ -116,3 +116,51 @@ TEST(GLContextMode, Shared) {
 
     test::checkImage("test/fixtures/shared_context", frontend.render(map), 0.5, 0.1);
 }
+
+TEST(GLContextMode, ProgramChangesPerLayer) {
+    util::RunLoop loop;
+
+    HeadlessFrontend frontend { { 256, 256 }, 1 };
+
+    Map map(frontend, MapObserver::nullObserver(),
+            MapOptions().withMapMode(MapMode::Static).withSize(frontend.getSize()),
+            ResourceOptions().withCachePath(":memory:").withAssetPath("test/fixtures/api/assets"));
+    map.getStyle().loadJSON(R"STYLE({
+      "version": 8,
+      "sources": {
+        "world": {
+          "type": "geojson",
+          "data": {
+            "type": "Polygon",
+            "coordinates": [[[-180, -89], [180, -89], [180, 89], [-180, 89], [-180, -89]]]
+          }
+        }
+      },
+      "layers": [{
+        "id": "fill",
+        "type": "fill",
+        "source": "world",
+        "paint": {
+          "fill-color": "blue",
+          "fill-opacity": 0.5
+        }
+      }]
+    })STYLE");
+
+    gfx::BackendScope scope { *frontend.getBackend() };
+    auto& context = static_cast<gl::Context&>(frontend.getBackend()->getContext());
+
+    auto programChanges = [&] (double zoom) {
+        map.jumpTo(CameraOptions().withCenter(LatLng { 0, 0 }).withZoom(zoom));
+        const std::size_t before = context.program.getIssuedChanges();
+        frontend.render(map);
+        return context.program.getIssuedChanges() - before;
+    };
+
+    // The translucent fills and their outlines are drawn with one program switch each,
+    // regardless of whether the layer covers one tile (zoom 0) or four tiles (zoom 1).
+    programChanges(0);
+    const std::size_t singleTile = programChanges(0);
+    const std::size_t fourTiles = programChanges(1);
+    EXPECT_EQ(singleTile, fourTiles);
+}
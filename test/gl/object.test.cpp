@@ -44,6 +44,30 @@ TEST(GLObject, Value) {
     EXPECT_TRUE(setFlag);
 }
 
+TEST(GLObject, ChangeCounters) {
+    gl::State<MockGLObject> object;
+    EXPECT_EQ(0u, object.getIssuedChanges());
+    EXPECT_EQ(0u, object.getSkippedChanges());
+
+    // Dirty state always results in a call.
+    object = false;
+    EXPECT_EQ(1u, object.getIssuedChanges());
+    EXPECT_EQ(0u, object.getSkippedChanges());
+
+    object = false;
+    EXPECT_EQ(1u, object.getIssuedChanges());
+    EXPECT_EQ(1u, object.getSkippedChanges());
+
+    object = true;
+    EXPECT_EQ(2u, object.getIssuedChanges());
+    EXPECT_EQ(1u, object.getSkippedChanges());
+
+    object.setDirty();
+    object = true;
+    EXPECT_EQ(3u, object.getIssuedChanges());
+    EXPECT_EQ(1u, object.getSkippedChanges());
+}
+
 TEST(GLObject, Store) {
     gl::HeadlessBackend backend { { 256, 256 } };
     gfx::BackendScope scope { backend };
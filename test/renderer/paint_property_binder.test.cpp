@@ -0,0 +1,156 @@
+#include <mbgl/test/util.hpp>
+#include <mbgl/test/stub_geometry_tile_feature.hpp>
+
+#include <mbgl/renderer/paint_property_binder.hpp>
+#include <mbgl/style/expression/dsl.hpp>
+#include <mbgl/style/expression/format_section_override.hpp>
+
+#include <cstring>
+
+using namespace mbgl;
+using namespace mbgl::style;
+using namespace mbgl::style::expression::dsl;
+
+namespace {
+
+class StubGeometryTileLayer : public GeometryTileLayer {
+public:
+    std::size_t featureCount() const override {
+        return features.size();
+    }
+
+    std::unique_ptr<GeometryTileFeature> getFeature(std::size_t i) const override {
+        return std::make_unique<StubGeometryTileFeature>(features.at(i));
+    }
+
+    std::string getName() const override {
+        return "layer";
+    }
+
+    std::vector<StubGeometryTileFeature> features;
+};
+
+class StubVertexBufferResource : public gfx::VertexBufferResource {};
+
+// Records the vertex data that would be sent to the GPU. Vertices are single floats.
+class StubUploadPass : public gfx::UploadPass {
+public:
+    struct Upload {
+        std::size_t offset;
+        std::vector<float> values;
+    };
+
+    std::vector<Upload> creates;
+    std::vector<Upload> updates;
+
+private:
+    void pushDebugGroup(const char*) override {}
+    void popDebugGroup() override {}
+
+    static std::vector<float> toFloats(const void* data, std::size_t size) {
+        std::vector<float> result(size / sizeof(float));
+        std::memcpy(result.data(), data, size);
+        return result;
+    }
+
+    std::unique_ptr<gfx::VertexBufferResource>
+    createVertexBufferResource(const void* data, std::size_t size, const gfx::BufferUsageType) override {
+        creates.push_back({ 0, toFloats(data, size) });
+        return std::make_unique<StubVertexBufferResource>();
+    }
+    void updateVertexBufferResource(gfx::VertexBufferResource&, const void* data, std::size_t size) override {
+        updates.push_back({ 0, toFloats(data, size) });
+    }
+    void updateVertexBufferResourceSub(gfx::VertexBufferResource&, std::size_t offset, const void* data, std::size_t size) override {
+        updates.push_back({ offset, toFloats(data, size) });
+    }
+
+    std::unique_ptr<gfx::IndexBufferResource>
+    createIndexBufferResource(const void*, std::size_t, const gfx::BufferUsageType) override {
+        return nullptr;
+    }
+    void updateIndexBufferResource(gfx::IndexBufferResource&, const void*, std::size_t) override {}
+
+    std::unique_ptr<gfx::TextureResource> createTextureResource(
+        Size, const void*, gfx::TexturePixelType, gfx::TextureChannelDataType) override {
+        return nullptr;
+    }
+    void updateTextureResource(gfx::TextureResource&, Size, const void*,
+        gfx::TexturePixelType, gfx::TextureChannelDataType) override {}
+    void updateTextureResourceSub(gfx::TextureResource&, uint16_t, uint16_t, Size, const void*,
+        gfx::TexturePixelType, gfx::TextureChannelDataType) override {}
+};
+
+} // namespace
+
+TEST(PaintPropertyBinder, FeatureStateUpdatesOnlyChangedVertices) {
+    static_assert(sizeof(gfx::VertexType<attributes::opacity>) == sizeof(float), "one float per vertex");
+
+    SourceFunctionPaintPropertyBinder<float, attributes::opacity> binder(
+        PropertyExpression<float>(number(featureState("opacity"), literal(0.0))), 0.0f);
+
+    StubGeometryTileLayer layer;
+    layer.features.emplace_back(std::string("1"), FeatureType::Point, GeometryCollection(), PropertyMap());
+    layer.features.emplace_back(std::string("2"), FeatureType::Point, GeometryCollection(), PropertyMap());
+    layer.features.emplace_back(std::string("3"), FeatureType::Point, GeometryCollection(), PropertyMap());
+
+    // Each feature covers four vertices.
+    for (std::size_t i = 0; i < layer.featureCount(); ++i) {
+        binder.populateVertexVector(layer.features[i], (i + 1) * 4, i, {}, {}, {});
+    }
+
+    StubUploadPass uploadPass;
+    binder.upload(uploadPass);
+    ASSERT_EQ(1u, uploadPass.creates.size());
+    EXPECT_EQ(std::vector<float>(12, 0.0f), uploadPass.creates[0].values);
+    EXPECT_TRUE(uploadPass.updates.empty());
+
+    // States of unknown features don't change anything.
+    const FeatureStates unknownStates {{ "4", {{ "opacity", 1.0 }} }};
+    EXPECT_FALSE(binder.updateVertexVector(unknownStates, layer));
+    binder.upload(uploadPass);
+    EXPECT_TRUE(uploadPass.updates.empty());
+
+    // Only the vertices of the changed feature are uploaded again.
+    const FeatureStates states {{ "2", {{ "opacity", 1.0 }} }};
+    EXPECT_TRUE(binder.updateVertexVector(states, layer));
+    binder.upload(uploadPass);
+    EXPECT_EQ(1u, uploadPass.creates.size());
+    ASSERT_EQ(1u, uploadPass.updates.size());
+    EXPECT_EQ(4 * sizeof(float), uploadPass.updates[0].offset);
+    EXPECT_EQ(std::vector<float>(4, 1.0f), uploadPass.updates[0].values);
+
+    // The dirty range is reset after uploading.
+    binder.upload(uploadPass);
+    EXPECT_EQ(1u, uploadPass.updates.size());
+}
+
+TEST(PaintPropertyBinder, FeatureStateUpdatesKeepFormattedSectionOverrides) {
+    using Object = std::unordered_map<std::string, expression::Value>;
+
+    // Like text-color, the property can be overridden by the formatted section of the vertices.
+    PossiblyEvaluatedPropertyValue<float> defaultValue { PropertyExpression<float>(number(featureState("opacity"), literal(0.0))) };
+    SourceFunctionPaintPropertyBinder<float, attributes::opacity> binder(
+        PropertyExpression<float>(std::make_unique<expression::FormatSectionOverride<float>>(expression::type::Number, defaultValue, "opacity")), 0.0f);
+
+    StubGeometryTileLayer layer;
+    layer.features.emplace_back(std::string("1"), FeatureType::Point, GeometryCollection(), PropertyMap());
+
+    // The first section of the feature overrides the property, the second one doesn't.
+    binder.populateVertexVector(layer.features[0], 4, 0, {}, {}, expression::Value(Object {{ "opacity", 0.5 }}));
+    binder.populateVertexVector(layer.features[0], 8, 0, {}, {}, expression::Value(Object {}));
+
+    StubUploadPass uploadPass;
+    binder.upload(uploadPass);
+    ASSERT_EQ(1u, uploadPass.creates.size());
+    const std::vector<float> created { 0.5f, 0.5f, 0.5f, 0.5f, 0.0f, 0.0f, 0.0f, 0.0f };
+    EXPECT_EQ(created, uploadPass.creates[0].values);
+
+    const FeatureStates states {{ "1", {{ "opacity", 1.0 }} }};
+    EXPECT_TRUE(binder.updateVertexVector(states, layer));
+    binder.upload(uploadPass);
+    ASSERT_EQ(1u, uploadPass.updates.size());
+    EXPECT_EQ(0u, uploadPass.updates[0].offset);
+    const std::vector<float> updated { 0.5f, 0.5f, 0.5f, 0.5f, 1.0f, 1.0f, 1.0f, 1.0f };
+    EXPECT_EQ(updated, uploadPass.updates[0].values);
+}
@@ -0,0 +1,122 @@
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/renderer/source_state.hpp>
+#include <mbgl/tile/tile.hpp>
+
+#include <map>
+#include <memory>
+
+using namespace mbgl;
+
+namespace {
+
+class StubTile : public Tile {
+public:
+    StubTile(const OverscaledTileID& id_) : Tile(Kind::Geometry, id_) {}
+
+    void upload(gfx::UploadPass&) override {}
+    Bucket* getBucket(const style::Layer::Impl&) const override { return nullptr; }
+
+    void setFeatureState(const LayerFeatureStates& states) override {
+        applied.push_back(states);
+    }
+
+    std::vector<LayerFeatureStates> applied;
+};
+
+} // namespace
+
+TEST(SourceFeatureState, UpdateAndGet) {
+    const optional<std::string> sourceLayer = std::string("layer");
+    SourceFeatureState state;
+    state.updateState(sourceLayer, "1", {{ "hover", true }});
+    state.updateState(sourceLayer, "1", {{ "selected", true }});
+
+    FeatureState result;
+    state.getState(result, sourceLayer, "1");
+    EXPECT_EQ((FeatureState {{ "hover", true }, { "selected", true }}), result);
+
+    state.getState(result, sourceLayer, "2");
+    EXPECT_TRUE(result.empty());
+
+    state.getState(result, {}, "1");
+    EXPECT_TRUE(result.empty());
+}
+
+TEST(SourceFeatureState, Remove) {
+    SourceFeatureState state;
+    state.updateState({}, "1", {{ "hover", true }, { "selected", true }});
+    state.updateState({}, "2", {{ "hover", true }});
+
+    FeatureState result;
+    state.removeState({}, std::string("1"), std::string("hover"));
+    state.getState(result, {}, "1");
+    EXPECT_EQ((FeatureState {{ "selected", true }}), result);
+
+    state.removeState({}, std::string("1"), {});
+    state.getState(result, {}, "1");
+    EXPECT_TRUE(result.empty());
+
+    state.removeState({}, {}, {});
+    state.getState(result, {}, "2");
+    EXPECT_TRUE(result.empty());
+}
+
+TEST(SourceFeatureState, CoalesceChanges) {
+    std::map<OverscaledTileID, std::unique_ptr<Tile>> tiles;
+    auto tile = std::make_unique<StubTile>(OverscaledTileID { 0, 0, 0 });
+    StubTile& stubTile = *tile;
+    tiles.emplace(stubTile.id, std::move(tile));
+
+    SourceFeatureState state;
+
+    // Nothing to apply without any state.
+    state.coalesceChanges(tiles);
+    EXPECT_TRUE(stubTile.applied.empty());
+
+    state.updateState({}, "1", {{ "hover", true }});
+    state.coalesceChanges(tiles);
+    ASSERT_EQ(1u, stubTile.applied.size());
+    EXPECT_EQ(1u, stubTile.applied.back().at("").size());
+
+    // Up to date tiles only get the latest changes.
+    state.updateState({}, "2", {{ "hover", true }});
+    state.coalesceChanges(tiles);
+    ASSERT_EQ(2u, stubTile.applied.size());
+    EXPECT_EQ(1u, stubTile.applied.back().at("").count("2"));
+    EXPECT_EQ(0u, stubTile.applied.back().at("").count("1"));
+
+    state.coalesceChanges(tiles);
+    EXPECT_EQ(2u, stubTile.applied.size());
+
+    // Tiles that haven't seen any state yet get the complete state.
+    stubTile.featureStateVersion = 0;
+    state.coalesceChanges(tiles);
+    ASSERT_EQ(3u, stubTile.applied.size());
+    EXPECT_EQ(2u, stubTile.applied.back().at("").size());
+}
+
+TEST(SourceFeatureState, CoalesceChangesMissedByTile) {
+    std::map<OverscaledTileID, std::unique_ptr<Tile>> tiles;
+    auto tile = std::make_unique<StubTile>(OverscaledTileID { 0, 0, 0 });
+    StubTile& stubTile = *tile;
+    tiles.emplace(stubTile.id, std::move(tile));
+
+    SourceFeatureState state;
+    state.updateState({}, "1", {{ "hover", true }});
+    state.coalesceChanges(tiles);
+    ASSERT_EQ(1u, stubTile.applied.size());
+
+    // The tile isn't part of the tiles while the version is bumped, e.g. because it was cached.
+    std::unique_ptr<Tile> cached = std::move(tiles.begin()->second);
+    tiles.clear();
+    state.updateState({}, "2", {{ "hover", true }});
+    state.coalesceChanges(tiles);
+    EXPECT_EQ(1u, stubTile.applied.size());
+
+    // Once it's back, it gets the complete state, even though there are no new changes.
+    tiles.emplace(stubTile.id, std::move(cached));
+    state.coalesceChanges(tiles);
+    ASSERT_EQ(2u, stubTile.applied.size());
+    EXPECT_EQ(2u, stubTile.applied.back().at("").size());
+}
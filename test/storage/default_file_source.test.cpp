@@ -2,10 +2,45 @@
 #include <mbgl/test/util.hpp>
 #include <mbgl/storage/default_file_source.hpp>
 #include <mbgl/storage/resource_transform.hpp>
+#include <mbgl/util/io.hpp>
 #include <mbgl/util/run_loop.hpp>
+#include <mbgl/util/string.hpp>
+
+#include <cstdlib>
+
+#include <unistd.h>
 
 using namespace mbgl;
 
+namespace {
+
+// A database file in the temporary directory, which is deleted when going out of scope.
+class TemporaryDatabase {
+public:
+    TemporaryDatabase(const std::string& name) {
+        const char* directory = std::getenv("TMPDIR");
+        path = std::string(directory && *directory ? directory : "/tmp") + "/mbgl-" + name + "-" +
+               util::toString(getpid()) + ".db";
+        deleteFiles();
+    }
+
+    ~TemporaryDatabase() {
+        deleteFiles();
+    }
+
+    std::string path;
+
+private:
+    void deleteFiles() {
+        util::deleteFile(path);
+        util::deleteFile(path + "-wal");
+        util::deleteFile(path + "-shm");
+        util::deleteFile(path + "-journal");
+    }
+};
+
+} // namespace
+
 TEST(DefaultFileSource, TEST_REQUIRES_SERVER(CacheResponse)) {
     util::RunLoop loop;
     DefaultFileSource fs(":memory:", ".");
@@ -584,6 +619,104 @@ TEST(DefaultFileSource, SetResourceCachePath) {
     loop.run();
 }
 
+TEST(DefaultFileSource, DeleteRegionClearsMemoryCache) {
+    util::RunLoop loop;
+    DefaultFileSource fs(":memory:", ".");
+
+    Response response;
+    response.data = std::make_shared<std::string>("Cached value");
+    fs.put(Resource::style("http://example.com/style"), response);
+
+    OfflineTilePyramidRegionDefinition definition { "http://example.com/style", LatLngBounds::hull({1, 2}, {3, 4}), 5, 6, 2.0, true };
+    fs.createOfflineRegion(definition, {}, [&](expected<OfflineRegion, std::exception_ptr> region) {
+        ASSERT_TRUE(bool(region));
+        EXPECT_EQ(1u, fs.getMemoryCacheStats().entries);
+
+        fs.deleteOfflineRegion(std::move(*region), [&](std::exception_ptr error) {
+            EXPECT_FALSE(error);
+            EXPECT_EQ(0u, fs.getMemoryCacheStats().entries);
+            loop.stop();
+        });
+    });
+
+    loop.run();
+}
+
+TEST(DefaultFileSource, DeleteRegionCancelsCompletedImport) {
+    util::RunLoop loop;
+    DefaultFileSource fs(":memory:", ".");
+
+    OfflineTilePyramidRegionDefinition definition { "http://example.com/style", LatLngBounds::hull({1, 2}, {3, 4}), 5, 6, 2.0, true };
+    fs.createOfflineRegion(definition, {}, [&](expected<OfflineRegion, std::exception_ptr> region) {
+        ASSERT_TRUE(bool(region));
+
+        // The import fails right away, but its completion is only handled after the deletion.
+        fs.importOfflineRegionTiles(*region, "test/fixtures/offline_database/missing.mbtiles",
+                                    "http://127.0.0.1:3000/{z}-{x}-{y}.vector.pbf", [&](std::exception_ptr) {
+            ADD_FAILURE() << "deleting the region should cancel the import";
+        });
+        fs.deleteOfflineRegion(std::move(*region), [&](std::exception_ptr error) {
+            EXPECT_FALSE(error);
+            // Runs after the completion of the import.
+            fs.listOfflineRegions([&](expected<OfflineRegions, std::exception_ptr>) {
+                loop.stop();
+            });
+        });
+    });
+
+    loop.run();
+}
+
+TEST(DefaultFileSource, TEST_REQUIRES_WRITE(CacheReaders)) {
+    using namespace std::chrono_literals;
+
+    // Declared first, so that the file is deleted after the file source closed it.
+    const TemporaryDatabase database("cache_readers");
+    const std::string& path = database.path;
+
+    util::RunLoop loop;
+    DefaultFileSource fs(path, ".");
+    fs.setCacheReaderCount(2);
+
+    const Resource optionalResource { Resource::Unknown, "http://127.0.0.1:3000/test", Resource::Priority::Regular, {}, Resource::LoadingMethod::CacheOnly };
+
+    Response response;
+    response.data = std::make_shared<std::string>("Cached value");
+    response.expires = util::now() + 1h;
+    fs.put(optionalResource, response);
+
+    // Wait for the write to complete, since reads don't queue behind it anymore.
+    Actor<PathChangeCallback> callback(loop, [&]() -> void {
+        loop.stop();
+    });
+    fs.setResourceCachePath(path, callback.self());
+    loop.run();
+
+    std::unique_ptr<AsyncRequest> req;
+    req = fs.request(optionalResource, [&](Response res) {
+        req.reset();
+        EXPECT_EQ(nullptr, res.error);
+        ASSERT_TRUE(res.data.get());
+        EXPECT_EQ("Cached value", *res.data);
+        loop.stop();
+    });
+    loop.run();
+
+    // Cancelled reads don't respond.
+    fs.request(optionalResource, [&](Response) {
+        FAIL() << "Should never be called";
+    });
+
+    const Resource missingResource { Resource::Unknown, "http://127.0.0.1:3000/missing", Resource::Priority::Regular, {}, Resource::LoadingMethod::CacheOnly };
+    req = fs.request(missingResource, [&](Response res) {
+        req.reset();
+        ASSERT_TRUE(res.error.get());
+        EXPECT_EQ(Response::Error::Reason::NotFound, res.error->reason);
+        loop.stop();
+    });
+    loop.run();
+}
+
 // Test that a stale cache file that has must-revalidate set will trigger a response.
 TEST(DefaultFileSource, TEST_REQUIRES_SERVER(RespondToStaleMustRevalidate)) {
     util::RunLoop loop;
@@ -203,3 +203,46 @@ TEST(HTTPFileSource, TEST_REQUIRES_SERVER(Load)) {
 
     loop.run();
 }
+
+TEST(HTTPFileSource, TEST_REQUIRES_SERVER(ContentEncoding)) {
+    util::RunLoop loop;
+    HTTPFileSource fs;
+
+    auto req = fs.request({ Resource::Unknown, "http://127.0.0.1:3000/gzip" }, [&](Response res) {
+        EXPECT_EQ(nullptr, res.error);
+        ASSERT_TRUE(res.data.get());
+        EXPECT_EQ("Hello World!", *res.data);
+        loop.stop();
+    });
+
+    loop.run();
+}
+
+// Requests 1,000 small tiles at once, like a map that's showing a new area does, and records the
+// throughput in the test results. The test server speaks plain HTTP, where HTTP/2 is never
+// negotiated, so this only covers the HTTP/1.1 fallback and not multiplexing.
+TEST(HTTPFileSource, TEST_REQUIRES_SERVER(SmallTileThroughputHTTP1Fallback)) {
+    util::RunLoop loop;
+    HTTPFileSource fs;
+
+    const int count = 1000;
+    int remaining = count;
+    std::vector<std::unique_ptr<AsyncRequest>> reqs;
+
+    const auto start = Clock::now();
+    for (int i = 0; i < count; i++) {
+        const Resource resource = Resource::tile("http://127.0.0.1:3000/load/{z}", 1, 0, 0, i % 32, Tileset::Scheme::XYZ);
+        reqs.push_back(fs.request(resource, [&, i](Response res) {
+            EXPECT_EQ(nullptr, res.error);
+            EXPECT_TRUE(res.data && *res.data == std::string("Request ") + util::toString(i % 32));
+            if (--remaining == 0) {
+                loop.stop();
+            }
+        }));
+    }
+
+    loop.run();
+
+    const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    RecordProperty("RequestsPerSecond", util::toString(count / seconds));
+}
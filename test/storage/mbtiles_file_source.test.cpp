@@ -0,0 +1,93 @@
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/storage/mbtiles_file_source.hpp>
+#include <mbgl/storage/sqlite3.hpp>
+#include <mbgl/util/io.hpp>
+#include <mbgl/util/rapidjson.hpp>
+#include <mbgl/util/run_loop.hpp>
+
+using namespace mbgl;
+
+namespace {
+
+const std::string path = "test/fixtures/offline_database/tiles.mbtiles";
+
+void createTileSet() {
+    util::deleteFile(path);
+
+    auto db = mapbox::sqlite::Database::open(path, mapbox::sqlite::ReadWriteCreate);
+    db.exec("CREATE TABLE metadata (name TEXT, value TEXT);"
+            "CREATE TABLE tiles (zoom_level INTEGER, tile_column INTEGER, tile_row INTEGER, tile_data BLOB);"
+            "INSERT INTO metadata VALUES ('name', 'Test'), ('format', 'pbf'), ('minzoom', '0'), ('maxzoom', '2'),"
+            "    ('bounds', '-180,-85,180,85'), ('center', '0,0,1'),"
+            "    ('json', '{\"vector_layers\":[{\"id\":\"water\"}]}');"
+            // Row 2 at z2 is y 1 in XYZ coordinates.
+            "INSERT INTO tiles VALUES (2, 1, 2, 'tile 2/1/1');");
+}
+
+Response request(MBTilesFileSource& fs, const std::string& url) {
+    util::RunLoop loop;
+    Response result;
+    std::unique_ptr<AsyncRequest> req = fs.request({ Resource::Unknown, url }, [&](Response res) {
+        req.reset();
+        result = res;
+        loop.stop();
+    });
+    loop.run();
+    return result;
+}
+
+} // namespace
+
+TEST(MBTilesFileSource, AcceptsURL) {
+    EXPECT_TRUE(MBTilesFileSource::acceptsURL("mbtiles:///tiles.mbtiles"));
+    EXPECT_TRUE(MBTilesFileSource::acceptsURL("mbtiles://tiles.mbtiles/0/0/0"));
+    EXPECT_FALSE(MBTilesFileSource::acceptsURL("file:///tiles.mbtiles"));
+    EXPECT_FALSE(MBTilesFileSource::acceptsURL("mbtiles:"));
+    EXPECT_FALSE(MBTilesFileSource::acceptsURL(""));
+}
+
+TEST(MBTilesFileSource, TEST_REQUIRES_WRITE(TileJSON)) {
+    createTileSet();
+    MBTilesFileSource fs;
+
+    const std::string url = "mbtiles://" + path;
+    Response res = request(fs, url);
+    EXPECT_EQ(nullptr, res.error);
+    ASSERT_TRUE(res.data.get());
+
+    JSDocument document;
+    document.Parse<0>(res.data->c_str());
+    ASSERT_FALSE(document.HasParseError());
+    EXPECT_EQ(url + "/{z}/{x}/{y}", std::string(document["tiles"][0].GetString()));
+    EXPECT_EQ(std::string("Test"), document["name"].GetString());
+    EXPECT_EQ(2u, document["maxzoom"].GetUint());
+    EXPECT_EQ(4u, document["bounds"].Size());
+    EXPECT_EQ(std::string("water"), document["vector_layers"][0]["id"].GetString());
+
+    util::deleteFile(path);
+}
+
+TEST(MBTilesFileSource, TEST_REQUIRES_WRITE(Tiles)) {
+    createTileSet();
+    MBTilesFileSource fs;
+
+    Response res = request(fs, "mbtiles://" + path + "/2/1/1");
+    EXPECT_EQ(nullptr, res.error);
+    ASSERT_TRUE(res.data.get());
+    EXPECT_EQ("tile 2/1/1", *res.data);
+
+    res = request(fs, "mbtiles://" + path + "/2/1/2");
+    EXPECT_EQ(nullptr, res.error);
+    EXPECT_TRUE(res.noContent);
+
+    util::deleteFile(path);
+}
+
+TEST(MBTilesFileSource, NonexistentFile) {
+    MBTilesFileSource fs;
+
+    Response res = request(fs, "mbtiles://test/fixtures/offline_database/does_not_exist.mbtiles/0/0/0");
+    ASSERT_TRUE(res.error.get());
+    EXPECT_EQ(Response::Error::Reason::NotFound, res.error->reason);
+}
@@ -127,7 +127,6 @@ TEST(OfflineDatabase, TEST_REQUIRES_WRITE(CreateFail)) {
     // We can also still "query" the database even though it is not open, and we will always get an empty result.
     for (const auto& res : { fixture::resource, fixture::tile }) {
         EXPECT_FALSE(bool(db.get(res)));
-        EXPECT_EQ(1u, log.count(warning(ResultCode::CantOpen, "Can't update timestamp: unable to open database file")));
         EXPECT_EQ(1u, log.count(warning(ResultCode::CantOpen, "Can't read resource: unable to open database file")));
         EXPECT_EQ(0u, log.uncheckedCount());
     }
@@ -144,13 +143,12 @@ TEST(OfflineDatabase, TEST_REQUIRES_WRITE(CreateFail)) {
     }
 
     // Next, set the file system to read only mode and try to read the data again. While we can't
-    // write anymore, we should still be able to read, and the query that tries to update the last
-    // accessed timestamp may fail without crashing.
+    // write anymore, we should still be able to read, since reading doesn't write the last
+    // accessed timestamp right away.
     fs.allowFileCreate(false);
     fs.setWriteLimit(0);
     for (const auto& res : { fixture::resource, fixture::tile }) {
         auto result = db.get(res);
-        EXPECT_EQ(1u, log.count(warning(ResultCode::CantOpen, "Can't update timestamp: unable to open database file")));
         EXPECT_EQ(0u, log.uncheckedCount());
 
         ASSERT_TRUE(result && result->data);
@@ -159,13 +157,11 @@ TEST(OfflineDatabase, TEST_REQUIRES_WRITE(CreateFail)) {
     fs.setDebug(false);
 
     // We're allowing SQLite to create a journal file, but restrict the number of bytes it
-    // can write so that it can start writing the journal file, but eventually fails during the
-    // timestamp update.
+    // can write. Reading still succeeds.
     fs.allowFileCreate(true);
     fs.setWriteLimit(8192);
     for (const auto& res : { fixture::resource, fixture::tile }) {
         auto result = db.get(res);
-        EXPECT_EQ(1u, log.count(warning(ResultCode::Full, "Can't update timestamp: database or disk is full")));
         EXPECT_EQ(0u, log.uncheckedCount());
         ASSERT_TRUE(result && result->data);
         EXPECT_EQ("first", *result->data);
@@ -178,7 +174,6 @@ TEST(OfflineDatabase, TEST_REQUIRES_WRITE(CreateFail)) {
     for (const auto& res : { fixture::resource, fixture::tile }) {
         // First, try reading.
         auto result = db.get(res);
-        EXPECT_EQ(1u, log.count(warning(ResultCode::Auth, "Can't update timestamp: authorization denied")));
         EXPECT_EQ(1u, log.count(warning(ResultCode::Auth, "Can't read resource: authorization denied")));
         EXPECT_EQ(0u, log.uncheckedCount());
         EXPECT_FALSE(result);
@@ -593,6 +588,57 @@ TEST(OfflineDatabase, Invalidate) {
     EXPECT_EQ(0u, log.uncheckedCount());
 }
 
+TEST(OfflineDatabase, DiffRegionTiles) {
+    using namespace std::chrono_literals;
+
+    FixtureLog log;
+    OfflineDatabase db(":memory:");
+
+    OfflineTilePyramidRegionDefinition definition { "mapbox://style", LatLngBounds::hull({1, 2}, {3, 4}), 0, 1, 1.0, true };
+    auto region = db.createRegion(definition, {});
+    ASSERT_TRUE(region);
+
+    const std::string urlTemplate = "http://example.com/{z}/{x}/{y}.pbf";
+    auto response = [](const std::string& data) {
+        Response result;
+        result.data = std::make_shared<std::string>(data);
+        result.mustRevalidate = false;
+        result.expires = util::now() + 1h;
+        return result;
+    };
+    const Resource unchanged = Resource::tile(urlTemplate, 1.0, 0, 0, 0, Tileset::Scheme::XYZ);
+    const Resource changed = Resource::tile(urlTemplate, 1.0, 0, 0, 1, Tileset::Scheme::XYZ);
+    db.putRegionResource(region->getID(), unchanged, response("unchanged"));
+    db.putRegionResource(region->getID(), changed, response("changed"));
+
+    const OfflineTileManifest manifest {
+        { 0, 0, 0, OfflineDatabase::tileHash("unchanged") },
+        { 1, 0, 0, OfflineDatabase::tileHash("changed, version 2") },
+        { 1, 1, 0, OfflineDatabase::tileHash("new") },
+    };
+
+    auto delta = db.diffRegionTiles(region->getID(), urlTemplate, 1.0, manifest);
+    ASSERT_TRUE(delta);
+    EXPECT_EQ(1u, delta->unchangedTileCount);
+    EXPECT_EQ(std::string("unchanged").size(), delta->unchangedTileSize);
+    ASSERT_EQ(2u, delta->changedTiles.size());
+    EXPECT_EQ(changed.url, delta->changedTiles[0].url);
+    EXPECT_EQ(Resource::tile(urlTemplate, 1.0, 1, 0, 1, Tileset::Scheme::XYZ).url, delta->changedTiles[1].url);
+
+    // Changed tiles have to be revalidated until they're replaced.
+    EXPECT_TRUE(db.get(unchanged)->isUsable());
+    EXPECT_FALSE(db.get(changed)->isUsable());
+
+    // Replacing a tile updates its hash.
+    db.putRegionResource(region->getID(), changed, response("changed, version 2"));
+    delta = db.diffRegionTiles(region->getID(), urlTemplate, 1.0, manifest);
+    ASSERT_TRUE(delta);
+    EXPECT_EQ(2u, delta->unchangedTileCount);
+    EXPECT_EQ(1u, delta->changedTiles.size());
+
+    EXPECT_EQ(0u, log.uncheckedCount());
+}
+
 TEST(OfflineDatabase, CreateRegionInfiniteMaxZoom) {
     FixtureLog log;
     OfflineDatabase db(":memory:");
@@ -686,6 +732,61 @@ TEST(OfflineDatabase, PutEvictsLeastRecentlyUsedResources) {
     EXPECT_EQ(0u, log.uncheckedCount());
 }
 
+TEST(OfflineDatabase, TEST_REQUIRES_WRITE(GetDefersAccessedTimestampUpdate)) {
+    FixtureLog log;
+    deleteDatabaseFiles();
+    OfflineDatabase db(filename);
+    ASSERT_TRUE(db.put(fixture::resource, fixture::response).first);
+
+    mapbox::sqlite::Database inspector = mapbox::sqlite::Database::open(filename, mapbox::sqlite::ReadWriteCreate);
+    inspector.exec("UPDATE resources SET accessed = 0");
+    auto accessed = [&] {
+        mapbox::sqlite::Statement stmt{ inspector, "SELECT accessed FROM resources" };
+        mapbox::sqlite::Query query{ stmt };
+        query.run();
+        return query.get<int64_t>(0);
+    };
+
+    // Reading records the access in memory only.
+    ASSERT_TRUE(bool(db.get(fixture::resource)));
+    EXPECT_EQ(0, accessed());
+
+    db.flushAccessedTimestamps();
+    EXPECT_LT(0, accessed());
+
+    EXPECT_EQ(0u, log.uncheckedCount());
+}
+
+TEST(OfflineDatabase, EvictToLowWatermark) {
+    FixtureLog log;
+    OfflineDatabase db(":memory:", 1024 * 100);
+
+    Response response;
+    response.data = randomString(1024);
+
+    uint32_t count = 0;
+    while (!db.evictionNeeded() && count < 100) {
+        db.put(Resource::style("http://example.com/"s + util::toString(++count)), response);
+    }
+    ASSERT_TRUE(db.evictionNeeded());
+    EXPECT_EQ(0u, db.getEvictionStats().evictedEntries);
+
+    while (db.evictToLowWatermark()) {
+    }
+    EXPECT_FALSE(db.evictionNeeded());
+    EXPECT_LT(0u, db.getEvictionStats().evictedEntries);
+    EXPECT_LT(0u, db.getEvictionStats().evictedBytes);
+
+    EXPECT_FALSE(bool(db.get(Resource::style("http://example.com/1"))));
+    EXPECT_TRUE(bool(db.get(Resource::style("http://example.com/"s + util::toString(count)))));
+
+    while (db.reclaimFreePages()) {
+    }
+    EXPECT_FALSE(db.reclaimFreePages());
+
+    EXPECT_EQ(0u, log.uncheckedCount());
+}
+
 TEST(OfflineDatabase, PutRegionResourceDoesNotEvict) {
     FixtureLog log;
     OfflineDatabase db(":memory:", 1024 * 100);
@@ -939,6 +1040,30 @@ TEST(OfflineDatabase, BatchInsertionMapboxTileCountExceeded) {
     EXPECT_EQ(0u, log.uncheckedCount());
 }
 
+TEST(OfflineDatabase, BatchTileInsertionMapboxTileCountExceeded) {
+    FixtureLog log;
+    OfflineDatabase db(":memory:", 1024 * 100);
+    db.setOfflineMapboxTileCountLimit(1);
+    OfflineTilePyramidRegionDefinition definition { "", LatLngBounds::world(), 0, INFINITY, 1.0, false };
+    auto region = db.createRegion(definition, OfflineRegionMetadata());
+    ASSERT_TRUE(region);
+
+    std::vector<OfflineDatabase::PreparedTile> tiles;
+    tiles.push_back({ Resource::tile("mapbox://tiles/1", 1.0, 0, 0, 0, Tileset::Scheme::XYZ), "tile 1", false, 1 });
+    tiles.push_back({ Resource::tile("mapbox://tiles/2", 1.0, 0, 0, 0, Tileset::Scheme::XYZ), "tile 2", false, 2 });
+
+    // The tiles stored before the limit was reached are committed, and counted.
+    OfflineRegionStatus status;
+    EXPECT_THROW(db.putRegionTiles(region->getID(), tiles, status), MapboxTileLimitExceededException);
+    EXPECT_EQ(1u, status.completedTileCount);
+    EXPECT_EQ(6u, status.completedTileSize);
+    EXPECT_EQ(1u, status.completedResourceCount);
+    const auto completedStatus = db.getRegionCompletedStatus(region->getID()).value();
+    EXPECT_EQ(1u, completedStatus.completedTileCount);
+
+    EXPECT_EQ(0u, log.uncheckedCount());
+}
+
 TEST(OfflineDatabase, MigrateFromV2Schema) {
     // v2.db is a v2 database containing a single offline region with a small number of resources.
     FixtureLog log;
@@ -1129,7 +1254,6 @@ TEST(OfflineDatabase, TEST_REQUIRES_WRITE(DisallowedIO)) {
     fs.allowIO(false);
 
     EXPECT_EQ(nullopt, db.get(fixture::resource));
-    EXPECT_EQ(1u, log.count(warning(ResultCode::Auth, "Can't update timestamp: authorization denied")));
     EXPECT_EQ(1u, log.count(warning(ResultCode::Auth, "Can't read resource: authorization denied")));
     EXPECT_EQ(0u, log.uncheckedCount());
 
@@ -1150,7 +1274,6 @@ TEST(OfflineDatabase, TEST_REQUIRES_WRITE(DisallowedIO)) {
     EXPECT_EQ(0u, log.uncheckedCount());
 
     EXPECT_EQ(nullopt, db.getRegionResource(region->getID(), fixture::resource));
-    EXPECT_EQ(1u, log.count(warning(ResultCode::Auth, "Can't update timestamp: authorization denied")));
     EXPECT_EQ(1u, log.count(warning(ResultCode::Auth, "Can't read region resource: authorization denied")));
     EXPECT_EQ(0u, log.uncheckedCount());
 
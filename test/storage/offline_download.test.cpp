@@ -6,6 +6,8 @@
 #include <mbgl/storage/offline.hpp>
 #include <mbgl/storage/offline_database.hpp>
 #include <mbgl/storage/offline_download.hpp>
+#include <mbgl/storage/offline_region_update.hpp>
+#include <mbgl/storage/resource_memory_cache.hpp>
 #include <mbgl/storage/http_file_source.hpp>
 #include <mbgl/util/run_loop.hpp>
 #include <mbgl/util/io.hpp>
@@ -14,6 +16,7 @@
 
 #include <mbgl/storage/sqlite3.hpp>
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <iostream>
 
 using namespace mbgl;
@@ -122,6 +125,41 @@ TEST(OfflineDownload, NoSubresources) {
     test.loop.run();
 }
 
+TEST(OfflineDownload, InvalidatesMemoryCache) {
+    OfflineTest test;
+    auto region = test.createRegion();
+    ASSERT_TRUE(region);
+
+    auto memoryCache = std::make_shared<ResourceMemoryCache>(1024 * 1024);
+    Response cached;
+    cached.data = std::make_shared<std::string>("{}");
+    memoryCache->put(Resource::style("http://127.0.0.1:3000/style.json"), cached);
+    ASSERT_EQ(1u, memoryCache->getStats().entries);
+
+    OfflineDownload download(
+        region->getID(),
+        OfflineTilePyramidRegionDefinition("http://127.0.0.1:3000/style.json", LatLngBounds::world(), 0.0, 0.0, 1.0, false),
+        test.db, test.fileSource, memoryCache);
+
+    test.fileSource.styleResponse = [&] (const Resource&) {
+        return test.response("empty.style.json");
+    };
+
+    auto observer = std::make_unique<MockObserver>();
+    observer->statusChangedFn = [&] (OfflineRegionStatus status) {
+        if (status.complete()) {
+            // The stored style replaces the one held in memory.
+            EXPECT_EQ(0u, memoryCache->getStats().entries);
+            test.loop.stop();
+        }
+    };
+
+    download.setObserver(std::move(observer));
+    download.setState(OfflineRegionDownloadState::Active);
+
+    test.loop.run();
+}
+
 TEST(OfflineDownload, InlineSource) {
     OfflineTest test;
     auto region = test.createRegion();
@@ -641,6 +679,49 @@ TEST(OfflineDownload, WithPreviouslyExistingTile) {
     test.loop.run();
 }
 
+TEST(OfflineDownload, UpdateOnlyChangedTiles) {
+    OfflineTest test;
+    auto region = test.createRegion();
+    ASSERT_TRUE(region);
+    OfflineDownload download(
+        region->getID(),
+        OfflineTilePyramidRegionDefinition("http://127.0.0.1:3000/style.json", LatLngBounds::world(), 0.0, 1.0, 1.0, false),
+        test.db, test.fileSource);
+
+    const std::string urlTemplate = "http://127.0.0.1:3000/{z}-{x}-{y}.vector.pbf";
+    const Response tile = test.response("0-0-0.vector.pbf");
+    test.db.putRegionResource(region->getID(), Resource::tile(urlTemplate, 1, 0, 0, 0, Tileset::Scheme::XYZ), tile);
+    test.db.putRegionResource(region->getID(), Resource::tile(urlTemplate, 1, 0, 0, 1, Tileset::Scheme::XYZ), tile);
+
+    std::vector<std::string> requested;
+    test.fileSource.tileResponse = [&] (const Resource& resource) {
+        requested.push_back(resource.url);
+        return test.response("0-0-0.vector.pbf");
+    };
+
+    const OfflineTileManifest manifest {
+        { 0, 0, 0, OfflineDatabase::tileHash(*tile.data) },
+        { 1, 0, 0, OfflineDatabase::tileHash("changed") },
+        { 1, 1, 1, OfflineDatabase::tileHash("new") },
+    };
+
+    OfflineRegionUpdate update(region->getID(), 1.0, urlTemplate, manifest, test.db, test.fileSource, download,
+                               [&] (expected<OfflineRegionUpdateStats, std::exception_ptr> stats) {
+        ASSERT_TRUE(stats);
+        EXPECT_EQ(1u, stats->unchangedTileCount);
+        EXPECT_LT(0u, stats->savedBytes);
+        EXPECT_EQ(2u, stats->updatedTileCount);
+        test.loop.stop();
+    });
+    update.start();
+    test.loop.run();
+
+    ASSERT_EQ(2u, requested.size());
+    std::sort(requested.begin(), requested.end());
+    EXPECT_EQ("http://127.0.0.1:3000/1-0-0.vector.pbf", requested[0]);
+    EXPECT_EQ("http://127.0.0.1:3000/1-1-1.vector.pbf", requested[1]);
+}
+
 TEST(OfflineDownload, ReactivatePreviouslyCompletedDownload) {
     OfflineTest test;
     auto region = test.createRegion();
@@ -0,0 +1,117 @@
+#include <mbgl/test/util.hpp>
+#include <mbgl/test/stub_file_source.hpp>
+
+#include <mbgl/storage/offline.hpp>
+#include <mbgl/storage/offline_database.hpp>
+#include <mbgl/storage/offline_download.hpp>
+#include <mbgl/storage/offline_import.hpp>
+#include <mbgl/storage/sqlite3.hpp>
+#include <mbgl/util/io.hpp>
+#include <mbgl/util/run_loop.hpp>
+
+using namespace mbgl;
+
+namespace {
+
+const std::string archivePath = "test/fixtures/offline_database/import.mbtiles";
+const std::string urlTemplate = "http://127.0.0.1:3000/{z}-{x}-{y}.vector.pbf";
+
+void createArchive() {
+    util::deleteFile(archivePath);
+
+    auto db = mapbox::sqlite::Database::open(archivePath, mapbox::sqlite::ReadWriteCreate);
+    db.exec("CREATE TABLE tiles (zoom_level INTEGER, tile_column INTEGER, tile_row INTEGER, tile_data BLOB);"
+            // MBTiles rows count from the bottom: row 1 at z1 is y 0.
+            "INSERT INTO tiles VALUES (0, 0, 0, 'tile 0/0/0'), (1, 0, 1, 'tile 1/0/0'), (1, 1, 0, 'tile 1/1/1');");
+}
+
+class ImportObserver : public OfflineRegionObserver {
+public:
+    void statusChanged(OfflineRegionStatus status_) override {
+        status = status_;
+    }
+
+    OfflineRegionStatus status;
+};
+
+class ImportTest {
+public:
+    ImportTest(const OfflineRegionDefinition& definition =
+                   OfflineTilePyramidRegionDefinition("", LatLngBounds::world(), 0, 1, 1.0, false))
+        : db(":memory:"),
+          region(std::move(*db.createRegion(definition, {}))),
+          download(region.getID(), OfflineRegionDefinition(region.getDefinition()), db, fileSource) {
+        auto observer_ = std::make_unique<ImportObserver>();
+        observer = observer_.get();
+        download.setObserver(std::move(observer_));
+    }
+
+    util::RunLoop loop;
+    StubOnlineFileSource fileSource;
+    OfflineDatabase db;
+    OfflineRegion region;
+    OfflineDownload download;
+    ImportObserver* observer;
+};
+
+} // namespace
+
+TEST(OfflineImport, TEST_REQUIRES_WRITE(MBTiles)) {
+    createArchive();
+    ImportTest test;
+
+    OfflineImport import(test.region.getID(), test.region.getDefinition(), urlTemplate, archivePath, test.db, test.download,
+                         [&](std::exception_ptr error) {
+        EXPECT_FALSE(error);
+        test.loop.stop();
+    });
+    import.start();
+    test.loop.run();
+
+    EXPECT_EQ(3u, test.observer->status.completedTileCount);
+    EXPECT_LE(test.observer->status.completedResourceCount, test.observer->status.requiredResourceCount);
+    EXPECT_EQ(3u, test.db.getRegionCompletedStatus(test.region.getID())->completedTileCount);
+
+    const Resource tile = Resource::tile(urlTemplate, 1.0, 0, 0, 1, Tileset::Scheme::XYZ);
+    auto response = test.db.get(tile);
+    ASSERT_TRUE(response);
+    ASSERT_TRUE(response->data);
+    EXPECT_EQ("tile 1/0/0", *response->data);
+    EXPECT_TRUE(test.db.hasRegionResource(test.region.getID(), tile));
+
+    util::deleteFile(archivePath);
+}
+
+TEST(OfflineImport, TEST_REQUIRES_WRITE(RegionBounds)) {
+    createArchive();
+    // Covers the north-western quarter of the world at z1 only.
+    ImportTest test { OfflineTilePyramidRegionDefinition("", LatLngBounds::hull({ 10, -170 }, { 80, -10 }), 1, 1, 1.0, false) };
+
+    OfflineImport import(test.region.getID(), test.region.getDefinition(), urlTemplate, archivePath, test.db, test.download,
+                         [&](std::exception_ptr error) {
+        EXPECT_FALSE(error);
+        test.loop.stop();
+    });
+    import.start();
+    test.loop.run();
+
+    EXPECT_EQ(1u, test.observer->status.completedTileCount);
+    EXPECT_TRUE(test.db.hasRegionResource(test.region.getID(), Resource::tile(urlTemplate, 1.0, 0, 0, 1, Tileset::Scheme::XYZ)));
+    EXPECT_FALSE(test.db.get(Resource::tile(urlTemplate, 1.0, 0, 0, 0, Tileset::Scheme::XYZ)));
+    EXPECT_FALSE(test.db.get(Resource::tile(urlTemplate, 1.0, 1, 1, 1, Tileset::Scheme::XYZ)));
+
+    util::deleteFile(archivePath);
+}
+
+TEST(OfflineImport, MissingArchive) {
+    ImportTest test;
+
+    OfflineImport import(test.region.getID(), test.region.getDefinition(), urlTemplate, "test/fixtures/offline_database/missing.mbtiles",
+                         test.db, test.download, [&](std::exception_ptr error) {
+        EXPECT_TRUE(error);
+        test.loop.stop();
+    });
+    import.start();
+
+    EXPECT_EQ(0u, test.observer->status.completedTileCount);
+}
@@ -543,3 +543,92 @@ TEST(OnlineFileSource, TEST_REQUIRES_SERVER(RequestSameUrlMultipleTimes)) {
 
     loop.run();
 }
+
+TEST(OnlineFileSource, TEST_REQUIRES_SERVER(CoalesceIdenticalRequests)) {
+    util::RunLoop loop;
+    OnlineFileSource fs;
+
+    const Resource resource { Resource::Unknown, "http://127.0.0.1:3000/coalesce" };
+    std::unique_ptr<AsyncRequest> req1;
+    std::unique_ptr<AsyncRequest> req2;
+    std::unique_ptr<AsyncRequest> req3;
+    int responses = 0;
+
+    // Cancelled requests don't cancel the transfer shared with the others.
+    std::unique_ptr<AsyncRequest> cancelled = fs.request(resource, [&](Response) {
+        FAIL() << "Should never be called";
+    });
+
+    auto requestAgain = [&] {
+        // Requests made after the transfer completed start a new one.
+        req3 = fs.request(resource, [&](Response res) {
+            req3.reset();
+            ASSERT_TRUE(res.data.get());
+            EXPECT_EQ("Response 2", *res.data);
+            loop.stop();
+        });
+    };
+
+    req1 = fs.request(resource, [&](Response res) {
+        req1.reset();
+        ASSERT_TRUE(res.data.get());
+        EXPECT_EQ("Response 1", *res.data);
+        if (++responses == 2) {
+            requestAgain();
+        }
+    });
+    req2 = fs.request(resource, [&](Response res) {
+        req2.reset();
+        ASSERT_TRUE(res.data.get());
+        EXPECT_EQ("Response 1", *res.data);
+        if (++responses == 2) {
+            requestAgain();
+        }
+    });
+
+    // Cancel while the transfer is in progress.
+    util::Timer timer;
+    timer.start(Milliseconds(50), Duration::zero(), [&] {
+        cancelled.reset();
+    });
+
+    loop.run();
+}
+
+TEST(OnlineFileSource, TEST_REQUIRES_SERVER(RankedRequests)) {
+    util::RunLoop loop;
+    OnlineFileSource fs;
+    std::vector<std::string> responses;
+
+    fs.setMaximumConcurrentRequests(1);
+
+    // Occupies the only slot, so that the following requests are queued.
+    std::unique_ptr<AsyncRequest> delayed = fs.request({ Resource::Unknown, "http://127.0.0.1:3000/delayed" }, [&](Response) {
+        responses.push_back("delayed");
+    });
+
+    std::vector<std::unique_ptr<AsyncRequest>> requests;
+    auto request = [&](const std::string& name, uint32_t rank) {
+        Resource resource{ Resource::Unknown, "http://127.0.0.1:3000/load/" + name };
+        resource.rank = rank;
+        requests.push_back(fs.request(resource, [&, name](Response) {
+            responses.push_back(name);
+            if (responses.size() == 4) {
+                loop.stop();
+            }
+        }));
+    };
+    request("1", 5);
+    request("2", 1);
+    request("3", 3);
+
+    // Re-rank a queued request.
+    util::Timer timer;
+    timer.start(Milliseconds(50), Duration::zero(), [&] {
+        requests[0]->setRank(0);
+    });
+
+    loop.run();
+
+    EXPECT_EQ((std::vector<std::string>{ "delayed", "1", "2", "3" }), responses);
+}
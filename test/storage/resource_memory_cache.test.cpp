@@ -0,0 +1,117 @@
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/storage/resource_memory_cache.hpp>
+#include <mbgl/util/string.hpp>
+
+using namespace mbgl;
+
+namespace {
+
+Response responseWithData(std::size_t size) {
+    Response response;
+    response.data = std::make_shared<std::string>(size, '0');
+    return response;
+}
+
+} // namespace
+
+TEST(ResourceMemoryCache, PutGet) {
+    ResourceMemoryCache cache(1024 * 1024);
+    const Resource resource { Resource::Style, "mapbox://style" };
+
+    EXPECT_FALSE(cache.get(resource));
+
+    Response response = responseWithData(100);
+    response.etag = std::string("etag");
+    cache.put(resource, response);
+
+    auto cached = cache.get(resource);
+    ASSERT_TRUE(cached);
+    EXPECT_EQ(response.data, cached->data);
+    EXPECT_EQ(response.etag, cached->etag);
+    EXPECT_FALSE(cached->noContent);
+
+    const auto stats = cache.getStats();
+    EXPECT_EQ(1u, stats.hits);
+    EXPECT_EQ(1u, stats.misses);
+    EXPECT_EQ(1u, stats.entries);
+    EXPECT_EQ(100u + resource.url.size(), stats.size);
+}
+
+TEST(ResourceMemoryCache, TileKey) {
+    ResourceMemoryCache cache(1024 * 1024);
+    const Resource tile = Resource::tile("http://example.com/{z}/{x}/{y}.pbf?access_token=a", 1, 0, 0, 0, Tileset::Scheme::XYZ);
+    const Resource otherToken = Resource::tile("http://example.com/{z}/{x}/{y}.pbf?access_token=b", 1, 0, 0, 0, Tileset::Scheme::XYZ);
+    const Resource otherTile = Resource::tile("http://example.com/{z}/{x}/{y}.pbf?access_token=a", 1, 1, 0, 1, Tileset::Scheme::XYZ);
+
+    cache.put(tile, responseWithData(10));
+
+    EXPECT_TRUE(cache.get(tile));
+    EXPECT_FALSE(cache.get(otherToken));
+    EXPECT_FALSE(cache.get(otherTile));
+}
+
+TEST(ResourceMemoryCache, NotModified) {
+    using namespace std::chrono_literals;
+
+    ResourceMemoryCache cache(1024 * 1024);
+    const Resource resource { Resource::Style, "mapbox://style" };
+
+    Response notModified;
+    notModified.notModified = true;
+    notModified.expires = util::now() + 1h;
+
+    // Doesn't create entries.
+    cache.put(resource, notModified);
+    EXPECT_FALSE(cache.get(resource));
+
+    const Response response = responseWithData(10);
+    cache.put(resource, response);
+    cache.put(resource, notModified);
+
+    auto cached = cache.get(resource);
+    ASSERT_TRUE(cached);
+    EXPECT_EQ(response.data, cached->data);
+    EXPECT_EQ(notModified.expires, cached->expires);
+}
+
+TEST(ResourceMemoryCache, Errors) {
+    ResourceMemoryCache cache(1024 * 1024);
+    const Resource resource { Resource::Style, "mapbox://style" };
+
+    Response response;
+    response.error = std::make_unique<Response::Error>(Response::Error::Reason::Server, "Error");
+    cache.put(resource, response);
+
+    EXPECT_FALSE(cache.get(resource));
+}
+
+TEST(ResourceMemoryCache, EvictsLeastRecentlyUsed) {
+    // Large enough for a few entries per shard, whichever shards the keys land in.
+    ResourceMemoryCache cache(8 * 3000);
+
+    std::vector<Resource> resources;
+    for (unsigned i = 0; i < 100; ++i) {
+        resources.push_back(Resource { Resource::Style, "mapbox://style" + util::toString(i) });
+        cache.put(resources.back(), responseWithData(1000));
+        // Keep the first one in use.
+        EXPECT_TRUE(cache.get(resources.front()));
+    }
+
+    const auto stats = cache.getStats();
+    EXPECT_LE(stats.size, 8u * 3000);
+    EXPECT_LT(stats.entries, 100u);
+    EXPECT_TRUE(cache.get(resources.front()));
+    EXPECT_TRUE(cache.get(resources.back()));
+    EXPECT_FALSE(cache.get(resources[1]));
+
+    // Entries larger than the budget of a shard aren't stored.
+    const Resource large { Resource::Style, "mapbox://large" };
+    cache.put(large, responseWithData(4000));
+    EXPECT_FALSE(cache.get(large));
+
+    cache.setMaximumSize(0);
+    EXPECT_EQ(0u, cache.getStats().entries);
+    cache.put(large, responseWithData(10));
+    EXPECT_FALSE(cache.get(large));
+}
@@ -10,6 +10,7 @@ process.stdin.on('end', function() { process.exit(0); });
 
 
 var fs = require('fs');
+var zlib = require('zlib');
 var express = require('express');
 var app = express();
 
@@ -165,6 +166,23 @@ app.get('/delayed', function(req, res) {
 });
 
 
+app.get('/gzip', function(req, res) {
+    if (!/\bgzip\b/.test(req.headers['accept-encoding'] || '')) {
+        res.status(406).send('gzip not accepted');
+        return;
+    }
+    res.setHeader('Content-Encoding', 'gzip');
+    res.send(zlib.gzipSync('Hello World!'));
+});
+
+var coalesceCounter = 0;
+app.get('/coalesce', function(req, res) {
+    // Respond slowly, so that identical requests are in flight at the same time.
+    setTimeout(function() {
+        res.send('Response ' + (++coalesceCounter));
+    }, 100);
+});
+
 app.get('/load/:number(\\d+)', function(req, res) {
     res.send('Request ' + req.params.number);
 });
@@ -31,3 +31,27 @@ TEST(StyleConversion, LayerTransition) {
     ASSERT_EQ(500ms, *static_cast<BackgroundLayer*>(layer.get())->impl().paint
         .get<BackgroundColor>().options.delay);
 }
+
+TEST(StyleConversion, LayerFeatureStateExpression) {
+    Error error;
+    auto layer = convertJSON<std::unique_ptr<Layer>>(R"JSON({
+        "type": "symbol",
+        "id": "symbol",
+        "source": "source",
+        "layout": {
+            "text-size": ["case", ["feature-state", "hover"], 16, 12]
+        }
+    })JSON", error);
+    EXPECT_FALSE(bool(layer));
+    EXPECT_EQ("\"feature-state\" data expressions are not supported with layout properties.", error.message);
+
+    layer = convertJSON<std::unique_ptr<Layer>>(R"JSON({
+        "type": "symbol",
+        "id": "symbol",
+        "source": "source",
+        "paint": {
+            "text-opacity": ["case", ["feature-state", "hover"], 1, 0.5]
+        }
+    })JSON", error);
+    EXPECT_TRUE(bool(layer));
+}
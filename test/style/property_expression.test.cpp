@@ -171,3 +171,19 @@ TEST(PropertyExpression, FormatSectionOverride) {
         EXPECT_TRUE(*override1 != *override4);
     }
 }
+
+TEST(PropertyExpression, FeatureState) {
+    PropertyExpression<float> expression(number(featureState("hover"), literal(2.0)), 0.0f);
+    EXPECT_FALSE(expression.isFeatureConstant());
+    EXPECT_FALSE(expression.isStateConstant());
+    EXPECT_TRUE(PropertyExpression<float>(number(get("property"))).isStateConstant());
+
+    // Without state, the expression falls back to the default.
+    EXPECT_EQ(2.0f, expression.evaluate(oneInteger, -1.0f));
+
+    FeatureState state {{ "hover", 5.0 }};
+    EXPECT_EQ(5.0f, expression.evaluate(EvaluationContext(&oneInteger).withFeatureState(&state), -1.0f));
+
+    FeatureState otherState {{ "selected", true }};
+    EXPECT_EQ(2.0f, expression.evaluate(EvaluationContext(&oneInteger).withFeatureState(&otherState), -1.0f));
+}
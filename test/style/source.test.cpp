@@ -9,6 +9,7 @@
 #include <mbgl/style/sources/raster_dem_source.hpp>
 #include <mbgl/style/sources/vector_source.hpp>
 #include <mbgl/style/sources/geojson_source.hpp>
+#include <mbgl/style/sources/geojson_source_impl.hpp>
 #include <mbgl/style/sources/image_source.hpp>
 #include <mbgl/style/sources/custom_geometry_source.hpp>
 #include <mbgl/style/layers/hillshade_layer.hpp>
@@ -68,7 +69,8 @@ public:
         annotationManager,
         imageManager,
         glyphManager,
-        0
+        0,
+        false
     };
 
     SourceTest() {
@@ -722,6 +724,132 @@ TEST(Source, GeoJSonSourceUrlUpdate) {
     test.run();
 }
 
+TEST(Source, GeoJSONSourceSetGeoJSON) {
+    SourceTest test;
+
+    GeoJSONSource source("source");
+    source.setObserver(&test.styleObserver);
+    source.loadDescription(*test.fileSource);
+    ASSERT_TRUE(source.loaded);
+
+    source.setGeoJSON(Geometry<double>{ Point<double>{ 0, 0 } });
+    source.setGeoJSON(Geometry<double>{ Point<double>{ 1, 1 } });
+
+    // The index is built on a background thread, and only the latest data gets swapped in.
+    EXPECT_FALSE(source.loaded);
+    EXPECT_FALSE(source.impl().getData().lock());
+
+    unsigned changes = 0;
+    test.styleObserver.sourceChanged = [&] (Source&) {
+        changes++;
+        EXPECT_TRUE(source.loaded);
+        auto data = source.impl().getData().lock();
+        ASSERT_TRUE(data);
+        EXPECT_EQ(1u, data->getTile({ 0, 0, 0 }).size());
+        test.end();
+    };
+
+    test.run();
+    EXPECT_EQ(1u, changes);
+}
+
+TEST(Source, GeoJSONSourceUpdateFeatures) {
+    SourceTest test;
+
+    GeoJSONSource source("source");
+    source.setObserver(&test.styleObserver);
+
+    std::shared_ptr<GeoJSONData> data;
+    test.styleObserver.sourceChanged = [&] (Source&) {
+        data = source.impl().getData().lock();
+        test.end();
+    };
+
+    FeatureCollection features;
+    features.emplace_back(Point<double>{ -90, 45 });
+    features.back().id = uint64_t(1);
+    features.emplace_back(Point<double>{ 90, -45 });
+    features.back().id = uint64_t(2);
+    source.setGeoJSON(features);
+    test.run();
+
+    ASSERT_TRUE(data);
+    const uint64_t version = data->version;
+    EXPECT_FALSE(data->getChangesSince(version - 1));
+
+    // Move the first feature within the north-western quarter of the world.
+    FeatureCollection changed;
+    changed.emplace_back(Point<double>{ -100, 50 });
+    changed.back().id = uint64_t(1);
+    source.updateFeatures(changed);
+    test.run();
+
+    ASSERT_TRUE(data);
+    EXPECT_EQ(2u, data->getTile({ 0, 0, 0 }).size());
+    auto changes = data->getChangesSince(version);
+    ASSERT_TRUE(changes);
+    EXPECT_EQ(2u, changes->size());
+    EXPECT_EQ(-100, (*changes)[0].min.x);
+    EXPECT_EQ(-90, (*changes)[1].min.x);
+
+    source.removeFeatures({ uint64_t(2), uint64_t(3) });
+    test.run();
+
+    ASSERT_TRUE(data);
+    EXPECT_EQ(1u, data->getTile({ 0, 0, 0 }).size());
+    EXPECT_EQ(0u, data->getTile({ 1, 1, 1 }).size());
+    changes = data->getChangesSince(version);
+    ASSERT_TRUE(changes);
+    EXPECT_EQ(3u, changes->size());
+    EXPECT_EQ(90, changes->back().min.x);
+
+    // Replacing the data as a whole invalidates everything.
+    source.setGeoJSON(features);
+    test.run();
+
+    ASSERT_TRUE(data);
+    EXPECT_EQ(2u, data->getTile({ 0, 0, 0 }).size());
+    EXPECT_FALSE(data->getChangesSince(version));
+}
+
+TEST(Source, GeoJSONFeatureStoreChunks) {
+    // Two features per chunk, so that changes span several chunks. Without a buffer, tiles
+    // only hold the points within them.
+    GeoJSONOptions options;
+    options.buffer = 0;
+    GeoJSONFeatureStore store { options, 2 };
+
+    FeatureCollection features;
+    for (uint64_t id = 1; id <= 5; ++id) {
+        features.emplace_back(Point<double>{ double(id), double(id) });
+        features.back().id = id;
+    }
+    auto data = store.set(features);
+
+    auto ids = [] (const mapbox::feature::feature_collection<int16_t>& tile) {
+        std::vector<uint64_t> result;
+        for (const auto& feature : tile) {
+            result.push_back(feature.id.get<uint64_t>());
+        }
+        return result;
+    };
+    EXPECT_EQ((std::vector<uint64_t>{ 1, 2, 3, 4, 5 }), ids(data->getTile({ 0, 0, 0 })));
+
+    // Changed features keep their place, and new ones are drawn last.
+    FeatureCollection changed;
+    changed.emplace_back(Point<double>{ -10, -10 });
+    changed.back().id = uint64_t(2);
+    changed.emplace_back(Point<double>{ 6, 6 });
+    changed.back().id = uint64_t(6);
+    data = store.update(changed, { uint64_t(3), uint64_t(4) });
+    EXPECT_EQ((std::vector<uint64_t>{ 1, 2, 5, 6 }), ids(data->getTile({ 0, 0, 0 })));
+    EXPECT_EQ((std::vector<uint64_t>{ 1, 5, 6 }), ids(data->getTile({ 1, 1, 0 })));
+    EXPECT_EQ((std::vector<uint64_t>{ 2 }), ids(data->getTile({ 1, 0, 1 })));
+
+    data = store.update({}, { uint64_t(1), uint64_t(2), uint64_t(5), uint64_t(6) });
+    EXPECT_EQ(0u, data->getTile({ 0, 0, 0 }).size());
+}
+
 TEST(Source, ImageSourceImageUpdate) {
     SourceTest test;
 
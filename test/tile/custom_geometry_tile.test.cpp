@@ -39,7 +39,8 @@ public:
         annotationManager,
         imageManager,
         glyphManager,
-        0
+        0,
+        false
     };
 };
 
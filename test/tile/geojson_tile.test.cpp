@@ -8,16 +8,33 @@
 #include <mbgl/map/transform.hpp>
 #include <mbgl/renderer/tile_parameters.hpp>
 #include <mbgl/style/style.hpp>
+#include <mbgl/style/sources/geojson_source_impl.hpp>
 #include <mbgl/style/layers/circle_layer.hpp>
 #include <mbgl/style/layers/circle_layer_impl.hpp>
+#include <mbgl/style/expression/dsl.hpp>
+#include <mbgl/renderer/buckets/circle_bucket.hpp>
+#include <mbgl/renderer/property_evaluation_parameters.hpp>
 #include <mbgl/annotation/annotation_manager.hpp>
 #include <mbgl/renderer/image_manager.hpp>
 #include <mbgl/text/glyph_manager.hpp>
+#include <mbgl/actor/actor.hpp>
+#include <mbgl/actor/scheduler.hpp>
 
 #include <memory>
 
 using namespace mbgl;
 using namespace mbgl::style;
+using namespace mbgl::style::expression::dsl;
+
+namespace {
+
+FeatureCollection point() {
+    FeatureCollection features;
+    features.emplace_back(Point<double>{ 0, 0 });
+    return features;
+}
+
+} // namespace
 
 class GeoJSONTileTest {
 public:
@@ -39,8 +56,11 @@ public:
         annotationManager,
         imageManager,
         glyphManager,
-        0
+        0,
+        false
     };
+
+    Actor<GeoJSONTileSlicer> slicer { Scheduler::GetBackground(), GeoJSONData::create(point(), {}) };
 };
 
 TEST(GeoJSONTile, Issue7648) {
@@ -48,10 +68,7 @@ TEST(GeoJSONTile, Issue7648) {
 
     CircleLayer layer("circle", "source");
 
-    mapbox::feature::feature_collection<int16_t> features;
-    features.push_back(mapbox::feature::feature<int16_t> { mapbox::geometry::point<int16_t>(0, 0) });
-
-    GeoJSONTile tile(OverscaledTileID(0, 0, 0), "source", test.tileParameters, features);
+    GeoJSONTile tile(OverscaledTileID(0, 0, 0), "source", test.tileParameters, test.slicer.self());
 
     StubTileObserver observer;
     observer.tileChanged = [&] (const Tile&) {
@@ -68,8 +85,8 @@ TEST(GeoJSONTile, Issue7648) {
         test.loop.runOnce();
     }
 
-    tile.updateData(features);
-    while (!tile.isComplete()) {
+    tile.updateData(test.slicer.self());
+    while (tile.isSlicing() || !tile.isComplete()) {
         test.loop.runOnce();
     }
 }
@@ -81,10 +98,7 @@ TEST(GeoJSONTile, Issue9927) {
 
     CircleLayer layer("circle", "source");
 
-    mapbox::feature::feature_collection<int16_t> features;
-    features.push_back(mapbox::feature::feature<int16_t> { mapbox::geometry::point<int16_t>(0, 0) });
-
-    GeoJSONTile tile(OverscaledTileID(0, 0, 0), "source", test.tileParameters, features);
+    GeoJSONTile tile(OverscaledTileID(0, 0, 0), "source", test.tileParameters, test.slicer.self());
 
     Immutable<LayerProperties> layerProperties = makeMutable<CircleLayerProperties>(staticImmutableCast<CircleLayer::Impl>(layer.baseImpl));
     std::vector<Immutable<LayerProperties>> layers { layerProperties };
@@ -105,8 +119,42 @@ TEST(GeoJSONTile, Issue9927) {
 
     // Then simulate a parsing failure and make sure that we keep it renderable in this situation
     // as well. We're using 3 as a correlationID since we've done two three calls that increment
-    // this counter (as part of the GeoJSONTile constructor, setLayers, and setPlacementConfig).
+    // this counter (as part of setting the sliced data, setLayers, and setPlacementConfig).
     tile.onError(std::make_exception_ptr(std::runtime_error("Parse error")), 3);
     ASSERT_TRUE(tile.isRenderable());
     ASSERT_NE(nullptr, tile.getBucket(*layer.baseImpl));
  }
+
+// Tests that feature state applied to a tile before it's laid out is applied to its new buckets
+// right away, instead of only with the next state change.
+TEST(GeoJSONTile, FeatureStateAppliedOnLayout) {
+    GeoJSONTileTest test;
+
+    FeatureCollection features;
+    features.emplace_back(Point<double>{ 0, 0 });
+    features.back().id = uint64_t(1);
+    Actor<GeoJSONTileSlicer> slicer { Scheduler::GetBackground(), GeoJSONData::create(features, {}) };
+
+    CircleLayer layer("circle", "source");
+    layer.setCircleOpacity(PropertyExpression<float>(number(featureState("opacity"), literal(0.0))));
+    auto impl = staticImmutableCast<CircleLayer::Impl>(layer.baseImpl);
+    Immutable<LayerProperties> layerProperties = makeMutable<CircleLayerProperties>(
+        impl, impl->paint.untransitioned().evaluate(PropertyEvaluationParameters(0)));
+    std::vector<Immutable<LayerProperties>> layers { layerProperties };
+
+    GeoJSONTile tile(OverscaledTileID(0, 0, 0), "source", test.tileParameters, slicer.self());
+    LayerFeatureStates states;
+    states[""]["1"]["opacity"] = 1.0;
+    tile.setFeatureState(states);
+    tile.setLayers(layers);
+
+    while (tile.isSlicing() || !tile.isComplete()) {
+        test.loop.runOnce();
+    }
+
+    auto bucket = static_cast<CircleBucket*>(tile.getBucket(*layer.baseImpl));
+    ASSERT_NE(nullptr, bucket);
+    const auto opacity = bucket->paintPropertyBinders.at("circle").statistics<CircleOpacity>().max();
+    ASSERT_TRUE(bool(opacity));
+    EXPECT_EQ(1.0f, *opacity);
+}
@@ -34,7 +34,8 @@ public:
         annotationManager,
         imageManager,
         glyphManager,
-        0
+        0,
+        false
     };
 };
 
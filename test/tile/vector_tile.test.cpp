@@ -40,7 +40,8 @@ public:
         annotationManager,
         imageManager,
         glyphManager,
-        0
+        0,
+        false
     };
 };
 
@@ -69,7 +70,8 @@ TEST(VectorTile, Issue8542) {
 
     // Query before data is set
     std::vector<Feature> result;
-    tile.querySourceFeatures(result, { { {"layer"} }, {} });
+    std::set<FeatureIdentifier> seenIDs;
+    tile.querySourceFeatures(result, { { {"layer"} }, {} }, seenIDs);
 }
 
 TEST(VectorTileData, ParseResults) {
@@ -0,0 +1,85 @@
+#include <mbgl/util/geojson_parser.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace mbgl;
+
+namespace {
+
+// Parses the input with the DOM based parser too, which the result must match.
+void expectSameAsDOM(const std::string& json) {
+    EXPECT_EQ(mapbox::geojson::parse(json), util::parseGeoJSON(json)) << json;
+}
+
+std::string parseError(const std::string& json) {
+    try {
+        util::parseGeoJSON(json);
+    } catch (const std::runtime_error& ex) {
+        return ex.what();
+    }
+    return "";
+}
+
+} // namespace
+
+TEST(GeoJSONParser, Geometries) {
+    expectSameAsDOM(R"JSON({ "type": "Point", "coordinates": [1, 2.5] })JSON");
+    expectSameAsDOM(R"JSON({ "type": "Point", "coordinates": [1, 2, 300] })JSON");
+    expectSameAsDOM(R"JSON({ "coordinates": [[1, 2], [-3, 4]], "type": "MultiPoint" })JSON");
+    expectSameAsDOM(R"JSON({ "type": "LineString", "coordinates": [[1, 2], [3, 4]] })JSON");
+    expectSameAsDOM(R"JSON({ "type": "MultiLineString", "coordinates": [[[1, 2], [3, 4]], []] })JSON");
+    expectSameAsDOM(R"JSON({ "type": "Polygon", "coordinates": [[[0, 0], [1, 0], [1, 1], [0, 0]]] })JSON");
+    expectSameAsDOM(R"JSON({ "type": "MultiPolygon", "coordinates": [[[[0, 0], [1, 0], [0, 0]]], [[]]] })JSON");
+    expectSameAsDOM(R"JSON({ "type": "GeometryCollection", "geometries": [
+        { "type": "Point", "coordinates": [1, 2] },
+        { "type": "GeometryCollection", "geometries": [] }
+    ] })JSON");
+}
+
+TEST(GeoJSONParser, Features) {
+    expectSameAsDOM(R"JSON({ "type": "Feature", "id": "a", "geometry": { "type": "Point", "coordinates": [1, 2] } })JSON");
+    expectSameAsDOM(R"JSON({
+        "properties": { "name": "b", "count": 2, "negative": -1, "ratio": 0.5, "valid": true,
+                        "nothing": null, "list": [1, "two", [3]], "map": { "nested": { "key": "value" } } },
+        "geometry": { "coordinates": [1, 2], "type": "Point" },
+        "id": 7,
+        "bbox": [1, 2, 1, 2],
+        "type": "Feature"
+    })JSON");
+    expectSameAsDOM(R"JSON({ "type": "FeatureCollection", "features": [] })JSON");
+    expectSameAsDOM(R"JSON({ "type": "FeatureCollection", "crs": { "type": "name" }, "features": [
+        { "type": "Feature", "id": -3, "geometry": { "type": "LineString", "coordinates": [[1, 2], [3, 4]] } },
+        { "type": "Feature", "id": 1.5, "geometry": { "type": "Point", "coordinates": [0, 0] }, "properties": { "type": "Feature" } }
+    ] })JSON");
+}
+
+TEST(GeoJSONParser, NullMembers) {
+    const GeoJSON geoJSON = util::parseGeoJSON(R"JSON({ "type": "Feature", "geometry": null, "properties": null })JSON");
+    ASSERT_TRUE(geoJSON.is<Feature>());
+    EXPECT_TRUE(geoJSON.get<Feature>().geometry.is<mapbox::geometry::empty>());
+    EXPECT_TRUE(geoJSON.get<Feature>().properties.empty());
+}
+
+TEST(GeoJSONParser, Errors) {
+    EXPECT_EQ("The document is empty. at offset 0", parseError(""));
+    EXPECT_EQ("Missing a colon after a name of object member. at offset 9",
+              parseError(R"JSON({ "type" 1 })JSON"));
+    EXPECT_EQ("GeoJSON must be an object", parseError("[]"));
+    EXPECT_EQ("GeoJSON must have a type property", parseError("{}"));
+    EXPECT_EQ("GeoJSON type must be a string", parseError(R"JSON({ "type": 1 })JSON"));
+    EXPECT_EQ("Circle not yet implemented", parseError(R"JSON({ "type": "Circle", "coordinates": [] })JSON"));
+    EXPECT_EQ("Geometry must have a coordinates property", parseError(R"JSON({ "type": "Point" })JSON"));
+    EXPECT_EQ("coordinates array must have at least 2 numbers",
+              parseError(R"JSON({ "type": "Point", "coordinates": [1] })JSON"));
+    EXPECT_EQ("coordinates must be arrays of numbers",
+              parseError(R"JSON({ "type": "Point", "coordinates": [[1, 2]] })JSON"));
+    EXPECT_EQ("coordinates must be arrays of numbers",
+              parseError(R"JSON({ "type": "LineString", "coordinates": [[1, "2"]] })JSON"));
+    EXPECT_EQ("Feature must have a geometry property", parseError(R"JSON({ "type": "Feature" })JSON"));
+    EXPECT_EQ("Feature id must be a string or number",
+              parseError(R"JSON({ "type": "Feature", "id": true, "geometry": null })JSON"));
+    EXPECT_EQ("FeatureCollection must have features property",
+              parseError(R"JSON({ "type": "FeatureCollection" })JSON"));
+    EXPECT_EQ("Feature type must be Feature",
+              parseError(R"JSON({ "type": "FeatureCollection", "features": [{ "type": "Point", "coordinates": [1, 2] }] })JSON"));
+}